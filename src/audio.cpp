@@ -0,0 +1,143 @@
+/// Audio System Implementation
+/// 
+/// Implements the AudioSystem class for the C++ Tetris game: device, music and effects all live on one dedicated thread. // Implementiert die AudioSystem-Klasse für das C++ Tetris-Spiel: Gerät, Musik und Effekte leben alle auf einem eigenen Thread.
+/// The thread wakes every few milliseconds, so the music buffer is refilled even while the main loop is stalled or idle. // Der Thread wacht alle paar Millisekunden auf, daher wird der Musikpuffer auch nachgefüllt, während die Hauptschleife hängt oder im Leerlauf ist.
+/// 
+/// Usage:
+/// ```cpp
+/// AudioSystem audio(4);
+/// audio.Post(SoundClear);
+/// ```
+/// 
+/// EN: Overlapping effects each get their own voice instead of restarting one shared Sound.
+/// DE: Überlappende Effekte erhalten jeweils eine eigene Stimme, statt einen gemeinsamen Sound neu zu starten.
+
+#include "audio.h" // Includes the AudioSystem class header file with declarations. // Inkludiert die AudioSystem-Klassen-Header-Datei mit Deklarationen.
+#include <chrono> // Includes durations for the thread's sleep. // Inkludiert Zeitdauern für den Schlaf des Threads.
+
+SoundQueue::SoundQueue() // Constructor that starts with an empty ring. // Konstruktor, der mit einem leeren Ring beginnt.
+{
+    head = 0;
+    tail = 0;
+}
+
+bool SoundQueue::Push(unsigned char event) // Writes the event, then publishes it with a release store. // Schreibt das Ereignis und veröffentlicht es dann mit einem Release-Store.
+{
+    unsigned int position = tail.load(std::memory_order_relaxed); // Only this thread writes tail. // Nur dieser Thread schreibt tail.
+    if (position - head.load(std::memory_order_acquire) >= capacity) // Ring full. // Ring voll.
+    {
+        return false;
+    }
+    events[position % capacity] = event;
+    tail.store(position + 1, std::memory_order_release); // Makes the event visible to the consumer. // Macht das Ereignis für den Konsumenten sichtbar.
+    return true;
+}
+
+bool SoundQueue::Pop(unsigned char &event) // Reads the oldest event, then frees its slot with a release store. // Liest das älteste Ereignis und gibt dann seinen Platz mit einem Release-Store frei.
+{
+    unsigned int position = head.load(std::memory_order_relaxed); // Only this thread writes head. // Nur dieser Thread schreibt head.
+    if (position == tail.load(std::memory_order_acquire)) // Ring empty. // Ring leer.
+    {
+        return false;
+    }
+    event = events[position % capacity];
+    head.store(position + 1, std::memory_order_release); // Returns the slot to the producer. // Gibt den Platz an den Produzenten zurück.
+    return true;
+}
+
+AudioSystem::AudioSystem(int voicesPerEffect) // Constructor that starts the audio thread. // Konstruktor, der den Audio-Thread startet.
+{
+    voiceCount = voicesPerEffect < 1 ? 1 : (voicesPerEffect > maxVoices ? maxVoices : voicesPerEffect); // 1 to maxVoices voices. // 1 bis maxVoices Stimmen.
+    for (int effect = 0; effect < SoundEffectCount; effect++)
+    {
+        nextVoice[effect] = 0;
+    }
+    running = true;
+    droppedEvents = 0;
+    stolenVoices = 0;
+    thread = std::thread(&AudioSystem::Run, this); // Starts after every member is initialized. // Startet, nachdem jedes Mitglied initialisiert ist.
+}
+
+AudioSystem::~AudioSystem() // Destructor that stops the audio thread. // Destruktor, der den Audio-Thread stoppt.
+{
+    running = false; // The thread unloads and closes the device before it returns. // Der Thread entlädt und schließt das Gerät, bevor er zurückkehrt.
+    thread.join();
+}
+
+void AudioSystem::Post(SoundEffect effect) // Queues an effect from the game thread. // Stellt einen Effekt vom Spiel-Thread ein.
+{
+    if (!queue.Push((unsigned char)effect)) // More than a frame's worth of events pending: drops instead of blocking the game. // Mehr als ein Frame an Ereignissen ausstehend: verwirft, statt das Spiel zu blockieren.
+    {
+        droppedEvents.fetch_add(1, std::memory_order_relaxed);
+    }
+}
+
+unsigned int AudioSystem::GetDroppedEvents() // Returns events dropped because the queue was full. // Gibt wegen voller Warteschlange verworfene Ereignisse zurück.
+{
+    return droppedEvents.load(std::memory_order_relaxed);
+}
+
+unsigned int AudioSystem::GetStolenVoices() // Returns effects that cut off a busy voice. // Gibt Effekte zurück, die eine belegte Stimme abgeschnitten haben.
+{
+    return stolenVoices.load(std::memory_order_relaxed);
+}
+
+void AudioSystem::Play(int effect) // Picks a voice in round-robin order, preferring idle ones. // Wählt eine Stimme reihum und bevorzugt untätige.
+{
+    for (int i = 0; i < voiceCount; i++) // Looks for an idle voice, starting after the most recently used one. // Sucht eine untätige Stimme, beginnend nach der zuletzt verwendeten.
+    {
+        int voice = (nextVoice[effect] + i) % voiceCount;
+        if (!IsSoundPlaying(voices[effect][voice]))
+        {
+            PlaySound(voices[effect][voice]);
+            nextVoice[effect] = (voice + 1) % voiceCount;
+            return;
+        }
+    }
+    int oldest = nextVoice[effect]; // All voices busy: restarts the one started longest ago. // Alle Stimmen belegt: startet die am längsten laufende neu.
+    StopSound(voices[effect][oldest]);
+    PlaySound(voices[effect][oldest]);
+    nextVoice[effect] = (oldest + 1) % voiceCount;
+    stolenVoices.fetch_add(1, std::memory_order_relaxed);
+}
+
+void AudioSystem::Run() // Audio thread body. // Rumpf des Audio-Threads.
+{
+    InitAudioDevice(); // Opens the audio device on this thread (moved here from the Game constructor). // Öffnet das Audiogerät auf diesem Thread (hierher aus dem Game-Konstruktor verschoben).
+    music = LoadMusicStream("Sounds/music.mp3"); // Streams the background music from disk. // Streamt die Hintergrundmusik von der Festplatte.
+    PlayMusicStream(music); // Starts looping playback. // Startet die Wiedergabe in einer Schleife.
+    const char *files[SoundEffectCount] = {"Sounds/rotate.mp3", "Sounds/clear.mp3"}; // Effect files by SoundEffect. // Effektdateien nach SoundEffect.
+    for (int effect = 0; effect < SoundEffectCount; effect++)
+    {
+        Wave wave = LoadWave(files[effect]); // Decodes the MP3 to PCM once. // Dekodiert das MP3 einmal zu PCM.
+        for (int voice = 0; voice < voiceCount; voice++)
+        {
+            voices[effect][voice] = LoadSoundFromWave(wave); // Each voice gets an audio buffer of the decoded samples. // Jede Stimme erhält einen Audiopuffer der dekodierten Samples.
+        }
+        UnloadWave(wave); // The voices hold their own copies. // Die Stimmen halten ihre eigenen Kopien.
+    }
+
+    while (running.load(std::memory_order_relaxed)) // Runs until the destructor clears the flag. // Läuft, bis der Destruktor die Flagge löscht.
+    {
+        UpdateMusicStream(music); // Refills the music buffer independently of the frame rate. // Füllt den Musikpuffer unabhängig von der Bildrate nach.
+        unsigned char event; // Effect posted by the game. // Vom Spiel eingestelltes Ereignis.
+        while (queue.Pop(event)) // Plays everything posted since the last wake-up. // Spielt alles, was seit dem letzten Aufwachen eingestellt wurde.
+        {
+            if (event < SoundEffectCount)
+            {
+                Play(event);
+            }
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(4)); // Short enough for effect latency, long enough to stay near 0% CPU. // Kurz genug für die Effektlatenz, lang genug, um nahe 0 % CPU zu bleiben.
+    }
+
+    for (int effect = 0; effect < SoundEffectCount; effect++) // Frees all voices. // Gibt alle Stimmen frei.
+    {
+        for (int voice = 0; voice < voiceCount; voice++)
+        {
+            UnloadSound(voices[effect][voice]);
+        }
+    }
+    UnloadMusicStream(music); // Frees the music stream. // Gibt den Musik-Stream frei.
+    CloseAudioDevice(); // Closes the device on the thread that opened it. // Schließt das Gerät auf dem Thread, der es geöffnet hat.
+}
@@ -0,0 +1,68 @@
+/// Audio System Header
+/// 
+/// Header file declaring the AudioSystem class, which owns every raylib audio call of the C++ Tetris game on its own thread. // Header-Datei, die die AudioSystem-Klasse deklariert, die jeden raylib-Audioaufruf des C++ Tetris-Spiels auf einem eigenen Thread besitzt.
+/// Game code posts sound events into a lock-free single-producer queue; the audio thread refills the music stream and plays effects from a voice pool. // Spielcode stellt Sound-Ereignisse in eine sperrfreie Einzelproduzenten-Warteschlange; der Audio-Thread füllt den Musik-Stream nach und spielt Effekte aus einem Stimmen-Pool.
+/// 
+/// Usage:
+/// ```cpp
+/// #include "audio.h"
+/// 
+/// AudioSystem audio(4);            // Four voices per effect, so four rotations can overlap
+/// game.audio = &audio;
+/// audio.Post(SoundRotate);         // Never blocks and never calls raylib on the caller's thread
+/// ```
+/// 
+/// EN: Effects are decoded to PCM once at load; voices are created from that PCM up front, so playing never decodes or allocates.
+/// DE: Effekte werden beim Laden einmal zu PCM dekodiert; Stimmen werden vorab aus diesem PCM erzeugt, daher dekodiert oder alloziert das Abspielen nie.
+
+#pragma once // Ensures this header file is included only once during compilation. // Stellt sicher, dass diese Header-Datei nur einmal während der Kompilierung eingebunden wird.
+#include <raylib.h> // Includes raylib audio types (Music, Sound, Wave). // Inkludiert raylib-Audiotypen (Music, Sound, Wave).
+#include <atomic> // Includes atomics for the lock-free queue and the stop flag. // Inkludiert Atomics für die sperrfreie Warteschlange und die Stopp-Flagge.
+#include <thread> // Includes std::thread for the audio thread. // Inkludiert std::thread für den Audio-Thread.
+
+enum SoundEffect // Effects the game can post. // Effekte, die das Spiel einstellen kann.
+{
+    SoundRotate = 0, // Sounds/rotate.mp3, posted by Game::RotateBlock. // Sounds/rotate.mp3, von Game::RotateBlock eingestellt.
+    SoundClear = 1, // Sounds/clear.mp3, posted by Game::LockBlock. // Sounds/clear.mp3, von Game::LockBlock eingestellt.
+    SoundEffectCount = 2 // Number of effects. // Anzahl der Effekte.
+};
+
+class SoundQueue // Lock-free ring buffer for one producer (game thread) and one consumer (audio thread). // Sperrfreier Ringpuffer für einen Produzenten (Spiel-Thread) und einen Konsumenten (Audio-Thread).
+{
+public: // Public interface accessible from outside the class. // Öffentliche Schnittstelle, die von außerhalb der Klasse zugänglich ist.
+    SoundQueue(); // Constructor that starts with an empty ring. // Konstruktor, der mit einem leeren Ring beginnt.
+    bool Push(unsigned char event); // Producer side: returns false if the ring is full (the event is dropped). // Produzentenseite: gibt falsch zurück, wenn der Ring voll ist (das Ereignis wird verworfen).
+    bool Pop(unsigned char &event); // Consumer side: returns false if the ring is empty. // Konsumentenseite: gibt falsch zurück, wenn der Ring leer ist.
+
+private: // Private members accessible only within the class. // Private Mitglieder, die nur innerhalb der Klasse zugänglich sind.
+    static const unsigned int capacity = 64; // Ring size (power of two); far more than one frame of events. // Ringgröße (Zweierpotenz); weit mehr als die Ereignisse eines Frames.
+    unsigned char events[capacity]; // Ring storage. // Ringspeicher.
+    alignas(64) std::atomic<unsigned int> head; // Next slot to read, written only by the consumer (own cache line). // Nächster zu lesender Platz, nur vom Konsumenten geschrieben (eigene Cache-Line).
+    alignas(64) std::atomic<unsigned int> tail; // Next slot to write, written only by the producer (own cache line). // Nächster zu schreibender Platz, nur vom Produzenten geschrieben (eigene Cache-Line).
+};
+
+class AudioSystem // Declares the threaded audio subsystem. // Deklariert das Audio-Subsystem mit eigenem Thread.
+{
+public: // Public interface accessible from outside the class. // Öffentliche Schnittstelle, die von außerhalb der Klasse zugänglich ist.
+    AudioSystem(int voicesPerEffect); // Constructor that starts the audio thread, which opens the device and loads music and effects. // Konstruktor, der den Audio-Thread startet, der das Gerät öffnet und Musik und Effekte lädt.
+    ~AudioSystem(); // Destructor that stops the thread, which unloads everything and closes the device. // Destruktor, der den Thread stoppt, der alles entlädt und das Gerät schließt.
+    AudioSystem(const AudioSystem &) = delete; // Owns a thread and is not copied. // Besitzt einen Thread und wird nicht kopiert.
+    AudioSystem &operator=(const AudioSystem &) = delete; // Owns a thread and is not copied. // Besitzt einen Thread und wird nicht kopiert.
+    void Post(SoundEffect effect); // Queues an effect from the game thread; never blocks. // Stellt einen Effekt vom Spiel-Thread ein; blockiert nie.
+    unsigned int GetDroppedEvents(); // Returns events dropped because the queue was full. // Gibt Ereignisse zurück, die verworfen wurden, weil die Warteschlange voll war.
+    unsigned int GetStolenVoices(); // Returns effects that had to cut off their oldest voice because all voices were busy. // Gibt Effekte zurück, die ihre älteste Stimme abschneiden mussten, weil alle Stimmen belegt waren.
+
+private: // Private members accessible only within the class. // Private Mitglieder, die nur innerhalb der Klasse zugänglich sind.
+    static const int maxVoices = 8; // Upper limit of voices per effect. // Obergrenze der Stimmen pro Effekt.
+    void Run(); // Audio thread body: load, refill music, play queued effects, unload. // Rumpf des Audio-Threads: laden, Musik nachfüllen, eingestellte Effekte spielen, entladen.
+    void Play(int effect); // Starts an effect on a free voice, or on the oldest one if all are busy. // Startet einen Effekt auf einer freien Stimme oder auf der ältesten, wenn alle belegt sind.
+    SoundQueue queue; // Events from the game thread. // Ereignisse vom Spiel-Thread.
+    Music music; // Background music stream (used only on the audio thread). // Hintergrundmusik-Stream (nur auf dem Audio-Thread verwendet).
+    Sound voices[SoundEffectCount][maxVoices]; // Preallocated voices, each with its own copy of the decoded PCM. // Vorab angelegte Stimmen, jede mit ihrer eigenen Kopie des dekodierten PCM.
+    int voiceCount; // Voices per effect. // Stimmen pro Effekt.
+    int nextVoice[SoundEffectCount]; // Round-robin position, so the oldest voice is reused first. // Reihum-Position, damit die älteste Stimme zuerst wiederverwendet wird.
+    std::atomic<bool> running; // Cleared by the destructor to stop the thread. // Vom Destruktor gelöscht, um den Thread zu stoppen.
+    std::atomic<unsigned int> droppedEvents; // Events lost to a full queue. // Durch eine volle Warteschlange verlorene Ereignisse.
+    std::atomic<unsigned int> stolenVoices; // Effects that cut off a busy voice. // Effekte, die eine belegte Stimme abgeschnitten haben.
+    std::thread thread; // The audio thread (started last in the constructor). // Der Audio-Thread (im Konstruktor zuletzt gestartet).
+};
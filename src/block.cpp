@@ -72,3 +72,18 @@ void Block::UndoRotation() // Reverses the last rotation (used for collision han
         rotationState = cells.size() - 1; // Sets to last rotation state (circular rotation). // Setzt auf letzten Rotationszustand (zirkuläre Rotation).
     }
 }
+
+int Block::GetRotation() // Returns the rotation state for recorders. // Gibt den Rotationszustand für Aufzeichner zurück.
+{
+    return rotationState;
+}
+
+int Block::GetRowOffset() // Returns the row offset for recorders. // Gibt den Reihen-Offset für Aufzeichner zurück.
+{
+    return rowOffset;
+}
+
+int Block::GetColumnOffset() // Returns the column offset for recorders. // Gibt den Spalten-Offset für Aufzeichner zurück.
+{
+    return columnOffset;
+}
@@ -31,6 +31,9 @@ public: // Public interface accessible from outside the class. // Öffentliche S
     std::vector<Position> GetCellPositions(); // Returns current positions of all cells that make up the block. // Gibt aktuelle Positionen aller Zellen zurück, die den Block bilden.
     void Rotate(); // Rotates the block to its next rotation state (clockwise). // Rotiert den Block zum nächsten Rotationszustand (im Uhrzeigersinn).
     void UndoRotation(); // Reverses the last rotation operation (for collision handling). // Macht die letzte Rotationsoperation rückgängig (für Kollisionsbehandlung).
+    int GetRotation(); // Returns the current rotation state (PieceState::rotation in the Engine). // Gibt den aktuellen Rotationszustand zurück (PieceState::rotation in der Engine).
+    int GetRowOffset(); // Returns the vertical offset (PieceState::row in the Engine). // Gibt den vertikalen Offset zurück (PieceState::row in der Engine).
+    int GetColumnOffset(); // Returns the horizontal offset (PieceState::column in the Engine). // Gibt den horizontalen Offset zurück (PieceState::column in der Engine).
     int id; // Unique identifier for the block type (1-7 for different Tetris pieces). // Eindeutige Kennung für den Blocktyp (1-7 für verschiedene Tetris-Stücke).
     std::map<int, std::vector<Position>> cells; // Maps rotation states to their corresponding cell positions. // Ordnet Rotationszustände ihren entsprechenden Zellpositionen zu.
     // Key: rotation state (0-3), Value: vector of Position objects defining the shape. // Schlüssel: Rotationszustand (0-3), Wert: Vektor von Position-Objekten, die die Form definieren.
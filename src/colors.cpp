@@ -15,17 +15,23 @@
 /// DE: Bietet eine umfassende Farbpalette für das Tetris-Spiel mit klassischen Farben für jeden Blocktyp und UI-Elemente.
 
 #include "colors.h" // Includes the colors header file with Color type definitions and function declarations. // Inkludiert die Farben-Header-Datei mit Color-Typ-Definitionen und Funktionsdeklarationen.
+#include "palette.h" // Includes the raylib-free RGBA table shared with the software renderer. // Inkludiert die raylib-freie RGBA-Tabelle, die mit dem Software-Renderer geteilt wird.
 
-const Color darkGrey = {26, 31, 40, 255}; // Dark grey color for empty cells and backgrounds (RGBA: 26,31,40,255). // Dunkelgraue Farbe für leere Zellen und Hintergründe (RGBA: 26,31,40,255).
-const Color green = {47, 230, 23, 255}; // Bright green color for S-shaped blocks (RGBA: 47,230,23,255). // Hellgrüne Farbe für S-förmige Blöcke (RGBA: 47,230,23,255).
-const Color red = {232, 18, 18, 255}; // Bright red color for Z-shaped blocks (RGBA: 232,18,18,255). // Hellrote Farbe für Z-förmige Blöcke (RGBA: 232,18,18,255).
-const Color orange = {226, 116, 17, 255}; // Orange color for L-shaped blocks (RGBA: 226,116,17,255). // Orange Farbe für L-förmige Blöcke (RGBA: 226,116,17,255).
-const Color yellow = {237, 234, 4, 255}; // Bright yellow color for O-shaped (square) blocks (RGBA: 237,234,4,255). // Hellgelbe Farbe für O-förmige (quadratische) Blöcke (RGBA: 237,234,4,255).
-const Color purple = {166, 0, 247, 255}; // Purple color for T-shaped blocks (RGBA: 166,0,247,255). // Lila Farbe für T-förmige Blöcke (RGBA: 166,0,247,255).
-const Color cyan = {21, 204, 209, 255}; // Cyan color for I-shaped (line) blocks (RGBA: 21,204,209,255). // Cyan Farbe für I-förmige (Linien-) Blöcke (RGBA: 21,204,209,255).
-const Color blue = {13, 64, 216, 255}; // Blue color for J-shaped blocks (RGBA: 13,64,216,255). // Blaue Farbe für J-förmige Blöcke (RGBA: 13,64,216,255).
-const Color lightBlue = {59, 85, 162, 255}; // Light blue color for UI elements and score display (RGBA: 59,85,162,255). // Hellblaue Farbe für UI-Elemente und Punkteanzeige (RGBA: 59,85,162,255).
-const Color darkBlue = {44, 44, 127, 255}; // Dark blue color for game background and borders (RGBA: 44,44,127,255). // Dunkelblaue Farbe für Spielhintergrund und Ränder (RGBA: 44,44,127,255).
+static constexpr Color PaletteColor(int index) // Converts one palette entry; constexpr, so the colors below are still initialized at compile time. // Wandelt einen Paletteneintrag um; constexpr, daher werden die Farben unten weiterhin zur Kompilierzeit initialisiert.
+{
+    return {paletteRgba[index][0], paletteRgba[index][1], paletteRgba[index][2], paletteRgba[index][3]};
+}
+
+const Color darkGrey = PaletteColor(0); // Dark grey color for empty cells and backgrounds. // Dunkelgraue Farbe für leere Zellen und Hintergründe.
+const Color green = PaletteColor(1); // Bright green color for S-shaped blocks. // Hellgrüne Farbe für S-förmige Blöcke.
+const Color red = PaletteColor(2); // Bright red color for Z-shaped blocks. // Hellrote Farbe für Z-förmige Blöcke.
+const Color orange = PaletteColor(3); // Orange color for L-shaped blocks. // Orange Farbe für L-förmige Blöcke.
+const Color yellow = PaletteColor(4); // Bright yellow color for O-shaped (square) blocks. // Hellgelbe Farbe für O-förmige (quadratische) Blöcke.
+const Color purple = PaletteColor(5); // Purple color for T-shaped blocks. // Lila Farbe für T-förmige Blöcke.
+const Color cyan = PaletteColor(6); // Cyan color for I-shaped (line) blocks. // Cyan Farbe für I-förmige (Linien-) Blöcke.
+const Color blue = PaletteColor(7); // Blue color for J-shaped blocks. // Blaue Farbe für J-förmige Blöcke.
+const Color lightBlue = PaletteColor(paletteLightBlue); // Light blue color for UI elements and score display. // Hellblaue Farbe für UI-Elemente und Punkteanzeige.
+const Color darkBlue = PaletteColor(paletteDarkBlue); // Dark blue color for game background and borders. // Dunkelblaue Farbe für Spielhintergrund und Ränder.
 
 std::vector<Color> GetCellColors() // Function that returns a vector containing colors for all block types in order. // Funktion, die einen Vektor mit Farben für alle Blocktypen in Reihenfolge zurückgibt.
 {
@@ -0,0 +1,310 @@
+/// Engine Class Implementation
+/// 
+/// Headless implementation of the Tetris rules from game.cpp and grid.cpp, operating on one compact, copyable state. // Headless Implementierung der Tetris-Regeln aus game.cpp und grid.cpp, die auf einem kompakten, kopierbaren Zustand arbeitet.
+/// Every method follows its Game/Grid counterpart step by step, including the order of spawn check, next block and line clear in LockBlock. // Jede Methode folgt ihrem Game/Grid-Gegenstück Schritt für Schritt, einschließlich der Reihenfolge von Spawn-Prüfung, nächstem Block und Linienräumung in LockBlock.
+/// 
+/// Usage:
+/// ```cpp
+/// Engine engine;
+/// engine.Reset(7);
+/// while (!engine.gameOver) {
+///     engine.MoveBlockDown();
+/// }
+/// ```
+/// 
+/// EN: Uses a seeded per-game random generator instead of rand(), so games are reproducible and safe to step from several threads.
+/// DE: Verwendet einen geseedeten Zufallsgenerator pro Spiel statt rand(), sodass Spiele reproduzierbar sind und sicher von mehreren Threads ausgeführt werden können.
+
+#include "engine.h" // Includes the Engine class header file with declarations. // Inkludiert die Engine-Klassen-Header-Datei mit Deklarationen.
+#include "zobrist.h" // Includes the Zobrist key tables for incremental hashing. // Inkludiert die Zobrist-Schlüsseltabellen für inkrementelles Hashen.
+#include <cstring> // Includes memset/memcpy for clearing and moving rows. // Inkludiert memset/memcpy zum Löschen und Bewegen von Reihen.
+
+Engine::Engine() // Constructor that starts a reproducible game with seed 0. // Konstruktor, der ein reproduzierbares Spiel mit Seed 0 startet.
+{
+    Reset(0); // Initializes all members through the regular reset path. // Initialisiert alle Mitglieder über den regulären Reset-Pfad.
+}
+
+void Engine::Reset(unsigned long long seed) // Resets the game like Game::Reset and reseeds the random generator. // Setzt das Spiel wie Game::Reset zurück und initialisiert den Zufallsgenerator neu.
+{
+    memset(cells, 0, sizeof(cells)); // Clears the grid like Grid::Initialize. // Räumt das Raster wie Grid::Initialize.
+    boardHash = 0; // An empty board hashes to 0. // Ein leeres Spielfeld hasht zu 0.
+    rngState = seed; // Seeds the random generator. // Initialisiert den Zufallsgenerator.
+    bag = 0x7F; // Refills the pool with all seven block types. // Füllt den Pool mit allen sieben Blocktypen.
+    currentBlock = GetRandomBlock(); // Selects the first block. // Wählt den ersten Block.
+    nextBlock = GetRandomBlock(); // Selects the preview block. // Wählt den Vorschaublock.
+    gameOver = false; // The new game is running. // Das neue Spiel läuft.
+    score = 0; // Resets the score. // Setzt die Punktzahl zurück.
+    lastRowsCleared = 0; // Nothing has been cleared yet. // Es wurde noch nichts geräumt.
+}
+
+unsigned long long SplitMix64(unsigned long long &state) // SplitMix64 step: fast, statistically good and only eight bytes of state. // SplitMix64-Schritt: schnell, statistisch gut und nur acht Bytes Zustand.
+{
+    unsigned long long z = (state += 0x9E3779B97F4A7C15ULL); // Advances the state by the golden-ratio increment. // Erhöht den Zustand um das Goldener-Schnitt-Inkrement.
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL; // First mixing step. // Erster Mischschritt.
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL; // Second mixing step. // Zweiter Mischschritt.
+    return z ^ (z >> 31); // Final avalanche. // Finale Durchmischung.
+}
+
+unsigned long long MixSeed(unsigned long long value) // One SplitMix64 step on a copy, so callers can mix any value without keeping a state. // Ein SplitMix64-Schritt auf einer Kopie, damit Aufrufer jeden Wert ohne eigenen Zustand mischen können.
+{
+    return SplitMix64(value); // value is a copy, the caller's variable stays unchanged. // value ist eine Kopie, die Variable des Aufrufers bleibt unverändert.
+}
+
+unsigned int Engine::NextRandom() // Advances the per-game generator. // Schaltet den Generator pro Spiel weiter.
+{
+    return (unsigned int)(SplitMix64(rngState) >> 32); // Returns the upper 32 mixed bits. // Gibt die oberen 32 gemischten Bits zurück.
+}
+
+PieceState Engine::GetRandomBlock() // Draws a block uniformly from the remaining pool, like Game::GetRandomBlock. // Zieht einen Block gleichverteilt aus dem verbleibenden Pool, wie Game::GetRandomBlock.
+{
+    if (bag == 0) // Checks if the pool is empty (all blocks used). // Prüft, ob der Pool leer ist (alle Blöcke verwendet).
+    {
+        bag = 0x7F; // Refills the pool with all seven block types. // Füllt den Pool mit allen sieben Blocktypen.
+    }
+    int remaining = 0; // Number of blocks left in the pool. // Anzahl der im Pool verbliebenen Blöcke.
+    for (int bit = 0; bit < 7; bit++) // Counts the set bits. // Zählt die gesetzten Bits.
+    {
+        remaining += (bag >> bit) & 1;
+    }
+    int pick = (int)(NextRandom() % (unsigned int)remaining); // Random index within the remaining blocks. // Zufälliger Index innerhalb der verbleibenden Blöcke.
+    int id = 0; // Block id that is drawn. // Gezogene Block-ID.
+    for (int bit = 0; bit < 7; bit++) // Finds the pick-th remaining block. // Findet den pick-ten verbleibenden Block.
+    {
+        if ((bag >> bit) & 1)
+        {
+            if (pick == 0)
+            {
+                id = bit + 1; // Bit index to block id. // Bit-Index zu Block-ID.
+                break;
+            }
+            pick--;
+        }
+    }
+    bag &= (unsigned char)~(1 << (id - 1)); // Removes the block from the pool to prevent duplicates. // Entfernt den Block aus dem Pool, um Duplikate zu verhindern.
+    PieceState piece; // The new block at its spawn position. // Der neue Block an seiner Spawn-Position.
+    piece.id = (unsigned char)id; // Stores the block id. // Speichert die Block-ID.
+    piece.rotation = 0; // New blocks start in rotation state 0. // Neue Blöcke starten im Rotationszustand 0.
+    piece.row = blockSpawn[id].row; // Spawn row offset from the block constructor. // Spawn-Reihen-Offset aus dem Block-Konstruktor.
+    piece.column = blockSpawn[id].column; // Spawn column offset from the block constructor. // Spawn-Spalten-Offset aus dem Block-Konstruktor.
+    return piece; // Returns the drawn block. // Gibt den gezogenen Block zurück.
+}
+
+bool Engine::BlockFits(const PieceState &piece) // Combines Game::IsBlockOutside and Game::BlockFits in one pass. // Kombiniert Game::IsBlockOutside und Game::BlockFits in einem Durchlauf.
+{
+    const ShapeCell *shape = blockShapes[piece.id][piece.rotation]; // Cell pattern of the current rotation. // Zellmuster der aktuellen Rotation.
+    for (int i = 0; i < 4; i++) // Checks all four cells. // Prüft alle vier Zellen.
+    {
+        int row = shape[i].row + piece.row; // Absolute row of the cell. // Absolute Reihe der Zelle.
+        int column = shape[i].column + piece.column; // Absolute column of the cell. // Absolute Spalte der Zelle.
+        if (row < 0 || row >= 20 || column < 0 || column >= 10 || cells[row][column] != 0) // Outside the grid or occupied. // Außerhalb des Rasters oder belegt.
+        {
+            return false; // The block does not fit. // Der Block passt nicht.
+        }
+    }
+    return true; // All cells are inside and empty. // Alle Zellen sind innerhalb und leer.
+}
+
+void Engine::MoveBlockLeft() // Moves the block left with collision checking. // Bewegt den Block mit Kollisionsprüfung nach links.
+{
+    if (!gameOver) // Only allows movement if game is not over. // Erlaubt Bewegung nur, wenn Spiel nicht vorbei ist.
+    {
+        currentBlock.column--; // Tries the move. // Versucht die Bewegung.
+        if (!BlockFits(currentBlock)) // Checks for collision or boundary violation. // Prüft auf Kollision oder Grenzverletzung.
+        {
+            currentBlock.column++; // Reverts the move. // Macht die Bewegung rückgängig.
+        }
+    }
+}
+
+void Engine::MoveBlockRight() // Moves the block right with collision checking. // Bewegt den Block mit Kollisionsprüfung nach rechts.
+{
+    if (!gameOver) // Only allows movement if game is not over. // Erlaubt Bewegung nur, wenn Spiel nicht vorbei ist.
+    {
+        currentBlock.column++; // Tries the move. // Versucht die Bewegung.
+        if (!BlockFits(currentBlock)) // Checks for collision or boundary violation. // Prüft auf Kollision oder Grenzverletzung.
+        {
+            currentBlock.column--; // Reverts the move. // Macht die Bewegung rückgängig.
+        }
+    }
+}
+
+void Engine::MoveBlockDown() // Moves the block down, locking it if it cannot move. // Bewegt den Block nach unten und sperrt ihn, wenn er sich nicht bewegen kann.
+{
+    lastRowsCleared = 0; // Only a lock in this call reports cleared rows. // Nur eine Sperrung in diesem Aufruf meldet geräumte Reihen.
+    if (!gameOver) // Only allows movement if game is not over. // Erlaubt Bewegung nur, wenn Spiel nicht vorbei ist.
+    {
+        currentBlock.row++; // Tries the move. // Versucht die Bewegung.
+        if (!BlockFits(currentBlock)) // Checks for collision or boundary violation. // Prüft auf Kollision oder Grenzverletzung.
+        {
+            currentBlock.row--; // Reverts to the last valid position. // Kehrt zur letzten gültigen Position zurück.
+            LockBlock(); // Locks the block and handles line clearing and game over. // Sperrt den Block und behandelt Linienräumung und Game Over.
+        }
+    }
+}
+
+int Engine::DropBlock() // Repeats MoveBlockDown until the block locks, without stepping the game in between. // Wiederholt MoveBlockDown, bis der Block sperrt, ohne das Spiel dazwischen weiterzuschalten.
+{
+    lastRowsCleared = 0; // Only a lock in this call reports cleared rows. // Nur eine Sperrung in diesem Aufruf meldet geräumte Reihen.
+    int rows = 0; // Rows the block fell. // Gefallene Reihen des Blocks.
+    if (!gameOver) // Only allows movement if game is not over. // Erlaubt Bewegung nur, wenn Spiel nicht vorbei ist.
+    {
+        currentBlock.row++; // Tries the first row. // Versucht die erste Reihe.
+        while (BlockFits(currentBlock)) // Falls while the block fits. // Fällt, solange der Block passt.
+        {
+            rows++;
+            currentBlock.row++;
+        }
+        currentBlock.row--; // Reverts to the last valid position. // Kehrt zur letzten gültigen Position zurück.
+        LockBlock(); // Locks the block like MoveBlockDown does. // Sperrt den Block wie MoveBlockDown.
+    }
+    return rows; // Returns the drop distance. // Gibt die Fallstrecke zurück.
+}
+
+void Engine::RotateBlock() // Rotates the block clockwise with collision checking. // Rotiert den Block im Uhrzeigersinn mit Kollisionsprüfung.
+{
+    if (!gameOver) // Only allows rotation if game is not over. // Erlaubt Rotation nur, wenn Spiel nicht vorbei ist.
+    {
+        unsigned char previous = currentBlock.rotation; // Remembers the rotation for UndoRotation. // Merkt sich die Rotation für UndoRotation.
+        currentBlock.rotation = (unsigned char)((previous + 1) % blockRotations[currentBlock.id]); // Next rotation state (circular). // Nächster Rotationszustand (zirkulär).
+        if (!BlockFits(currentBlock)) // Checks for collision or boundary violation. // Prüft auf Kollision oder Grenzverletzung.
+        {
+            currentBlock.rotation = previous; // Reverts the rotation. // Macht die Rotation rückgängig.
+        }
+    }
+}
+
+void Engine::LockBlock() // Locks the block in place, in the same order of steps as Game::LockBlock. // Sperrt den Block an Ort und Stelle, in derselben Schrittfolge wie Game::LockBlock.
+{
+    const ShapeCell *shape = blockShapes[currentBlock.id][currentBlock.rotation]; // Cell pattern of the block to lock. // Zellmuster des zu sperrenden Blocks.
+    lastLock = currentBlock; // Remembers the placement for recorders. // Merkt sich die Platzierung für Aufzeichner.
+    for (int i = 0; i < 4; i++) // Writes the block id into all four cells. // Schreibt die Block-ID in alle vier Zellen.
+    {
+        int row = shape[i].row + currentBlock.row; // Absolute row of the cell. // Absolute Reihe der Zelle.
+        int column = shape[i].column + currentBlock.column; // Absolute column of the cell. // Absolute Spalte der Zelle.
+        cells[row][column] = currentBlock.id; // Locks the cell (it was empty, so only the new key is added). // Sperrt die Zelle (sie war leer, daher wird nur der neue Schlüssel hinzugefügt).
+        boardHash ^= zobrist.cells[row][column][currentBlock.id]; // Updates the hash cell by cell. // Aktualisiert den Hash Zelle für Zelle.
+    }
+    currentBlock = nextBlock; // The next block becomes the falling block. // Der nächste Block wird zum fallenden Block.
+    if (!BlockFits(currentBlock)) // Checks if the new block fits at its spawn position. // Prüft, ob der neue Block an seiner Spawn-Position passt.
+    {
+        gameOver = true; // The grid is full. // Das Raster ist voll.
+    }
+    nextBlock = GetRandomBlock(); // Draws a new preview block. // Zieht einen neuen Vorschaublock.
+    lastRowsCleared = ClearFullRows(); // Clears completed rows. // Räumt vollständige Reihen.
+    if (lastRowsCleared > 0) // Checks if any rows were cleared. // Prüft, ob Reihen geräumt wurden.
+    {
+        UpdateScore(lastRowsCleared, 0); // Awards points for the cleared rows. // Vergibt Punkte für die geräumten Reihen.
+    }
+}
+
+int Engine::ClearFullRows() // Bottom-up line clearing like Grid::ClearFullRows. // Linienräumung von unten nach oben wie Grid::ClearFullRows.
+{
+    int completed = 0; // Number of rows cleared. // Anzahl geräumter Reihen.
+    for (int row = 19; row >= 0; row--) // Iterates from the bottom row to the top row. // Iteriert von der untersten zur obersten Reihe.
+    {
+        bool full = true; // Assumes the row is full until an empty cell is found. // Nimmt an, dass die Reihe voll ist, bis eine leere Zelle gefunden wird.
+        for (int column = 0; column < 10; column++) // Checks every cell of the row. // Prüft jede Zelle der Reihe.
+        {
+            if (cells[row][column] == 0)
+            {
+                full = false;
+                break;
+            }
+        }
+        if (full) // The row is complete. // Die Reihe ist vollständig.
+        {
+            for (int column = 0; column < 10; column++) // Removes the row's keys from the hash. // Entfernt die Schlüssel der Reihe aus dem Hash.
+            {
+                boardHash ^= zobrist.cells[row][column][cells[row][column]];
+            }
+            memset(cells[row], 0, sizeof(cells[row])); // Clears it like Grid::ClearRow. // Räumt sie wie Grid::ClearRow.
+            completed++; // Counts the cleared row. // Zählt die geräumte Reihe.
+        }
+        else if (completed > 0) // Rows below were cleared, so this row falls down. // Darunterliegende Reihen wurden geräumt, also fällt diese Reihe nach unten.
+        {
+            for (int column = 0; column < 10; column++) // Moves the row's keys to the target row (which is empty). // Verschiebt die Schlüssel der Reihe in die Zielreihe (die leer ist).
+            {
+                int value = cells[row][column];
+                boardHash ^= zobrist.cells[row][column][value] ^ zobrist.cells[row + completed][column][value];
+            }
+            memcpy(cells[row + completed], cells[row], sizeof(cells[row])); // Copies the row down like Grid::MoveRowDown. // Kopiert die Reihe nach unten wie Grid::MoveRowDown.
+            memset(cells[row], 0, sizeof(cells[row])); // Clears the original row. // Löscht die ursprüngliche Reihe.
+        }
+    }
+    return completed; // Returns the number of cleared rows. // Gibt die Anzahl geräumter Reihen zurück.
+}
+
+void Engine::UpdateScore(int linesCleared, int moveDownPoints) // Same point table as Game::UpdateScore. // Gleiche Punktetabelle wie Game::UpdateScore.
+{
+    switch (linesCleared) // Awards points based on rows cleared at once. // Vergibt Punkte basierend auf gleichzeitig geräumten Reihen.
+    {
+    case 1:
+        score += 100; // Single. // Single.
+        break;
+    case 2:
+        score += 300; // Double. // Double.
+        break;
+    case 3:
+        score += 500; // Triple. // Triple.
+        break;
+    default: // Like Game, four rows award no extra points here. // Wie bei Game vergeben vier Reihen hier keine Extrapunkte.
+        break;
+    }
+    score += moveDownPoints; // Adds soft-drop points. // Addiert Soft-Drop-Punkte.
+}
+
+unsigned long long Engine::GetHash() // Combines the incremental board hash with the falling block, next block and bag. // Kombiniert den inkrementellen Spielfeld-Hash mit fallendem Block, nächstem Block und Beutel.
+{
+    const ShapeCell *shape = blockShapes[currentBlock.id][currentBlock.rotation]; // Falling block pattern. // Muster des fallenden Blocks.
+    int rows[4]; // Rows covered by the falling block. // Vom fallenden Block bedeckte Reihen.
+    int columns[4]; // Columns covered by the falling block. // Vom fallenden Block bedeckte Spalten.
+    for (int i = 0; i < 4; i++) // Converts the pattern to absolute cells. // Wandelt das Muster in absolute Zellen um.
+    {
+        rows[i] = shape[i].row + currentBlock.row;
+        columns[i] = shape[i].column + currentBlock.column;
+    }
+    return boardHash ^ HashFallingBlock(currentBlock.id, rows, columns) ^ zobrist.nextId[nextBlock.id] ^ zobrist.bag[bag]; // Same combination as Game::GetHash. // Gleiche Kombination wie Game::GetHash.
+}
+
+unsigned char Engine::GetCheck() // FNV-1a over the raw state, unrelated to the Zobrist keys. // FNV-1a über den Rohzustand, unabhängig von den Zobrist-Schlüsseln.
+{
+    unsigned int check = 2166136261u; // FNV offset basis. // FNV-Offset-Basis.
+    const unsigned char *bytes = &cells[0][0]; // Walks the 200 cell bytes. // Durchläuft die 200 Zell-Bytes.
+    for (int i = 0; i < 200; i++)
+    {
+        check = (check ^ bytes[i]) * 16777619u; // FNV prime. // FNV-Primzahl.
+    }
+    const ShapeCell *shape = blockShapes[currentBlock.id][currentBlock.rotation]; // Falling block pattern. // Muster des fallenden Blocks.
+    unsigned int covered = 0; // Order-independent sum over covered cells, so rotations covering the same cells agree like in GetHash. // Reihenfolgeunabhängige Summe über bedeckte Zellen, damit Rotationen mit gleichen Zellen wie in GetHash übereinstimmen.
+    for (int i = 0; i < 4; i++)
+    {
+        unsigned int index = (unsigned int)((shape[i].row + currentBlock.row) * 10 + shape[i].column + currentBlock.column + 16); // Cell index, shifted to stay positive. // Zellindex, verschoben, um positiv zu bleiben.
+        covered += index * index * 2654435761u; // Spreads each index before summing. // Streut jeden Index vor dem Summieren.
+    }
+    unsigned int extra[4] = {currentBlock.id, covered, nextBlock.id, bag}; // Falling block, preview block and bag. // Fallender Block, Vorschaublock und Beutel.
+    for (int i = 0; i < 4; i++)
+    {
+        check = (check ^ extra[i]) * 16777619u;
+    }
+    return (unsigned char)(check ^ (check >> 8) ^ (check >> 16) ^ (check >> 24)); // Folds 32 bits into 8. // Faltet 32 Bits zu 8.
+}
+
+BoardSnapshot Engine::GetSnapshot() // Copies the visible state in the same form as Game::GetSnapshot. // Kopiert den sichtbaren Zustand in derselben Form wie Game::GetSnapshot.
+{
+    BoardSnapshot snapshot; // Structure that receives the copy. // Struktur, die die Kopie aufnimmt.
+    memcpy(snapshot.cells, cells, sizeof(cells)); // Copies the locked cells. // Kopiert die gesperrten Zellen.
+    const ShapeCell *current = blockShapes[currentBlock.id][currentBlock.rotation]; // Falling block pattern. // Muster des fallenden Blocks.
+    const ShapeCell *next = blockShapes[nextBlock.id][0]; // Preview block pattern (always rotation 0). // Muster des Vorschaublocks (immer Rotation 0).
+    for (int i = 0; i < 4; i++) // Converts both patterns to absolute cells. // Wandelt beide Muster in absolute Zellen um.
+    {
+        snapshot.currentRows[i] = current[i].row + currentBlock.row;
+        snapshot.currentColumns[i] = current[i].column + currentBlock.column;
+        snapshot.nextRows[i] = next[i].row + nextBlock.row;
+        snapshot.nextColumns[i] = next[i].column + nextBlock.column;
+    }
+    snapshot.currentId = currentBlock.id; // Falling block id. // ID des fallenden Blocks.
+    snapshot.nextId = nextBlock.id; // Preview block id. // ID des Vorschaublocks.
+    snapshot.score = score; // Current score. // Aktuelle Punktzahl.
+    snapshot.gameOver = gameOver; // Game-over flag. // Game-Over-Flagge.
+    return snapshot; // Returns the filled snapshot. // Gibt den gefüllten Schnappschuss zurück.
+}
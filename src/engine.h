@@ -0,0 +1,67 @@
+/// Engine Class Header
+/// 
+/// Header file declaring the Engine class, a headless copy of the Game rules for the C++ Tetris game. // Header-Datei, die die Engine-Klasse deklariert, eine headless Kopie der Game-Regeln für das C++ Tetris-Spiel.
+/// Implements MoveBlockLeft/Right/Down, RotateBlock, LockBlock and UpdateScore exactly like Game, but without raylib, audio or heap memory. // Implementiert MoveBlockLeft/Right/Down, RotateBlock, LockBlock und UpdateScore genau wie Game, aber ohne raylib, Audio oder Heap-Speicher.
+/// 
+/// Usage:
+/// ```cpp
+/// #include "engine.h"
+/// 
+/// Engine engine;
+/// engine.Reset(42);          // Seeded, reproducible game
+/// engine.MoveBlockLeft();
+/// engine.RotateBlock();
+/// engine.MoveBlockDown();    // Gravity step (locks the block when it lands)
+/// Engine copy = engine;      // Cloning is a plain copy
+/// ```
+/// 
+/// EN: A trivially copyable game state for simulations, training environments and servers that run many games at once.
+/// DE: Ein trivial kopierbarer Spielzustand für Simulationen, Trainingsumgebungen und Server, die viele Spiele gleichzeitig ausführen.
+
+#pragma once // Ensures this header file is included only once during compilation. // Stellt sicher, dass diese Header-Datei nur einmal während der Kompilierung eingebunden wird.
+#include "shapes.h" // Includes the raylib-free block shape tables. // Inkludiert die raylib-freien Blockform-Tabellen.
+#include "snapshot.h" // Includes the BoardSnapshot structure for rendering engine states. // Inkludiert die BoardSnapshot-Struktur zum Rendern von Engine-Zuständen.
+
+struct PieceState // Compact record of one block: id, rotation state and offset (replaces a Block object). // Kompakter Datensatz eines Blocks: ID, Rotationszustand und Offset (ersetzt ein Block-Objekt).
+{
+    unsigned char id; // Block id 1-7 (same ids as blocks.cpp). // Block-ID 1-7 (gleiche IDs wie blocks.cpp).
+    unsigned char rotation; // Current rotation state index. // Aktueller Rotationszustand-Index.
+    signed char row; // Row offset of the block (Block::rowOffset). // Reihen-Offset des Blocks (Block::rowOffset).
+    signed char column; // Column offset of the block (Block::columnOffset). // Spalten-Offset des Blocks (Block::columnOffset).
+};
+
+unsigned long long SplitMix64(unsigned long long &state); // Advances a SplitMix64 state and returns 64 mixed bits (the generator behind Engine, the Zobrist keys and all per-game seeds). // Schaltet einen SplitMix64-Zustand weiter und gibt 64 gemischte Bits zurück (der Generator hinter Engine, den Zobrist-Schlüsseln und allen Seeds pro Spiel).
+unsigned long long MixSeed(unsigned long long value); // Turns a counter or combined value into an unrelated seed (one SplitMix64 step on a copy). // Macht aus einem Zähler oder kombinierten Wert einen unabhängigen Seed (ein SplitMix64-Schritt auf einer Kopie).
+
+class Engine // Declares the headless Tetris rules engine. // Deklariert die headless Tetris-Regel-Engine.
+{
+public: // Public interface accessible from outside the class. // Öffentliche Schnittstelle, die von außerhalb der Klasse zugänglich ist.
+    Engine(); // Constructor that starts a game with seed 0. // Konstruktor, der ein Spiel mit Seed 0 startet.
+    void Reset(unsigned long long seed); // Starts a new game with the given random seed (mirrors Game::Reset). // Startet ein neues Spiel mit dem gegebenen Zufalls-Seed (entspricht Game::Reset).
+    void MoveBlockLeft(); // Moves the current block one column left if it fits. // Bewegt den aktuellen Block eine Spalte nach links, falls er passt.
+    void MoveBlockRight(); // Moves the current block one column right if it fits. // Bewegt den aktuellen Block eine Spalte nach rechts, falls er passt.
+    void MoveBlockDown(); // Moves the current block one row down or locks it. // Bewegt den aktuellen Block eine Reihe nach unten oder sperrt ihn.
+    int DropBlock(); // Moves the current block down until it locks; returns the rows it fell (used by planners). // Bewegt den aktuellen Block nach unten, bis er sperrt; gibt die gefallenen Reihen zurück (von Planern verwendet).
+    void RotateBlock(); // Rotates the current block if the rotation fits. // Rotiert den aktuellen Block, falls die Rotation passt.
+    void UpdateScore(int linesCleared, int moveDownPoints); // Adds points exactly like Game::UpdateScore. // Vergibt Punkte genau wie Game::UpdateScore.
+    bool BlockFits(const PieceState &piece); // Returns true if the piece is inside the grid and does not overlap locked cells. // Gibt wahr zurück, wenn das Stück im Raster liegt und keine gesperrten Zellen überlappt.
+    unsigned long long GetHash(); // Returns the Zobrist hash of board, falling block, next block and bag (same keys as Game::GetHash). // Gibt den Zobrist-Hash von Spielfeld, fallendem Block, nächstem Block und Beutel zurück (gleiche Schlüssel wie Game::GetHash).
+    unsigned char GetCheck(); // Returns an 8-bit checksum independent of the hash, used to detect real hash collisions. // Gibt eine vom Hash unabhängige 8-Bit-Prüfsumme zurück, um echte Hash-Kollisionen zu erkennen.
+    BoardSnapshot GetSnapshot(); // Copies the visible state for the software renderer. // Kopiert den sichtbaren Zustand für den Software-Renderer.
+    unsigned char cells[20][10]; // Locked cells (0 = empty, 1-7 = block id), one byte each. // Gesperrte Zellen (0 = leer, 1-7 = Block-ID), je ein Byte.
+    PieceState currentBlock; // The falling block. // Der fallende Block.
+    PieceState nextBlock; // The block shown in the preview. // Der in der Vorschau gezeigte Block.
+    unsigned long long boardHash; // Zobrist hash of the locked cells, updated cell by cell in LockBlock and row by row in ClearFullRows. // Zobrist-Hash der gesperrten Zellen, Zelle für Zelle in LockBlock und Reihe für Reihe in ClearFullRows aktualisiert.
+    unsigned char bag; // Bit mask of block ids still in the pool (bit id - 1), the Game::blocks vector as bits. // Bitmaske der Block-IDs, die noch im Pool sind (Bit ID - 1), der Game::blocks-Vektor als Bits.
+    bool gameOver; // True if the game has ended. // Wahr, wenn das Spiel beendet ist.
+    int score; // Current score points. // Aktuelle Punktzahl.
+    int lastRowsCleared; // Rows cleared by the most recent lock (0 if the last step did not lock). // Durch die letzte Sperrung geräumte Reihen (0, wenn der letzte Schritt nicht gesperrt hat).
+    PieceState lastLock; // The block as it was locked most recently (for replay recording; fills padding, so sizeof stays 240). // Der Block, wie er zuletzt gesperrt wurde (für die Replay-Aufzeichnung; füllt Auffüllbytes, daher bleibt sizeof 240).
+    unsigned long long rngState; // State of the per-game random generator (replaces the global rand()). // Zustand des Zufallsgenerators pro Spiel (ersetzt das globale rand()).
+
+private: // Private members accessible only within the class. // Private Mitglieder, die nur innerhalb der Klasse zugänglich sind.
+    PieceState GetRandomBlock(); // Draws a random block from the bag, refilling it when empty (mirrors Game::GetRandomBlock). // Zieht einen zufälligen Block aus dem Beutel und füllt ihn nach, wenn leer (entspricht Game::GetRandomBlock).
+    void LockBlock(); // Locks the current block, spawns the next one and clears rows (mirrors Game::LockBlock). // Sperrt den aktuellen Block, erzeugt den nächsten und räumt Reihen (entspricht Game::LockBlock).
+    int ClearFullRows(); // Clears full rows and moves the rows above down (mirrors Grid::ClearFullRows). // Räumt volle Reihen und bewegt die Reihen darüber nach unten (entspricht Grid::ClearFullRows).
+    unsigned int NextRandom(); // Advances the random generator and returns 32 random bits. // Schaltet den Zufallsgenerator weiter und gibt 32 Zufallsbits zurück.
+};
@@ -1,7 +1,7 @@
 /// Game Class Implementation
 /// 
 /// Core game logic implementation for the C++ Tetris game using raylib graphics and audio library. // Kern-Spiellogik-Implementierung für das C++ Tetris-Spiel mit raylib-Grafik- und Audio-Bibliothek.
-/// Manages game state, block movement, collision detection, scoring, and audio playback. // Verwaltet Spielzustand, Blockbewegung, Kollisionserkennung, Punktevergabe und Audio-Wiedergabe.
+/// Manages game state, block movement, collision detection, scoring, and posts sound events to the audio thread. // Verwaltet Spielzustand, Blockbewegung, Kollisionserkennung, Punktevergabe und stellt Sound-Ereignisse an den Audio-Thread.
 /// 
 /// Usage:
 /// ```cpp
@@ -21,7 +21,9 @@
 /// DE: Implementiert vollständige Tetris-Spielmechanik einschließlich Blockgenerierung, Bewegung, Linienräumung und Game-Over-Erkennung.
 
 #include "game.h" // Includes the Game class header file with method declarations. // Inkludiert die Game-Klassen-Header-Datei mit Methodendeklarationen.
+#include "zobrist.h" // Includes the Zobrist key tables for position hashing. // Inkludiert die Zobrist-Schlüsseltabellen für das Hashen von Stellungen.
 #include <random> // Includes random number generation utilities for block selection. // Inkludiert Zufallszahlengenerierungs-Hilfsfunktionen für Blockauswahl.
+#include <ctime> // Includes time for the high-score timestamp. // Inkludiert time für den Zeitstempel des Highscores.
 
 Game::Game() // Constructor that initializes a new Tetris game instance. // Konstruktor, der eine neue Tetris-Spielinstanz initialisiert.
 {
@@ -31,19 +33,18 @@ Game::Game() // Constructor that initializes a new Tetris game instance. // Kons
     nextBlock = GetRandomBlock(); // Selects and removes another random block for the next piece preview. // Wählt und entfernt einen weiteren zufälligen Block für die nächste Blockvorschau.
     gameOver = false; // Initializes game state as active (not game over). // Initialisiert Spielzustand als aktiv (kein Game Over).
     score = 0; // Initializes player score to zero points. // Initialisiert Spielerpunktzahl auf null Punkte.
-    InitAudioDevice(); // Initializes raylib audio system for music and sound effects. // Initialisiert raylib-Audiosystem für Musik und Soundeffekte.
-    music = LoadMusicStream("Sounds/music.mp3"); // Loads background music file from disk into memory. // Lädt Hintergrundmusik-Datei von der Festplatte in den Speicher.
-    PlayMusicStream(music); // Starts playing the background music in a loop. // Startet die Wiedergabe der Hintergrundmusik in einer Schleife.
-    rotateSound = LoadSound("Sounds/rotate.mp3"); // Loads rotation sound effect for block rotations. // Lädt Rotationsgeräusch für Blockrotationen.
-    clearSound = LoadSound("Sounds/clear.mp3"); // Loads line-clear sound effect for completed rows. // Lädt Linienräumungsgeräusch für abgeschlossene Reihen.
+    revision = 0; // Initializes the visible state revision counter. // Initialisiert den Zähler der sichtbaren Zustandsrevision.
+    audio = nullptr; // Silent until main() attaches an AudioSystem. // Stumm, bis main() ein AudioSystem anhängt.
+    recorder = nullptr; // Not recorded unless main() attaches a ReplayWriter. // Keine Aufzeichnung, außer main() hängt einen ReplayWriter an.
+    scores = nullptr; // No leaderboard unless main() attaches a ScoreStore. // Keine Bestenliste, außer main() hängt einen ScoreStore an.
+    playerTag = "PLAYER"; // Default tag until main() sets one. // Standardkennung, bis main() eine setzt.
+    particles = nullptr; // No effects until main() calls SetParticles. // Keine Effekte, bis main() SetParticles aufruft.
 }
 
-Game::~Game() // Destructor that cleans up resources when Game object is destroyed. // Destruktor, der Ressourcen bereinigt, wenn das Game-Objekt zerstört wird.
+void Game::SetParticles(ParticleSystem *particles) // Attaches the effects pool to the game and to the grid, which emits the line-clear bursts. // Hängt den Effekt-Pool an das Spiel und an das Raster, das die Linienräumungs-Ausbrüche emittiert.
 {
-    UnloadSound(rotateSound); // Frees memory used by rotation sound effect. // Gibt Speicher frei, der von Rotationsgeräusch verwendet wurde.
-    UnloadSound(clearSound); // Frees memory used by line-clear sound effect. // Gibt Speicher frei, der von Linienräumungsgeräusch verwendet wurde.
-    UnloadMusicStream(music); // Frees memory used by background music stream. // Gibt Speicher frei, der von Hintergrundmusik-Stream verwendet wurde.
-    CloseAudioDevice(); // Shuts down raylib audio system and releases audio resources. // Schließt raylib-Audiosystem und gibt Audio-Ressourcen frei.
+    this->particles = particles;
+    grid.particles = particles;
 }
 
 Block Game::GetRandomBlock() // Returns a random block from the available pool, refilling when empty. // Gibt einen zufälligen Block aus dem verfügbaren Pool zurück, füllt nach, wenn leer.
@@ -116,6 +117,10 @@ void Game::MoveBlockLeft() // Moves the current block one column to the left wit
         {
             currentBlock.Move(0, 1); // Reverts the move by moving block back to original position. // Macht Bewegung rückgängig, indem Block zur ursprünglichen Position zurückbewegt wird.
         }
+        else // Move was valid and the block is now drawn at a new position. // Bewegung war gültig und der Block wird jetzt an neuer Position gezeichnet.
+        {
+            revision++; // Marks the visible state as changed. // Markiert den sichtbaren Zustand als geändert.
+        }
     }
 }
 
@@ -128,6 +133,10 @@ void Game::MoveBlockRight() // Moves the current block one column to the right w
         {
             currentBlock.Move(0, -1); // Reverts the move by moving block back to original position. // Macht Bewegung rückgängig, indem Block zur ursprünglichen Position zurückbewegt wird.
         }
+        else // Move was valid and the block is now drawn at a new position. // Bewegung war gültig und der Block wird jetzt an neuer Position gezeichnet.
+        {
+            revision++; // Marks the visible state as changed. // Markiert den sichtbaren Zustand als geändert.
+        }
     }
 }
 
@@ -141,7 +150,52 @@ void Game::MoveBlockDown() // Moves the current block one row down or locks it i
             currentBlock.Move(-1, 0); // Reverts downward movement to previous valid position. // Macht Abwärtsbewegung zur vorherigen gültigen Position rückgängig.
             LockBlock(); // Locks the block in place and handles line clearing and game over detection. // Sperrt den Block an Ort und Stelle und behandelt Linienräumung und Game-Over-Erkennung.
         }
+        revision++; // Both moving and locking change what is on screen. // Sowohl Bewegen als auch Sperren ändern, was auf dem Bildschirm ist.
+    }
+}
+
+unsigned long long Game::GetHash() // Combines the incremental grid hash with the falling block, next block and bag. // Kombiniert den inkrementellen Raster-Hash mit fallendem Block, nächstem Block und Beutel.
+{
+    std::vector<Position> tiles = currentBlock.GetCellPositions(); // Gets the cells covered by the falling block. // Holt die vom fallenden Block bedeckten Zellen.
+    int rows[4]; // Rows of the covered cells. // Reihen der bedeckten Zellen.
+    int columns[4]; // Columns of the covered cells. // Spalten der bedeckten Zellen.
+    for (int i = 0; i < 4; i++) // Copies the four cells. // Kopiert die vier Zellen.
+    {
+        rows[i] = tiles[i].row;
+        columns[i] = tiles[i].column;
+    }
+    int bag = 0; // Bit mask of the blocks still in the pool. // Bitmaske der Blöcke, die noch im Pool sind.
+    for (Block &block : blocks) // Sets one bit per remaining block id. // Setzt ein Bit pro verbleibender Block-ID.
+    {
+        bag |= 1 << (block.id - 1);
+    }
+    return grid.hash ^ HashFallingBlock(currentBlock.id, rows, columns) ^ zobrist.nextId[nextBlock.id] ^ zobrist.bag[bag]; // Same combination as Engine::GetHash. // Gleiche Kombination wie Engine::GetHash.
+}
+
+BoardSnapshot Game::GetSnapshot() // Copies everything Draw() shows into a raylib-free snapshot. // Kopiert alles, was Draw() anzeigt, in einen raylib-freien Schnappschuss.
+{
+    BoardSnapshot snapshot; // Structure that receives the copy. // Struktur, die die Kopie aufnimmt.
+    for (int row = 0; row < 20; row++) // Iterates through each grid row. // Iteriert durch jede Rasterreihe.
+    {
+        for (int column = 0; column < 10; column++) // Iterates through each grid column. // Iteriert durch jede Rasterspalte.
+        {
+            snapshot.cells[row][column] = (unsigned char)grid.grid[row][column]; // Copies the cell value (0-7 fits in a byte). // Kopiert den Zellwert (0-7 passt in ein Byte).
+        }
+    }
+    std::vector<Position> current = currentBlock.GetCellPositions(); // Gets the falling block's cells on the grid. // Holt die Zellen des fallenden Blocks auf dem Raster.
+    std::vector<Position> next = nextBlock.GetCellPositions(); // Gets the next block's cells at its spawn position. // Holt die Zellen des nächsten Blocks an seiner Spawn-Position.
+    for (int i = 0; i < 4; i++) // Every Tetris block consists of four cells. // Jeder Tetris-Block besteht aus vier Zellen.
+    {
+        snapshot.currentRows[i] = current[i].row; // Copies the falling block's cell row. // Kopiert die Zellreihe des fallenden Blocks.
+        snapshot.currentColumns[i] = current[i].column; // Copies the falling block's cell column. // Kopiert die Zellspalte des fallenden Blocks.
+        snapshot.nextRows[i] = next[i].row; // Copies the next block's cell row. // Kopiert die Zellreihe des nächsten Blocks.
+        snapshot.nextColumns[i] = next[i].column; // Copies the next block's cell column. // Kopiert die Zellspalte des nächsten Blocks.
     }
+    snapshot.currentId = currentBlock.id; // Copies the falling block's id (selects its color). // Kopiert die ID des fallenden Blocks (wählt seine Farbe).
+    snapshot.nextId = nextBlock.id; // Copies the next block's id (selects color and preview offset). // Kopiert die ID des nächsten Blocks (wählt Farbe und Vorschau-Offset).
+    snapshot.score = score; // Copies the score. // Kopiert die Punktzahl.
+    snapshot.gameOver = gameOver; // Copies the game-over flag. // Kopiert die Game-Over-Flagge.
+    return snapshot; // Returns the filled snapshot. // Gibt den gefüllten Schnappschuss zurück.
 }
 
 bool Game::IsBlockOutside() // Checks if any part of the current block is outside the game grid boundaries. // Prüft, ob irgendein Teil des aktuellen Blocks außerhalb der Spielfeld-Grenzen ist.
@@ -168,7 +222,11 @@ void Game::RotateBlock() // Rotates the current block clockwise with collision a
         }
         else // Rotation was successful and valid. // Rotation war erfolgreich und gültig.
         {
-            PlaySound(rotateSound); // Plays rotation sound effect to provide audio feedback. // Spielt Rotationsgeräusch ab, um Audio-Feedback zu geben.
+            if (audio != nullptr) // Posts the rotation sound to the audio thread; overlapping rotations get separate voices. // Stellt das Rotationsgeräusch an den Audio-Thread; überlappende Rotationen erhalten eigene Stimmen.
+            {
+                audio->Post(SoundRotate);
+            }
+            revision++; // Marks the visible state as changed. // Markiert den sichtbaren Zustand als geändert.
         }
     }
 }
@@ -176,9 +234,17 @@ void Game::RotateBlock() // Rotates the current block clockwise with collision a
 void Game::LockBlock() // Locks the current block in place and handles game progression logic. // Sperrt den aktuellen Block an Ort und Stelle und behandelt Spielfortschrittslogik.
 {
     std::vector<Position> tiles = currentBlock.GetCellPositions(); // Gets all cell positions of the block to be locked. // Holt alle Zellpositionen des zu sperrenden Blocks.
+    int lockedId = currentBlock.id; // Keeps the placement for the replay record (currentBlock is replaced below). // Behält die Platzierung für den Replay-Datensatz (currentBlock wird unten ersetzt).
+    int lockedRotation = currentBlock.GetRotation();
+    int lockedRow = currentBlock.GetRowOffset();
+    int lockedColumn = currentBlock.GetColumnOffset();
     for (Position item : tiles) // Iterates through each cell position in the block. // Iteriert durch jede Zellposition im Block.
     {
-        grid.grid[item.row][item.column] = currentBlock.id; // Places block's ID in grid at each cell position. // Platziert Block-ID im Raster an jeder Zellposition.
+        grid.SetCell(item.row, item.column, currentBlock.id); // Places block's ID in grid at each cell position and updates the grid hash. // Platziert Block-ID im Raster an jeder Zellposition und aktualisiert den Raster-Hash.
+        if (particles != nullptr) // Puffs landing dust under each tile. // Wirbelt Landestaub unter jeder Kachel auf.
+        {
+            particles->EmitLanding(item.row, item.column, currentBlock.id);
+        }
     }
     currentBlock = nextBlock; // Makes the next block become the current falling block. // Macht den nächsten Block zum aktuell fallenden Block.
     if (BlockFits() == false) // Checks if new current block fits at spawn position. // Prüft, ob neuer aktueller Block an Spawn-Position passt.
@@ -189,9 +255,24 @@ void Game::LockBlock() // Locks the current block in place and handles game prog
     int rowsCleared = grid.ClearFullRows(); // Attempts to clear any completed rows and returns count. // Versucht, vollständige Reihen zu räumen und gibt Anzahl zurück.
     if (rowsCleared > 0) // Checks if any rows were successfully cleared. // Prüft, ob irgendwelche Reihen erfolgreich geräumt wurden.
     {
-        PlaySound(clearSound); // Plays line-clear sound effect for audio feedback. // Spielt Linienräumungsgeräusch für Audio-Feedback ab.
+        if (audio != nullptr) // Posts the line-clear sound to the audio thread. // Stellt das Linienräumungsgeräusch an den Audio-Thread.
+        {
+            audio->Post(SoundClear);
+        }
         UpdateScore(rowsCleared, 0); // Updates score based on number of rows cleared. // Aktualisiert Punktzahl basierend auf Anzahl geräumter Reihen.
     }
+    if (recorder != nullptr) // Records the lock after UpdateScore, so the score delta includes the clear. // Zeichnet die Sperrung nach UpdateScore auf, damit die Punktdifferenz die Räumung enthält.
+    {
+        recorder->RecordLock(lockedId, lockedRotation, lockedRow, lockedColumn, rowsCleared, score);
+        if (gameOver) // The new block could not spawn: the game topped out. // Der neue Block konnte nicht erscheinen: das Spiel lief über.
+        {
+            recorder->EndGame(score, currentBlock.id);
+        }
+    }
+    if (scores != nullptr && gameOver) // Hands the final score to the store's thread before Reset() wipes it. // Übergibt die Endpunktzahl an den Thread des Stores, bevor Reset() sie löscht.
+    {
+        scores->Submit(playerTag.c_str(), score, (long long)time(nullptr));
+    }
 }
 
 bool Game::BlockFits() // Checks if the current block can fit at its current position without collision. // Prüft, ob der aktuelle Block an seiner aktuellen Position ohne Kollision passen kann.
@@ -214,6 +295,7 @@ void Game::Reset() // Resets all game elements to initial state for starting a n
     currentBlock = GetRandomBlock(); // Selects new random block for current play. // Wählt neuen zufälligen Block für aktuelles Spiel.
     nextBlock = GetRandomBlock(); // Selects new random block for next piece preview. // Wählt neuen zufälligen Block für nächste Blockvorschau.
     score = 0; // Resets player score back to zero points. // Setzt Spielerpunktzahl auf null Punkte zurück.
+    revision++; // Marks the whole screen as changed. // Markiert den gesamten Bildschirm als geändert.
 }
 
 void Game::UpdateScore(int linesCleared, int moveDownPoints) // Updates the player's score based on lines cleared and manual movements. // Aktualisiert die Spielerpunktzahl basierend auf geräumten Linien und manuellen Bewegungen.
@@ -234,4 +316,5 @@ void Game::UpdateScore(int linesCleared, int moveDownPoints) // Updates the play
     }
 
     score += moveDownPoints; // Adds points for manual downward block movements (soft drop). // Fügt Punkte für manuelle Abwärtsblockbewegungen hinzu (Soft Drop).
+    revision++; // The score display may have changed. // Die Punkteanzeige kann sich geändert haben.
 }
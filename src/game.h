@@ -21,19 +21,30 @@
 
 #pragma once // Ensures this header file is included only once during compilation to prevent duplicate definitions. // Stellt sicher, dass diese Header-Datei nur einmal während der Kompilierung eingebunden wird, um doppelte Definitionen zu verhindern.
 #include "grid.h" // Includes the Grid class header for the game playing field (20x10 Tetris grid). // Inkludiert die Grid-Klassen-Header für das Spielfeld (20x10 Tetris-Raster).
+#include "audio.h" // Includes the AudioSystem that plays sound events on its own thread. // Inkludiert das AudioSystem, das Sound-Ereignisse auf einem eigenen Thread abspielt.
+#include "replay.h" // Includes the ReplayWriter that records every lock for the analytics corpus. // Inkludiert den ReplayWriter, der jede Sperrung für den Analyse-Korpus aufzeichnet.
+#include "scores.h" // Includes the ScoreStore that keeps the local leaderboards. // Inkludiert den ScoreStore, der die lokalen Bestenlisten führt.
+#include "particles.h" // Includes the ParticleSystem that receives landing and line-clear effects. // Inkludiert das ParticleSystem, das Lande- und Linienräumungseffekte empfängt.
+#include "snapshot.h" // Includes the raylib-free BoardSnapshot structure used by headless renderers and tools. // Inkludiert die raylib-freie BoardSnapshot-Struktur, die von headless Renderern und Werkzeugen verwendet wird.
 #include "blocks.cpp" // Includes all Tetris block class implementations (I, J, L, O, S, T, Z blocks). // Inkludiert alle Tetris-Block-Klassen-Implementierungen (I, J, L, O, S, T, Z-Blöcke).
 
 class Game // Declares the Game class that serves as the main controller for Tetris gameplay. // Deklariert die Game-Klasse, die als Hauptcontroller für Tetris-Gameplay dient.
 {
 public: // Public interface accessible from outside the class for external game control. // Öffentliche Schnittstelle, die von außerhalb der Klasse für externe Spielsteuerung zugänglich ist.
     Game(); // Constructor declaration that initializes a new Tetris game instance. // Konstruktor-Deklaration, die eine neue Tetris-Spielinstanz initialisiert.
-    ~Game(); // Destructor declaration that cleans up resources when game object is destroyed. // Destruktor-Deklaration, die Ressourcen bereinigt, wenn das Spielobjekt zerstört wird.
     void Draw(); // Method declaration for rendering all game elements to the screen. // Methoden-Deklaration zum Rendern aller Spielelemente auf den Bildschirm.
     void HandleInput(); // Method declaration for processing keyboard input and executing game actions. // Methoden-Deklaration zur Verarbeitung von Tastatureingaben und Ausführung von Spielaktionen.
     void MoveBlockDown(); // Method declaration for moving the current block down one row (automatic or manual). // Methoden-Deklaration zum Bewegen des aktuellen Blocks eine Reihe nach unten (automatisch oder manuell).
+    unsigned long long GetHash(); // Method declaration that returns the Zobrist hash of grid, falling block, next block and bag. // Methoden-Deklaration, die den Zobrist-Hash von Raster, fallendem Block, nächstem Block und Beutel zurückgibt.
+    void SetParticles(ParticleSystem *particles); // Method declaration that attaches an effects pool to the game and its grid (nullptr = no effects). // Methoden-Deklaration, die einen Effekt-Pool an das Spiel und sein Raster anhängt (nullptr = keine Effekte).
+    BoardSnapshot GetSnapshot(); // Method declaration that copies the visible state into a plain structure for the software renderer. // Methoden-Deklaration, die den sichtbaren Zustand für den Software-Renderer in eine einfache Struktur kopiert.
     bool gameOver; // Public boolean flag indicating whether the game has ended (true = game over). // Öffentliche boolesche Flagge, die anzeigt, ob das Spiel beendet ist (true = Game Over).
     int score; // Public integer storing the player's current score points. // Öffentliche Ganzzahl, die die aktuellen Punkte des Spielers speichert.
-    Music music; // Public Music object for background music stream (raylib audio type). // Öffentliches Music-Objekt für Hintergrundmusik-Stream (raylib-Audio-Typ).
+    unsigned int revision; // Public counter incremented on every visible state change (used to skip redundant redraws). // Öffentlicher Zähler, der bei jeder sichtbaren Zustandsänderung erhöht wird (zum Überspringen überflüssiger Neuzeichnungen).
+    ScoreStore *scores; // Public pointer to the high-score store that receives every finished game (nullptr = not kept). // Öffentlicher Zeiger auf den Highscore-Store, der jedes beendete Spiel empfängt (nullptr = nicht behalten).
+    std::string playerTag; // Public player tag stored with each finished game. // Öffentliche Spielerkennung, die mit jedem beendeten Spiel gespeichert wird.
+    ReplayWriter *recorder; // Public pointer to the replay file that receives every lock and finished game (nullptr = not recorded). // Öffentlicher Zeiger auf die Replay-Datei, die jede Sperrung und jedes beendete Spiel empfängt (nullptr = keine Aufzeichnung).
+    AudioSystem *audio; // Public pointer to the audio thread that receives sound events (nullptr = silent). // Öffentlicher Zeiger auf den Audio-Thread, der Sound-Ereignisse empfängt (nullptr = stumm).
 
 private: // Private members accessible only within the Game class for internal game logic. // Private Mitglieder, die nur innerhalb der Game-Klasse für interne Spiellogik zugänglich sind.
     void MoveBlockLeft(); // Private method declaration for moving current block one column to the left. // Private Methoden-Deklaration zum Bewegen des aktuellen Blocks eine Spalte nach links.
@@ -50,6 +61,5 @@ private: // Private members accessible only within the Game class for internal g
     std::vector<Block> blocks; // Private vector containing the pool of available blocks for fair distribution. // Privater Vektor mit dem Pool verfügbarer Blöcke für faire Verteilung.
     Block currentBlock; // Private Block object representing the currently falling Tetris piece. // Privates Block-Objekt, das das aktuell fallende Tetris-Stück repräsentiert.
     Block nextBlock; // Private Block object representing the next piece shown in the preview area. // Privates Block-Objekt, das das nächste Stück im Vorschaubereich repräsentiert.
-    Sound rotateSound; // Private Sound object for rotation sound effect (raylib audio type). // Privates Sound-Objekt für Rotationsgeräusch-Effekt (raylib-Audio-Typ).
-    Sound clearSound; // Private Sound object for line-clear sound effect (raylib audio type). // Privates Sound-Objekt für Linienräumungsgeräusch-Effekt (raylib-Audio-Typ).
+    ParticleSystem *particles; // Private pointer to the effects pool that LockBlock emits landing dust into (nullptr = no effects). // Privater Zeiger auf den Effekt-Pool, in den LockBlock Landestaub emittiert (nullptr = keine Effekte).
 };
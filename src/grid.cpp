@@ -24,6 +24,8 @@
 #include "grid.h" // Includes the Grid class header file with method declarations and member variables. // Inkludiert die Grid-Klassen-Header-Datei mit Methodendeklarationen und Mitgliedsvariablen.
 #include <iostream> // Includes input/output stream library for console debugging output. // Inkludiert Eingabe-/Ausgabe-Stream-Bibliothek für Konsolen-Debug-Ausgabe.
 #include "colors.h" // Includes color definitions and utilities for grid cell rendering. // Inkludiert Farbdefinitionen und Hilfsfunktionen für Rasterzellen-Rendering.
+#include "zobrist.h" // Includes the Zobrist key tables for incremental hashing. // Inkludiert die Zobrist-Schlüsseltabellen für inkrementelles Hashen.
+#include "particles.h" // Includes the ParticleSystem that receives line-clear bursts. // Inkludiert das ParticleSystem, das Linienräumungs-Ausbrüche empfängt.
 
 Grid::Grid() // Constructor that initializes a new Grid instance with standard Tetris dimensions. // Konstruktor, der eine neue Grid-Instanz mit Standard-Tetris-Dimensionen initialisiert.
 {
@@ -32,6 +34,7 @@ Grid::Grid() // Constructor that initializes a new Grid instance with standard T
     cellSize = 30; // Sets each cell size to 30 pixels for rendering (30x30 pixel squares). // Setzt jede Zellgröße auf 30 Pixel für Rendering (30x30 Pixel-Quadrate).
     Initialize(); // Calls initialization method to clear all grid cells to empty state. // Ruft Initialisierungsmethode auf, um alle Rasterzellen auf leeren Zustand zu löschen.
     colors = GetCellColors(); // Retrieves color palette for rendering different block types and empty cells. // Ruft Farbpalette zum Rendern verschiedener Blocktypen und leerer Zellen ab.
+    particles = nullptr; // No effects until Game::SetParticles attaches a pool. // Keine Effekte, bis Game::SetParticles einen Pool anhängt.
 }
 
 void Grid::Initialize() // Clears the entire grid by setting all cells to empty state (value 0). // Löscht das gesamte Raster durch Setzen aller Zellen auf leeren Zustand (Wert 0).
@@ -43,6 +46,14 @@ void Grid::Initialize() // Clears the entire grid by setting all cells to empty
             grid[row][column] = 0; // Sets cell to 0 (empty state, no block occupies this position). // Setzt Zelle auf 0 (leerer Zustand, kein Block belegt diese Position).
         }
     }
+    hash = 0; // An empty grid hashes to 0 (empty cells have no key). // Ein leeres Raster hasht zu 0 (leere Zellen haben keinen Schlüssel).
+}
+
+void Grid::SetCell(int row, int column, int value) // Writes one cell and updates the hash by removing the old key and adding the new one. // Schreibt eine Zelle und aktualisiert den Hash, indem der alte Schlüssel entfernt und der neue hinzugefügt wird.
+{
+    hash ^= zobrist.cells[row][column][grid[row][column]]; // Removes the key of the previous value (XOR undoes itself). // Entfernt den Schlüssel des vorherigen Werts (XOR hebt sich selbst auf).
+    grid[row][column] = value; // Stores the new value. // Speichert den neuen Wert.
+    hash ^= zobrist.cells[row][column][value]; // Adds the key of the new value. // Fügt den Schlüssel des neuen Werts hinzu.
 }
 
 void Grid::Print() // Prints the grid state to console for debugging purposes (development tool). // Gibt den Rasterzustand zur Konsole für Debug-Zwecke aus (Entwicklungswerkzeug).
@@ -98,6 +109,10 @@ int Grid::ClearFullRows() // Main line-clearing algorithm that removes completed
     {
         if (IsRowFull(row)) // Checks if current row is completely filled with blocks. // Prüft, ob aktuelle Reihe vollständig mit Blöcken gefüllt ist.
         {
+            if (particles != nullptr) // Bursts the row's cells before they are erased; the row is still at its on-screen position. // Lässt die Zellen der Reihe zerplatzen, bevor sie gelöscht werden; die Reihe ist noch an ihrer Bildschirmposition.
+            {
+                particles->EmitRowClear(row, grid[row]);
+            }
             ClearRow(row); // Removes all blocks from the completed row (sets all cells to 0). // Entfernt alle Blöcke aus der vollständigen Reihe (setzt alle Zellen auf 0).
             completed++; // Increments counter of cleared rows for scoring and sound effects. // Erhöht Zähler geräumter Reihen für Punktevergabe und Soundeffekte.
         }
@@ -125,6 +140,7 @@ void Grid::ClearRow(int row) // Clears all blocks from specified row by setting
 {
     for (int column = 0; column < numCols; column++) // Iterates through all columns in the specified row. // Iteriert durch alle Spalten in der angegebenen Reihe.
     {
+        hash ^= zobrist.cells[row][column][grid[row][column]]; // Removes the cell's key from the hash. // Entfernt den Schlüssel der Zelle aus dem Hash.
         grid[row][column] = 0; // Sets each cell to 0 (empty state, removing any block that was there). // Setzt jede Zelle auf 0 (leerer Zustand, entfernt jeden Block, der dort war).
     }
 }
@@ -133,7 +149,9 @@ void Grid::MoveRowDown(int row, int numRows) // Moves specified row downward by
 {
     for (int column = 0; column < numCols; column++) // Iterates through all columns in the row to be moved. // Iteriert durch alle Spalten in der zu bewegenden Reihe.
     {
-        grid[row + numRows][column] = grid[row][column]; // Copies cell content to new position below (row + numRows). // Kopiert Zellinhalt zur neuen Position darunter (Reihe + numRows).
+        int value = grid[row][column]; // Block id that moves down (the target cell is always empty at this point). // Block-ID, die nach unten wandert (die Zielzelle ist an dieser Stelle immer leer).
+        hash ^= zobrist.cells[row][column][value] ^ zobrist.cells[row + numRows][column][value]; // Moves the cell's key from the old row to the new row. // Verschiebt den Schlüssel der Zelle von der alten zur neuen Reihe.
+        grid[row + numRows][column] = value; // Copies cell content to new position below (row + numRows). // Kopiert Zellinhalt zur neuen Position darunter (Reihe + numRows).
         grid[row][column] = 0; // Clears original cell position after copying content down. // Löscht ursprüngliche Zellposition nach dem Kopieren des Inhalts nach unten.
     }
 }
@@ -30,6 +30,8 @@
 #include <vector> // Includes standard vector container for dynamic color array storage. // Inkludiert Standard-Vektor-Container für dynamische Farb-Array-Speicherung.
 #include <raylib.h> // Includes raylib graphics library for Color type and drawing functions. // Inkludiert raylib-Grafikbibliothek für Color-Typ und Zeichenfunktionen.
 
+class ParticleSystem; // Forward declaration; only a pointer is stored here. // Vorwärtsdeklaration; hier wird nur ein Zeiger gespeichert.
+
 class Grid // Declares the Grid class that represents the Tetris playing field and manages all grid operations. // Deklariert die Grid-Klasse, die das Tetris-Spielfeld repräsentiert und alle Raster-Operationen verwaltet.
 {
 public: // Public interface accessible from outside the class for external grid operations. // Öffentliche Schnittstelle, die von außerhalb der Klasse für externe Raster-Operationen zugänglich ist.
@@ -40,8 +42,12 @@ public: // Public interface accessible from outside the class for external grid
     bool IsCellOutside(int row, int column); // Method declaration that checks if given coordinates are outside valid grid boundaries. // Methoden-Deklaration, die prüft, ob gegebene Koordinaten außerhalb gültiger Rastergrenzen sind.
     bool IsCellEmpty(int row, int column); // Method declaration that checks if specified cell is empty and available for block placement. // Methoden-Deklaration, die prüft, ob angegebene Zelle leer und für Blockplatzierung verfügbar ist.
     int ClearFullRows(); // Method declaration for the main line-clearing algorithm that returns number of rows cleared. // Methoden-Deklaration für den Haupt-Linienräumungsalgorithmus, der die Anzahl geräumter Reihen zurückgibt.
+    void SetCell(int row, int column, int value); // Method declaration for writing one cell while keeping the Zobrist hash up to date. // Methoden-Deklaration zum Schreiben einer Zelle unter Aktualisierung des Zobrist-Hashs.
     int grid[20][10]; // Public 2D array representing the 20x10 Tetris playing field (20 rows, 10 columns). // Öffentliches 2D-Array, das das 20x10 Tetris-Spielfeld repräsentiert (20 Reihen, 10 Spalten).
     // Array values: 0 = empty cell, 1-7 = different Tetris block types. // Array-Werte: 0 = leere Zelle, 1-7 = verschiedene Tetris-Blocktypen.
+    // Write cells through SetCell so that hash stays valid. // Zellen über SetCell schreiben, damit hash gültig bleibt.
+    ParticleSystem *particles; // Public pointer to the effects pool that ClearFullRows bursts cleared rows into (nullptr = no effects). // Öffentlicher Zeiger auf den Effekt-Pool, in den ClearFullRows geräumte Reihen zerplatzen lässt (nullptr = keine Effekte).
+    unsigned long long hash; // Public Zobrist hash of the locked cells, updated incrementally (0 for an empty grid). // Öffentlicher Zobrist-Hash der gesperrten Zellen, inkrementell aktualisiert (0 für ein leeres Raster).
 
 private: // Private members accessible only within the Grid class for internal grid management. // Private Mitglieder, die nur innerhalb der Grid-Klasse für interne Rasterverwaltung zugänglich sind.
     bool IsRowFull(int row); // Private method declaration that checks if specified row is completely filled with blocks. // Private Methoden-Deklaration, die prüft, ob angegebene Reihe vollständig mit Blöcken gefüllt ist.
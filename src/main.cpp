@@ -8,6 +8,10 @@
 /// // Compile and run the Tetris game
 /// g++ -o tetris main.cpp game.cpp grid.cpp block.cpp colors.cpp position.cpp -lraylib
 /// ./tetris
+/// ./tetris --particle-stress   // Keeps about 50000 particles alive and shows update/draw times
+/// ./tetris --record games.tlr  // Appends every lock and finished game to a replay corpus (see replay.h)
+/// ./tetris --player NICK --scores arcade  // Stores finished games as NICK in arcade.log/arcade.idx (default: PLAYER, highscores)
+/// ./tetris --wall 64           // Monitor wall: 64 bot games in one resizable window (see wall.h)
 /// ```
 /// 
 /// EN: Implements the complete Tetris game application with window management, game loop, UI rendering, and event timing.
@@ -15,8 +19,17 @@
 
 #include <raylib.h> // Includes raylib graphics library for window, input, audio, and drawing functions. // Inkludiert raylib-Grafikbibliothek für Fenster-, Eingabe-, Audio- und Zeichenfunktionen.
 #include "game.h" // Includes the Game class header for main game logic and state management. // Inkludiert die Game-Klassen-Header für Hauptspiellogik und Zustandsverwaltung.
+#include "pacer.h" // Includes the FramePacer class for idle-aware redraws and CPU-time metrics. // Inkludiert die FramePacer-Klasse für leerlaufbewusstes Neuzeichnen und CPU-Zeit-Metriken.
 #include "colors.h" // Includes color definitions for background colors and UI elements. // Inkludiert Farbdefinitionen für Hintergrundfarben und UI-Elemente.
+#include "particles.h" // Includes the ParticleSystem for landing and line-clear effects. // Inkludiert das ParticleSystem für Lande- und Linienräumungseffekte.
+#include "wall.h" // Includes the WallView for the multi-board monitor mode. // Inkludiert die WallView für den Mehrfeld-Monitormodus.
+#include "planner.h" // Includes Planner::ApplyMove and Planner::Evaluate for the wall bots. // Inkludiert Planner::ApplyMove und Planner::Evaluate für die Wand-Bots.
 #include <iostream> // Includes input/output stream library for potential debugging output. // Inkludiert Eingabe-/Ausgabe-Stream-Bibliothek für potenzielle Debug-Ausgabe.
+#include <cstring> // Includes strcmp for the command-line flags. // Inkludiert strcmp für die Kommandozeilen-Flaggen.
+#include <memory> // Includes unique_ptr for the optional replay writer. // Inkludiert unique_ptr für den optionalen Replay-Writer.
+#include <ctime> // Includes time for the current leaderboard period. // Inkludiert time für den aktuellen Bestenlisten-Zeitraum.
+#include <cstdlib> // Includes atoi for the wall size. // Inkludiert atoi für die Wandgröße.
+#include <vector> // Includes vector for the wall bots. // Inkludiert vector für die Wand-Bots.
 
 double lastUpdateTime = 0; // Global variable storing the timestamp of last automatic block movement. // Globale Variable, die den Zeitstempel der letzten automatischen Blockbewegung speichert.
 
@@ -31,25 +44,235 @@ bool EventTriggered(double interval) // Function that implements timing mechanis
     return false; // Returns false if not enough time has passed for the next event. // Gibt falsch zurück, wenn nicht genug Zeit für das nächste Event vergangen ist.
 }
 
-int main() // Main function - the entry point of the Tetris application. // Main-Funktion - der Einstiegspunkt der Tetris-Anwendung.
+struct WallBot // One headless game on the monitor wall, played key by key like a person would. // Ein headless Spiel auf der Monitorwand, Taste für Taste gespielt wie von einer Person.
 {
+    Engine engine; // Game state. // Spielzustand.
+    PlannerMove target; // Placement chosen for the current block. // Für den aktuellen Block gewählte Platzierung.
+    int rotationsDone; // Rotations already pressed for the current block. // Für den aktuellen Block bereits gedrückte Rotationen.
+    bool planned; // True once target was chosen for the current block. // Wahr, sobald target für den aktuellen Block gewählt wurde.
+    double nextTick; // Time of the next key press. // Zeitpunkt des nächsten Tastendrucks.
+    unsigned long long seed; // Seed of the next game. // Seed des nächsten Spiels.
+};
+
+static PlannerMove ChooseWallMove(const Engine &engine) // Greedy placement by Planner::Evaluate, as in tools/replay_gen.cpp. // Gierige Platzierung nach Planner::Evaluate, wie in tools/replay_gen.cpp.
+{
+    PlannerMove best = {0, engine.currentBlock.column}; // Falls straight down if nothing is reachable. // Fällt gerade nach unten, wenn nichts erreichbar ist.
+    float bestValue = -1e30f;
+    for (int rotations = 0; rotations < blockRotations[engine.currentBlock.id]; rotations++)
+    {
+        for (int column = -3; column < 13; column++) // Same offset range as Planner::FindPlacements. // Gleicher Offset-Bereich wie Planner::FindPlacements.
+        {
+            Engine result = engine;
+            PlannerMove move = {rotations, column};
+            if (!Planner::ApplyMove(result, move))
+            {
+                continue;
+            }
+            float value = (float)(result.score - engine.score) + Planner::Evaluate(result); // Points now plus board quality. // Punkte jetzt plus Spielfeldqualität.
+            if (value > bestValue)
+            {
+                bestValue = value;
+                best = move;
+            }
+        }
+    }
+    return best;
+}
+
+static void StepWallBot(WallBot &bot) // Presses one key: rotate, shift toward the target, or move down. // Drückt eine Taste: rotieren, zum Ziel verschieben oder nach unten bewegen.
+{
+    Engine &engine = bot.engine;
+    if (engine.gameOver) // Starts the next game right away so the wall never stands still. // Startet sofort das nächste Spiel, damit die Wand nie stillsteht.
+    {
+        engine.Reset(bot.seed++);
+        bot.planned = false;
+        return;
+    }
+    if (!bot.planned)
+    {
+        bot.target = ChooseWallMove(engine);
+        bot.rotationsDone = 0;
+        bot.planned = true;
+    }
+    if (bot.rotationsDone < bot.target.rotations)
+    {
+        unsigned char before = engine.currentBlock.rotation;
+        engine.RotateBlock();
+        if (engine.currentBlock.rotation != before)
+        {
+            bot.rotationsDone++;
+            return;
+        }
+        bot.target.rotations = bot.rotationsDone; // Blocked: keeps the rotation it has. // Blockiert: behält die erreichte Rotation.
+    }
+    if (engine.currentBlock.column != bot.target.column)
+    {
+        int before = engine.currentBlock.column;
+        if (bot.target.column < before)
+        {
+            engine.MoveBlockLeft();
+        }
+        else
+        {
+            engine.MoveBlockRight();
+        }
+        if (engine.currentBlock.column != before)
+        {
+            return;
+        }
+        bot.target.column = before; // Blocked: falls where it is. // Blockiert: fällt, wo er ist.
+    }
+    int row = engine.currentBlock.row;
+    engine.MoveBlockDown();
+    if (engine.gameOver || engine.currentBlock.row <= row) // The block locked and the next one spawned. // Der Block wurde gesperrt und der nächste erschienen.
+    {
+        bot.planned = false;
+    }
+}
+
+static int RunWall(int boardCount) // Monitor mode: boardCount bot games on one wall instead of the playable game. // Monitormodus: boardCount Bot-Spiele auf einer Wand statt des spielbaren Spiels.
+{
+    SetConfigFlags(FLAG_WINDOW_RESIZABLE); // The wall rescales to any window size. // Die Wand skaliert auf jede Fenstergröße.
+    InitWindow(1280, 720, "raylib Tetris - wall");
+    FramePacer pacer = FramePacer(60, 2.0); // Same pacing as the game; the bots change something nearly every frame. // Gleiches Tempo wie das Spiel; die Bots ändern fast jeden Frame etwas.
+    WallView wall(boardCount);
+    boardCount = wall.GetBoardCount(); // The wall clamps counts whose atlas would not fit in one texture. // Die Wand begrenzt Anzahlen, deren Atlas nicht in eine Textur passt.
+    wall.Layout(0, 30, (float)GetScreenWidth(), (float)(GetScreenHeight() - 30)); // Top 30 pixels hold the status line. // Die oberen 30 Pixel enthalten die Statuszeile.
+    std::vector<WallBot> bots(boardCount);
+    for (int i = 0; i < boardCount; i++)
+    {
+        bots[i].seed = 1000003ULL * (i + 1);
+        bots[i].engine.Reset(bots[i].seed++);
+        bots[i].planned = false;
+        bots[i].rotationsDone = 0;
+        bots[i].nextTick = GetTime() + 0.05 * i / boardCount; // Staggered, so the boards do not all change in the same frame. // Versetzt, damit sich nicht alle Spielfelder im selben Frame ändern.
+    }
+    while (WindowShouldClose() == false)
+    {
+        double now = GetTime();
+        for (int i = 0; i < boardCount; i++)
+        {
+            WallBot &bot = bots[i];
+            if (now - bot.nextTick > 0.25) // After a stall, skips ahead instead of replaying every missed key. // Springt nach einem Stocken vor, statt jede verpasste Taste nachzuholen.
+            {
+                bot.nextTick = now;
+            }
+            while (bot.nextTick <= now) // One key every 50 ms. // Eine Taste alle 50 ms.
+            {
+                StepWallBot(bot);
+                bot.nextTick += 0.05;
+            }
+            wall.SetBoard(i, bot.engine.GetSnapshot()); // Unchanged boards stop at a 200-byte compare. // Unveränderte Spielfelder enden bei einem 200-Byte-Vergleich.
+        }
+        if (IsWindowResized())
+        {
+            wall.Layout(0, 30, (float)GetScreenWidth(), (float)(GetScreenHeight() - 30));
+        }
+        if (!pacer.ShouldDraw(wall.GetRevision()))
+        {
+            pacer.SkipFrame();
+            continue;
+        }
+        BeginDrawing();
+        ClearBackground(darkBlue);
+        wall.Draw();
+        DrawText(TextFormat("%d boards, %d uploaded, cell %.1f px, draw %.2f ms", wall.GetBoardCount(), wall.GetUploadedBoards(), wall.GetCellSize(), wall.GetDrawMs()), 10, 8, 20, WHITE);
+        DrawFPS(GetScreenWidth() - 90, 8);
+        EndDrawing();
+    }
+    CloseWindow();
+    return 0;
+}
+
+int main(int argc, char **argv) // Main function - the entry point of the Tetris application. // Main-Funktion - der Einstiegspunkt der Tetris-Anwendung.
+{
+    bool particleStress = false; // Stress mode keeps tens of thousands of particles alive to measure the effects budget. // Stressmodus hält zehntausende Partikel am Leben, um das Effektbudget zu messen.
+    const char *recordPath = nullptr; // Replay file that receives every lock and finished game (none by default). // Replay-Datei, die jede Sperrung und jedes beendete Spiel empfängt (standardmäßig keine).
+    const char *scoresPath = "highscores"; // High-score files <path>.log and <path>.idx. // Highscore-Dateien <path>.log und <path>.idx.
+    const char *playerTag = "PLAYER"; // Tag stored with every finished game. // Mit jedem beendeten Spiel gespeicherte Kennung.
+    int wallBoards = 0; // Boards of the monitor wall (0 plays the game). // Spielfelder der Monitorwand (0 spielt das Spiel).
+    for (int i = 1; i < argc; i++) // Parses the command-line flags. // Wertet die Kommandozeilen-Flaggen aus.
+    {
+        if (strcmp(argv[i], "--particle-stress") == 0)
+        {
+            particleStress = true;
+        }
+        else if (strcmp(argv[i], "--record") == 0 && i + 1 < argc)
+        {
+            recordPath = argv[++i];
+        }
+        else if (strcmp(argv[i], "--scores") == 0 && i + 1 < argc)
+        {
+            scoresPath = argv[++i];
+        }
+        else if (strcmp(argv[i], "--player") == 0 && i + 1 < argc)
+        {
+            playerTag = argv[++i];
+        }
+        else if (strcmp(argv[i], "--wall") == 0 && i + 1 < argc)
+        {
+            wallBoards = atoi(argv[++i]);
+        }
+    }
+    if (wallBoards > 0) // The wall replaces the playable game; no audio, scores or replays. // Die Wand ersetzt das spielbare Spiel; kein Audio, keine Punktzahlen oder Replays.
+    {
+        return RunWall(wallBoards);
+    }
     InitWindow(500, 620, "raylib Tetris"); // Creates game window with 500x620 pixel dimensions and title. // Erstellt Spielfenster mit 500x620 Pixel-Dimensionen und Titel.
     // Width: 500 pixels (grid + UI space), Height: 620 pixels (grid + score area). // Breite: 500 Pixel (Raster + UI-Platz), Höhe: 620 Pixel (Raster + Punktebereich).
-    SetTargetFPS(60); // Sets target frame rate to 60 FPS for smooth gameplay and animations. // Setzt Ziel-Framerate auf 60 FPS für flüssiges Gameplay und Animationen.
+    FramePacer pacer = FramePacer(60, 2.0); // Draws at 60 FPS while anything changes; an unchanged screen is not redrawn and counts as idle after 2 seconds. // Zeichnet mit 60 FPS, solange sich etwas ändert; ein unveränderter Bildschirm wird nicht neu gezeichnet und gilt nach 2 Sekunden als im Leerlauf.
+    // Music is refilled by the audio thread, so the idle rate does not affect it; any input that changes the game wakes it up in the same frame. // Musik wird vom Audio-Thread nachgefüllt, daher beeinflusst die Leerlaufrate sie nicht; jede Eingabe, die das Spiel ändert, weckt es im selben Frame auf.
 
     Font font = LoadFontEx("Font/monogram.ttf", 64, 0, 0); // Loads custom font from file with 64-pixel size for UI text. // Lädt benutzerdefinierte Schriftart aus Datei mit 64-Pixel-Größe für UI-Text.
     // Parameters: filename, font size, font chars (0=default), glyph count (0=default). // Parameter: Dateiname, Schriftgröße, Schriftzeichen (0=Standard), Glyphenanzahl (0=Standard).
 
     Game game = Game(); // Creates main Game object that manages all Tetris gameplay logic. // Erstellt Haupt-Game-Objekt, das alle Tetris-Spiellogik verwaltet.
+    AudioSystem audio(4); // Starts the audio thread: music refills and up to 4 overlapping voices per effect. // Startet den Audio-Thread: Musik-Nachfüllung und bis zu 4 überlappende Stimmen pro Effekt.
+    game.audio = &audio; // Game posts sound events to it instead of calling raylib audio. // Game stellt Sound-Ereignisse dorthin, statt raylib-Audio aufzurufen.
+    ParticleSystem particles(particleStress ? 60000 : 4096); // Fixed pool: a four-line clear needs 480 particles, stress mode up to 60000. // Fester Pool: ein Vier-Linien-Abbau braucht 480 Partikel, der Stressmodus bis zu 60000.
+    game.SetParticles(&particles); // LockBlock and ClearFullRows emit into it. // LockBlock und ClearFullRows emittieren dort hinein.
+    double lastParticleReport = 0; // Timestamp of the last stress-mode log line. // Zeitstempel der letzten Protokollzeile im Stressmodus.
+    std::unique_ptr<ReplayWriter> recorder; // Optional replay file, closed when main returns. // Optionale Replay-Datei, geschlossen, wenn main zurückkehrt.
+    if (recordPath != nullptr)
+    {
+        recorder.reset(new ReplayWriter(recordPath, 4096)); // Small blocks: a cabinet writes one every few dozen games. // Kleine Blöcke: ein Automat schreibt alle paar Dutzend Spiele einen.
+        game.recorder = recorder.get();
+        if (!recorder->IsOpen()) // Unwritable, or not a replay corpus: left untouched and nothing is recorded. // Nicht beschreibbar oder kein Replay-Korpus: bleibt unberührt und nichts wird aufgezeichnet.
+        {
+            TraceLog(LOG_WARNING, "REPLAY: %s cannot be opened as a replay corpus, not recording", recordPath);
+        }
+    }
+
+    ScoreStore scores(scoresPath, 65536); // Opens the leaderboard on its own thread; compacts the log every 65536 games. // Öffnet die Bestenliste auf einem eigenen Thread; verdichtet das Log alle 65536 Spiele.
+    game.scores = &scores; // Game submits each final score; the disk is only touched by the store's thread. // Game reicht jede Endpunktzahl ein; die Festplatte wird nur vom Thread des Stores berührt.
+    game.playerTag = playerTag;
 
     while (WindowShouldClose() == false) // Main game loop - continues until user closes window or presses ESC. // Hauptspielschleife - läuft weiter, bis Benutzer Fenster schließt oder ESC drückt.
     {
-        UpdateMusicStream(game.music); // Updates background music stream to keep audio playing continuously. // Aktualisiert Hintergrundmusik-Stream, um Audio kontinuierlich zu spielen.
         game.HandleInput(); // Processes keyboard input for block movement, rotation, and game restart. // Verarbeitet Tastatureingaben für Blockbewegung, Rotation und Spielneustart.
         if (EventTriggered(0.2)) // Checks if 0.2 seconds (200ms) have passed for automatic block falling. // Prüft, ob 0,2 Sekunden (200ms) für automatisches Blockfallen vergangen sind.
         {
             game.MoveBlockDown(); // Automatically moves current block down one row (gravity effect). // Bewegt aktuellen Block automatisch eine Reihe nach unten (Schwerkrafteffekt).
         }
+        if (particleStress) // Tops the pool up to 50000 live particles with bursts anywhere on the grid. // Füllt den Pool mit Ausbrüchen irgendwo auf dem Raster auf 50000 lebende Partikel auf.
+        {
+            while (particles.GetCount() < 50000)
+            {
+                particles.EmitBurst(GetRandomValue(11, 310), GetRandomValue(11, 610), 250, GetRandomValue(1, 7));
+            }
+            if (GetTime() - lastParticleReport >= 1.0) // Logs the effect timings once per second. // Protokolliert die Effekt-Zeiten einmal pro Sekunde.
+            {
+                lastParticleReport = GetTime();
+                TraceLog(LOG_INFO, "PARTICLES: %d live, update %.3f ms, draw %.3f ms, %u dropped", particles.GetCount(), particles.GetUpdateMs(), particles.GetDrawMs(), particles.GetDropped());
+            }
+        }
+        particles.Update(GetFrameTime()); // Advances the effects by the last frame's duration. // Bewegt die Effekte um die Dauer des letzten Frames weiter.
+
+        if (!pacer.ShouldDraw(game.revision + particles.revision + scores.revision.load(std::memory_order_relaxed))) // Checks if anything visible changed since the last drawn frame (live particles change every frame, a stored score changes the leaderboard). // Prüft, ob sich seit dem letzten gezeichneten Frame etwas Sichtbares geändert hat (lebende Partikel ändern sich jeden Frame, eine gespeicherte Punktzahl ändert die Bestenliste).
+        {
+            pacer.SkipFrame(); // Keeps the previous frame on screen, polls input and sleeps instead of redrawing. // Behält den vorherigen Frame auf dem Bildschirm, fragt Eingaben ab und schläft, statt neu zu zeichnen.
+            continue; // Skips drawing for this frame. // Überspringt das Zeichnen für diesen Frame.
+        }
 
         BeginDrawing(); // Starts raylib drawing context for rendering frame content. // Startet raylib-Zeichenkontext zum Rendern von Frame-Inhalt.
         ClearBackground(darkBlue); // Clears screen with dark blue background color from colors.h. // Löscht Bildschirm mit dunkelblauer Hintergrundfarbe aus colors.h.
@@ -59,6 +282,15 @@ int main() // Main function - the entry point of the Tetris application. // Main
         if (game.gameOver) // Checks if game is in game-over state to display end message. // Prüft, ob Spiel im Game-Over-Zustand ist, um Endnachricht anzuzeigen.
         {
             DrawTextEx(font, "GAME OVER", {320, 450}, 38, 2, WHITE); // Displays "GAME OVER" message when game ends. // Zeigt "GAME OVER"-Nachricht an, wenn Spiel endet.
+            if (!particleStress) // Today's top three from the mapped index, below the message (stress mode uses this space for timings). // Die besten drei von heute aus dem abgebildeten Index, unter der Nachricht (der Stressmodus nutzt diesen Platz für Zeiten).
+            {
+                ScoreEntry best[3]; // Copied under a short lock; no file access. // Unter einer kurzen Sperre kopiert; kein Dateizugriff.
+                int count = scores.GetTop(ScoreToday, (long long)time(nullptr), best, 3);
+                for (int i = 0; i < count; i++)
+                {
+                    DrawText(TextFormat("%d %.11s %d", i + 1, best[i].tag, best[i].score), 320, 510 + i * 25, 20, WHITE);
+                }
+            }
         }
         DrawRectangleRounded({320, 55, 170, 60}, 0.3, 6, lightBlue); // Draws rounded rectangle background for score display area. // Zeichnet abgerundetes Rechteck als Hintergrund für Punkteanzeigebereich.
         // Parameters: rectangle {x, y, width, height}, roundness, segments, color. // Parameter: Rechteck {x, y, Breite, Höhe}, Rundung, Segmente, Farbe.
@@ -71,6 +303,13 @@ int main() // Main function - the entry point of the Tetris application. // Main
         // X position: rectangle start + (rectangle width - text width) / 2 for centering. // X-Position: Rechteck-Start + (Rechteck-Breite - Text-Breite) / 2 für Zentrierung.
         DrawRectangleRounded({320, 215, 170, 180}, 0.3, 6, lightBlue); // Draws rounded rectangle background for next block preview area. // Zeichnet abgerundetes Rechteck als Hintergrund für nächsten Block-Vorschaubereich.
         game.Draw(); // Calls game's Draw method to render grid, current block, and next block preview. // Ruft Draw-Methode des Spiels auf, um Raster, aktuellen Block und nächste Blockvorschau zu rendern.
+        particles.Draw(); // Draws all effects on top of the grid in one batched pass. // Zeichnet alle Effekte in einem gebündelten Durchgang über das Raster.
+        if (particleStress) // Shows the effect timings below the preview box. // Zeigt die Effekt-Zeiten unter dem Vorschaukasten.
+        {
+            DrawText(TextFormat("%d particles", particles.GetCount()), 320, 520, 20, WHITE);
+            DrawText(TextFormat("update %.2f ms", particles.GetUpdateMs()), 320, 545, 20, WHITE);
+            DrawText(TextFormat("draw %.2f ms", particles.GetDrawMs()), 320, 570, 20, WHITE);
+        }
         EndDrawing(); // Ends raylib drawing context and presents the completed frame to screen. // Beendet raylib-Zeichenkontext und präsentiert den vollständigen Frame auf dem Bildschirm.
     }
 
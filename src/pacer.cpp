@@ -0,0 +1,159 @@
+/// Frame Pacer Implementation
+/// 
+/// Idle-aware frame pacing for the C++ Tetris game using raylib graphics library. // Leerlaufbewusste Frame-Taktung für das C++ Tetris-Spiel mit der raylib-Grafikbibliothek.
+/// Redraws only when the visible game state changed and reports idle phases and CPU time per minute. // Zeichnet nur neu, wenn sich der sichtbare Spielzustand geändert hat, und meldet Leerlaufphasen und CPU-Zeit pro Minute.
+/// 
+/// Usage:
+/// ```cpp
+/// FramePacer pacer = FramePacer(60, 2.0);
+/// if (pacer.ShouldDraw(game.revision)) { /* BeginDrawing ... EndDrawing */ }
+/// else { pacer.SkipFrame(); }
+/// ```
+/// 
+/// EN: Skipped frames sleep at most one active frame and still poll input, so the first key press after an idle phase is drawn within one frame at full frame rate; an unchanged screen costs a sleep and an input poll per frame.
+/// DE: Übersprungene Frames schlafen höchstens einen aktiven Frame lang und fragen weiterhin Eingaben ab, daher wird der erste Tastendruck nach einer Leerlaufphase innerhalb eines Frames mit voller Framerate gezeichnet; ein unveränderter Bildschirm kostet pro Frame einen Schlaf und eine Eingabeabfrage.
+
+#include "pacer.h" // Includes the FramePacer class header file with declarations. // Inkludiert die FramePacer-Klassen-Header-Datei mit Deklarationen.
+#include <raylib.h> // Includes raylib for timing, frame rate, input polling and logging functions. // Inkludiert raylib für Timing-, Framerate-, Eingabeabfrage- und Protokollierungsfunktionen.
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#define NOGDI // Keeps wingdi.h out (its Rectangle clashes with raylib). // Hält wingdi.h heraus (dessen Rectangle kollidiert mit raylib).
+#define NOUSER // Keeps winuser.h out (its CloseWindow, DrawText and ShowCursor clash with raylib). // Hält winuser.h heraus (dessen CloseWindow, DrawText und ShowCursor kollidieren mit raylib).
+#include <windows.h> // Includes GetProcessTimes. // Inkludiert GetProcessTimes.
+#else
+#include <time.h> // Includes clock_gettime with CLOCK_PROCESS_CPUTIME_ID. // Inkludiert clock_gettime mit CLOCK_PROCESS_CPUTIME_ID.
+#endif
+
+static double GetCpuSeconds() // Returns the CPU time consumed by the process so far in seconds (user plus kernel, all threads). // Gibt die bisher vom Prozess verbrauchte CPU-Zeit in Sekunden zurück (Benutzer plus Kernel, alle Threads).
+{
+#ifdef _WIN32
+    FILETIME creation, exit, kernel, user; // std::clock reports wall time on Windows, so the process times are read directly. // std::clock liefert unter Windows Wanduhrzeit, daher werden die Prozesszeiten direkt gelesen.
+    if (!GetProcessTimes(GetCurrentProcess(), &creation, &exit, &kernel, &user))
+    {
+        return 0.0;
+    }
+    unsigned long long ticks = ((unsigned long long)kernel.dwHighDateTime << 32 | kernel.dwLowDateTime) + ((unsigned long long)user.dwHighDateTime << 32 | user.dwLowDateTime); // 100-nanosecond units. // Einheiten von 100 Nanosekunden.
+    return ticks * 1e-7;
+#else
+    struct timespec now;
+    if (clock_gettime(CLOCK_PROCESS_CPUTIME_ID, &now) != 0)
+    {
+        return 0.0;
+    }
+    return now.tv_sec + now.tv_nsec * 1e-9;
+#endif
+}
+
+FramePacer::FramePacer(int activeFps, double idleDelay) // Constructor that stores the pacing parameters and starts the first metrics window. // Konstruktor, der die Taktungsparameter speichert und das erste Metrikfenster startet.
+{
+    this->activeFps = activeFps; // Stores the normal frame rate. // Speichert die normale Framerate.
+    this->idleDelay = idleDelay; // Stores the delay before going idle. // Speichert die Verzögerung bis zum Leerlauf.
+    refreshInterval = 1.0; // Redraws an unchanged screen once per second as a safety refresh. // Zeichnet einen unveränderten Bildschirm einmal pro Sekunde zur Sicherheit neu.
+    idle = false; // Starts in active mode. // Startet im aktiven Modus.
+    lastFrameDrawn = false; // No frame has been processed yet. // Es wurde noch kein Frame verarbeitet.
+    hasDrawn = false; // Forces the very first frame to be drawn. // Erzwingt, dass der allererste Frame gezeichnet wird.
+    lastRevision = 0; // No revision has been drawn yet. // Es wurde noch keine Revision gezeichnet.
+    lastChangeTime = GetTime(); // Treats startup as the last state change. // Behandelt den Start als letzte Zustandsänderung.
+    lastDrawTime = lastChangeTime; // Initializes the last draw timestamp. // Initialisiert den Zeitstempel des letzten Zeichnens.
+    frameStartTime = lastChangeTime; // Initializes the frame start timestamp. // Initialisiert den Zeitstempel des Frame-Starts.
+    windowStartTime = lastChangeTime; // Starts the first metrics window now. // Startet das erste Metrikfenster jetzt.
+    windowStartCpu = GetCpuSeconds(); // Records CPU time at the start of the window. // Erfasst die CPU-Zeit zu Beginn des Fensters.
+    drawnFrames = 0; // Resets drawn frame counter. // Setzt den Zähler gezeichneter Frames zurück.
+    skippedFrames = 0; // Resets skipped frame counter. // Setzt den Zähler übersprungener Frames zurück.
+    cpuMsPerMinute = 0.0; // No complete window measured yet. // Noch kein vollständiges Fenster gemessen.
+    drawnPerMinute = 0; // No complete window measured yet. // Noch kein vollständiges Fenster gemessen.
+    skippedPerMinute = 0; // No complete window measured yet. // Noch kein vollständiges Fenster gemessen.
+    SetTargetFPS(activeFps); // Applies the active frame rate to raylib's EndDrawing timing. // Wendet die aktive Framerate auf das EndDrawing-Timing von raylib an.
+}
+
+bool FramePacer::ShouldDraw(unsigned int revision) // Decides whether the current frame has to be redrawn. // Entscheidet, ob der aktuelle Frame neu gezeichnet werden muss.
+{
+    double now = GetTime(); // Gets current time in seconds since program start. // Holt aktuelle Zeit in Sekunden seit Programmstart.
+    if (lastFrameDrawn) // After a drawn frame EndDrawing already waited, so this iteration starts now. // Nach einem gezeichneten Frame hat EndDrawing bereits gewartet, daher beginnt diese Iteration jetzt.
+    {
+        frameStartTime = now; // Marks the start of the current loop iteration. // Markiert den Beginn der aktuellen Schleifeniteration.
+    }
+    UpdateMetrics(now); // Rolls the one-minute metrics window if needed. // Rollt das Ein-Minuten-Metrikfenster bei Bedarf weiter.
+
+    bool changed = !hasDrawn || revision != lastRevision; // Checks if any visible state changed since the last drawn frame. // Prüft, ob sich seit dem letzten gezeichneten Frame sichtbarer Zustand geändert hat.
+    if (changed) // Something visible changed (input, gravity, line clear, reset). // Etwas Sichtbares hat sich geändert (Eingabe, Schwerkraft, Linienräumung, Reset).
+    {
+        lastChangeTime = now; // Remembers when the last change happened. // Merkt sich, wann die letzte Änderung geschah.
+        SetIdle(false); // Leaves the idle phase. // Verlässt die Leerlaufphase.
+    }
+    else if (!idle && now - lastChangeTime >= idleDelay) // Nothing changed for longer than the idle delay. // Seit länger als der Leerlaufverzögerung hat sich nichts geändert.
+    {
+        SetIdle(true); // Marks the screen as static. // Markiert den Bildschirm als statisch.
+    }
+
+    bool draw = changed || IsWindowResized() || now - lastDrawTime >= refreshInterval; // Draws on change, on resize, or when the safety refresh is due. // Zeichnet bei Änderung, bei Größenänderung oder wenn die Sicherheitsauffrischung fällig ist.
+    if (draw) // This frame will be drawn by the caller. // Dieser Frame wird vom Aufrufer gezeichnet.
+    {
+        hasDrawn = true; // At least one frame has been drawn now. // Jetzt wurde mindestens ein Frame gezeichnet.
+        lastRevision = revision; // Remembers which revision is on screen. // Merkt sich, welche Revision auf dem Bildschirm ist.
+        lastDrawTime = now; // Remembers when the screen was last drawn. // Merkt sich, wann der Bildschirm zuletzt gezeichnet wurde.
+        drawnFrames++; // Counts the drawn frame for the metrics. // Zählt den gezeichneten Frame für die Metriken.
+    }
+    lastFrameDrawn = draw; // Remembers how this iteration ends for the next frame start. // Merkt sich, wie diese Iteration endet, für den nächsten Frame-Start.
+    return draw; // Tells the caller whether to run BeginDrawing/EndDrawing. // Teilt dem Aufrufer mit, ob BeginDrawing/EndDrawing ausgeführt werden soll.
+}
+
+void FramePacer::SkipFrame() // Finishes a frame without drawing: sleeps for at most one active frame and polls input. // Beendet einen Frame ohne Zeichnen: schläft höchstens einen aktiven Frame lang und fragt Eingaben ab.
+{
+    skippedFrames++; // Counts the skipped frame for the metrics. // Zählt den übersprungenen Frame für die Metriken.
+    double wait = 1.0 / activeFps - (GetTime() - frameStartTime); // Remaining time of an active frame, also while idle: a key pressed during the sleep reaches HandleInput within one frame (polling again here would clear raylib's key queue before the game reads it). // Restzeit eines aktiven Frames, auch im Leerlauf: eine während des Schlafs gedrückte Taste erreicht HandleInput innerhalb eines Frames (erneutes Abfragen hier würde raylibs Tastenwarteschlange leeren, bevor das Spiel sie liest).
+    if (wait > 0.0) // Only sleeps if the frame finished early. // Schläft nur, wenn der Frame früher fertig wurde.
+    {
+        WaitTime(wait); // Sleeps instead of busy-drawing an unchanged screen. // Schläft, statt einen unveränderten Bildschirm ständig neu zu zeichnen.
+    }
+    PollInputEvents(); // Polls keyboard and window events that EndDrawing would normally poll. // Fragt Tastatur- und Fenster-Events ab, die EndDrawing normalerweise abfragen würde.
+    frameStartTime = GetTime(); // The next loop iteration starts now. // Die nächste Schleifeniteration beginnt jetzt.
+}
+
+bool FramePacer::IsIdle() // Returns whether the pacer is in idle mode. // Gibt zurück, ob der Pacer im Leerlaufmodus ist.
+{
+    return idle; // Returns the current idle flag. // Gibt die aktuelle Leerlauf-Flagge zurück.
+}
+
+double FramePacer::GetCpuMsPerMinute() // Returns CPU milliseconds of the last complete minute. // Gibt CPU-Millisekunden der letzten vollständigen Minute zurück.
+{
+    return cpuMsPerMinute; // Returns the stored metric. // Gibt die gespeicherte Metrik zurück.
+}
+
+int FramePacer::GetDrawnFramesPerMinute() // Returns drawn frames of the last complete minute. // Gibt gezeichnete Frames der letzten vollständigen Minute zurück.
+{
+    return drawnPerMinute; // Returns the stored metric. // Gibt die gespeicherte Metrik zurück.
+}
+
+int FramePacer::GetSkippedFramesPerMinute() // Returns skipped frames of the last complete minute. // Gibt übersprungene Frames der letzten vollständigen Minute zurück.
+{
+    return skippedPerMinute; // Returns the stored metric. // Gibt die gespeicherte Metrik zurück.
+}
+
+void FramePacer::SetIdle(bool idle) // Switches between active and idle phase. // Wechselt zwischen aktiver und Leerlaufphase.
+{
+    if (this->idle == idle) // Nothing to do if the phase does not change. // Nichts zu tun, wenn sich die Phase nicht ändert.
+    {
+        return;
+    }
+    this->idle = idle; // Stores the new phase; the frame rate stays the same, so input is handled within one frame in both phases. // Speichert die neue Phase; die Framerate bleibt gleich, daher wird Eingabe in beiden Phasen innerhalb eines Frames verarbeitet.
+}
+
+void FramePacer::UpdateMetrics(double now) // Closes the metrics window after one minute and logs CPU time per minute. // Schließt das Metrikfenster nach einer Minute und protokolliert die CPU-Zeit pro Minute.
+{
+    double elapsed = now - windowStartTime; // Wall-clock seconds covered by the current window. // Von dem aktuellen Fenster abgedeckte Wanduhr-Sekunden.
+    if (elapsed < 60.0) // The window is not complete yet. // Das Fenster ist noch nicht vollständig.
+    {
+        return; // Keeps collecting. // Sammelt weiter.
+    }
+    double cpu = GetCpuSeconds(); // Reads the current process CPU time. // Liest die aktuelle Prozess-CPU-Zeit.
+    double scale = 60.0 / elapsed; // Normalizes the window to exactly one minute. // Normalisiert das Fenster auf genau eine Minute.
+    cpuMsPerMinute = (cpu - windowStartCpu) * 1000.0 * scale; // CPU milliseconds spent per minute of wall time. // Pro Minute Wanduhrzeit verbrauchte CPU-Millisekunden.
+    drawnPerMinute = (int)(drawnFrames * scale); // Drawn frames per minute. // Gezeichnete Frames pro Minute.
+    skippedPerMinute = (int)(skippedFrames * scale); // Skipped frames per minute. // Übersprungene Frames pro Minute.
+    TraceLog(LOG_INFO, "PACER: %.1f ms CPU/min, %d frames drawn, %d skipped, %s", cpuMsPerMinute, drawnPerMinute, skippedPerMinute, idle ? "idle" : "active"); // Logs the metrics through raylib's logger. // Protokolliert die Metriken über den Logger von raylib.
+    windowStartTime = now; // Starts the next window. // Startet das nächste Fenster.
+    windowStartCpu = cpu; // Records CPU time at the start of the next window. // Erfasst die CPU-Zeit zu Beginn des nächsten Fensters.
+    drawnFrames = 0; // Resets drawn frame counter. // Setzt den Zähler gezeichneter Frames zurück.
+    skippedFrames = 0; // Resets skipped frame counter. // Setzt den Zähler übersprungener Frames zurück.
+}
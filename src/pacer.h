@@ -0,0 +1,59 @@
+/// Frame Pacer Header
+/// 
+/// Header file declaring the FramePacer class for idle-aware rendering in the C++ Tetris game using raylib. // Header-Datei, die die FramePacer-Klasse für leerlaufbewusstes Rendern im C++ Tetris-Spiel mit raylib deklariert.
+/// Decides per frame whether anything visible changed, skips redundant redraws, and sleeps through skipped frames. // Entscheidet pro Frame, ob sich etwas Sichtbares geändert hat, überspringt überflüssiges Neuzeichnen und schläft in übersprungenen Frames.
+/// 
+/// Usage:
+/// ```cpp
+/// #include "pacer.h"
+/// 
+/// FramePacer pacer = FramePacer(60, 2.0);
+/// while (!WindowShouldClose()) {
+///     game.HandleInput();
+///     if (pacer.ShouldDraw(game.revision)) {
+///         BeginDrawing();
+///         game.Draw();
+///         EndDrawing();
+///     } else {
+///         pacer.SkipFrame(); // Polls input and sleeps instead of redrawing
+///     }
+/// }
+/// ```
+/// 
+/// EN: Keeps attract and game-over screens from redrawing at full frame rate and reports CPU time per minute to verify the savings.
+/// DE: Verhindert, dass Attract- und Game-Over-Bildschirme mit voller Framerate neu gezeichnet werden, und meldet die CPU-Zeit pro Minute, um die Einsparung zu prüfen.
+
+#pragma once // Ensures this header file is included only once during compilation. // Stellt sicher, dass diese Header-Datei nur einmal während der Kompilierung eingebunden wird.
+
+class FramePacer // Declares the FramePacer class that controls redraw and frame-rate decisions of the main loop. // Deklariert die FramePacer-Klasse, die Neuzeichnungs- und Framerate-Entscheidungen der Hauptschleife steuert.
+{
+public: // Public interface accessible from outside the class. // Öffentliche Schnittstelle, die von außerhalb der Klasse zugänglich ist.
+    FramePacer(int activeFps, double idleDelay); // Constructor taking the frame rate and the seconds without change before the screen counts as idle. // Konstruktor mit Framerate und Sekunden ohne Änderung, bis der Bildschirm als im Leerlauf gilt.
+    bool ShouldDraw(unsigned int revision); // Returns true if the frame must be redrawn because the visible state revision changed (or a refresh is due). // Gibt wahr zurück, wenn der Frame neu gezeichnet werden muss, weil sich die sichtbare Zustandsrevision geändert hat (oder eine Auffrischung fällig ist).
+    void SkipFrame(); // Processes input events and sleeps for the rest of an active frame instead of drawing it (never longer, so input is never delayed). // Verarbeitet Eingabe-Events und schläft für den Rest eines aktiven Frames, statt ihn zu zeichnen (nie länger, damit Eingaben nie verzögert werden).
+    bool IsIdle(); // Returns true while nothing visible has changed for longer than the idle delay. // Gibt wahr zurück, solange sich länger als die Leerlaufverzögerung nichts Sichtbares geändert hat.
+    double GetCpuMsPerMinute(); // Returns process CPU time in milliseconds measured over the last complete minute. // Gibt die Prozess-CPU-Zeit in Millisekunden zurück, gemessen über die letzte vollständige Minute.
+    int GetDrawnFramesPerMinute(); // Returns how many frames were actually drawn during the last complete minute. // Gibt zurück, wie viele Frames während der letzten vollständigen Minute tatsächlich gezeichnet wurden.
+    int GetSkippedFramesPerMinute(); // Returns how many frames were skipped during the last complete minute. // Gibt zurück, wie viele Frames während der letzten vollständigen Minute übersprungen wurden.
+
+private: // Private members accessible only within the class. // Private Mitglieder, die nur innerhalb der Klasse zugänglich sind.
+    void SetIdle(bool idle); // Switches between active and idle phase. // Wechselt zwischen aktiver und Leerlaufphase.
+    void UpdateMetrics(double now); // Closes the current one-minute metrics window when it has elapsed and logs it. // Schließt das aktuelle Ein-Minuten-Metrikfenster, wenn es abgelaufen ist, und protokolliert es.
+    int activeFps; // Frame rate of drawn and skipped frames (normally 60). // Framerate gezeichneter und übersprungener Frames (normalerweise 60).
+    double idleDelay; // Seconds without any state change before switching to idle mode. // Sekunden ohne Zustandsänderung, bevor in den Leerlaufmodus gewechselt wird.
+    double refreshInterval; // Seconds after which an unchanged frame is redrawn anyway (keeps the window contents fresh). // Sekunden, nach denen ein unveränderter Frame trotzdem neu gezeichnet wird (hält den Fensterinhalt frisch).
+    bool idle; // True while nothing visible has changed for longer than idleDelay. // Wahr, solange sich länger als idleDelay nichts Sichtbares geändert hat.
+    bool lastFrameDrawn; // True if the previous loop iteration was drawn (its frame timing was handled by EndDrawing). // Wahr, wenn die vorherige Schleifeniteration gezeichnet wurde (ihr Frame-Timing wurde von EndDrawing übernommen).
+    bool hasDrawn; // False until the first frame was drawn (the first frame is always drawn). // Falsch, bis der erste Frame gezeichnet wurde (der erste Frame wird immer gezeichnet).
+    unsigned int lastRevision; // Visible state revision of the last drawn frame. // Sichtbare Zustandsrevision des zuletzt gezeichneten Frames.
+    double lastChangeTime; // Timestamp of the last observed state change. // Zeitstempel der letzten beobachteten Zustandsänderung.
+    double lastDrawTime; // Timestamp of the last drawn frame. // Zeitstempel des zuletzt gezeichneten Frames.
+    double frameStartTime; // Timestamp at which the current frame started (used to sleep skipped frames). // Zeitstempel, zu dem der aktuelle Frame begann (zum Schlafen übersprungener Frames verwendet).
+    double windowStartTime; // Wall-clock start of the current metrics window. // Wanduhr-Start des aktuellen Metrikfensters.
+    double windowStartCpu; // Process CPU seconds at the start of the current metrics window. // Prozess-CPU-Sekunden zu Beginn des aktuellen Metrikfensters.
+    int drawnFrames; // Frames drawn in the current metrics window. // Im aktuellen Metrikfenster gezeichnete Frames.
+    int skippedFrames; // Frames skipped in the current metrics window. // Im aktuellen Metrikfenster übersprungene Frames.
+    double cpuMsPerMinute; // CPU milliseconds of the last complete metrics window. // CPU-Millisekunden des letzten vollständigen Metrikfensters.
+    int drawnPerMinute; // Drawn frames of the last complete metrics window. // Gezeichnete Frames des letzten vollständigen Metrikfensters.
+    int skippedPerMinute; // Skipped frames of the last complete metrics window. // Übersprungene Frames des letzten vollständigen Metrikfensters.
+};
@@ -0,0 +1,33 @@
+/// Palette Header
+///
+/// Header file defining the RGBA values of every game color for the C++ Tetris game, without depending on raylib. // Header-Datei, die die RGBA-Werte jeder Spielfarbe für das C++ Tetris-Spiel definiert, ohne von raylib abzuhängen.
+/// colors.cpp builds the raylib Colors from this table and the software renderer packs it directly, so both always draw the same colors. // colors.cpp baut die raylib-Colors aus dieser Tabelle und der Software-Renderer packt sie direkt, daher zeichnen beide immer dieselben Farben.
+///
+/// Usage:
+/// ```cpp
+/// #include "palette.h"
+///
+/// const unsigned char *empty = paletteRgba[0];               // darkGrey: R, G, B, A
+/// const unsigned char *panel = paletteRgba[paletteLightBlue];
+/// ```
+///
+/// EN: Indices 0-7 are the block ids of GetCellColors(); the two UI colors follow at 8 and 9.
+/// DE: Die Indizes 0-7 sind die Block-IDs von GetCellColors(); die zwei UI-Farben folgen bei 8 und 9.
+
+#pragma once // Ensures this header file is included only once during compilation. // Stellt sicher, dass diese Header-Datei nur einmal während der Kompilierung eingebunden wird.
+
+static constexpr int paletteDarkBlue = 8; // Palette index of the window background. // Palettenindex des Fensterhintergrunds.
+static constexpr int paletteLightBlue = 9; // Palette index of the score and next panels. // Palettenindex der Punkte- und Vorschau-Panels.
+
+static constexpr unsigned char paletteRgba[10][4] = { // constexpr, so colors.cpp initializes its Colors from it at compile time. // constexpr, daher initialisiert colors.cpp seine Colors daraus zur Kompilierzeit.
+    {26, 31, 40, 255},   // 0: darkGrey (empty cell). // 0: darkGrey (leere Zelle).
+    {47, 230, 23, 255},  // 1: green. // 1: grün.
+    {232, 18, 18, 255},  // 2: red. // 2: rot.
+    {226, 116, 17, 255}, // 3: orange. // 3: orange.
+    {237, 234, 4, 255},  // 4: yellow. // 4: gelb.
+    {166, 0, 247, 255},  // 5: purple. // 5: lila.
+    {21, 204, 209, 255}, // 6: cyan. // 6: cyan.
+    {13, 64, 216, 255},  // 7: blue. // 7: blau.
+    {44, 44, 127, 255},  // 8: darkBlue (window background). // 8: darkBlue (Fensterhintergrund).
+    {59, 85, 162, 255}   // 9: lightBlue (score and next panels). // 9: lightBlue (Punkte- und Vorschau-Panels).
+};
@@ -0,0 +1,200 @@
+/// Particle System Implementation
+///
+/// Implementation of the pooled structure-of-arrays particle system for the C++ Tetris game using raylib. // Implementierung des gepoolten Struktur-von-Arrays-Partikelsystems für das C++ Tetris-Spiel mit raylib.
+/// Update runs one branch-free loop per field over contiguous floats, then compacts expired particles by swapping in the last one. // Update führt eine verzweigungsfreie Schleife pro Feld über zusammenhängende Floats aus und verdichtet dann abgelaufene Partikel durch Einsetzen des letzten.
+///
+/// Usage:
+/// ```cpp
+/// ParticleSystem particles(60000);
+/// particles.EmitBurst(160, 300, 500, 4);
+/// particles.Update(1.0f / 60);
+/// particles.Draw();
+/// ```
+///
+/// EN: Draw writes vertices straight into raylib's render batch in chunks that always fit, so tens of thousands of particles cost a handful of draw calls.
+/// DE: Draw schreibt Vertices direkt in raylibs Render-Stapel in Blöcken, die immer passen, daher kosten zehntausende Partikel nur eine Handvoll Draw-Calls.
+
+#include "particles.h" // Includes the ParticleSystem class declaration. // Inkludiert die Deklaration der ParticleSystem-Klasse.
+#include "colors.h" // Includes GetCellColors for the block palette. // Inkludiert GetCellColors für die Blockfarbpalette.
+#include <rlgl.h> // Includes raylib's low-level batch API (rlBegin, rlVertex2f, rlCheckRenderBatchLimit). // Inkludiert raylibs Low-Level-Stapel-API (rlBegin, rlVertex2f, rlCheckRenderBatchLimit).
+
+static const float particleGravity = 900.0f; // Downward acceleration in pixels per second squared. // Beschleunigung nach unten in Pixeln pro Sekunde zum Quadrat.
+static const int drawChunk = 1024; // Particles per rlBegin/rlEnd pass (4096 vertices, well below the default batch size). // Partikel pro rlBegin/rlEnd-Durchgang (4096 Vertices, deutlich unter der Standard-Stapelgröße).
+
+ParticleSystem::ParticleSystem(int capacity) // Allocates every array once; nothing is allocated afterwards. // Legt jedes Array einmal an; danach wird nichts mehr angelegt.
+{
+    this->capacity = capacity; // Stores the pool size. // Speichert die Pool-Größe.
+    count = 0; // Starts empty. // Beginnt leer.
+    positionX.resize(capacity);
+    positionY.resize(capacity);
+    velocityX.resize(capacity);
+    velocityY.resize(capacity);
+    life.resize(capacity);
+    inverseMaxLife.resize(capacity);
+    size.resize(capacity);
+    colorIndex.resize(capacity);
+    colors = GetCellColors(); // Same palette as the grid. // Gleiche Farbpalette wie das Raster.
+    randomState = 2463534242u; // Fixed non-zero xorshift seed. // Fester Xorshift-Seed ungleich null.
+    dropped = 0;
+    updateMs = 0;
+    drawMs = 0;
+    revision = 0;
+}
+
+float ParticleSystem::NextRandom() // Xorshift32 step mapped to [0, 1). // Xorshift32-Schritt abgebildet auf [0, 1).
+{
+    randomState ^= randomState << 13;
+    randomState ^= randomState >> 17;
+    randomState ^= randomState << 5;
+    return (randomState >> 8) * (1.0f / 16777216.0f); // Top 24 bits fit a float mantissa exactly. // Die oberen 24 Bit passen exakt in eine Float-Mantisse.
+}
+
+void ParticleSystem::EmitBurst(float x, float y, int amount, int id) // Spawns particles flying outwards and upwards. // Erzeugt Partikel, die nach außen und oben fliegen.
+{
+    for (int n = 0; n < amount; n++) // Writes each new particle at the end of the live range. // Schreibt jedes neue Partikel an das Ende des lebenden Bereichs.
+    {
+        if (count == capacity) // Pool is full: drops the rest instead of growing. // Pool ist voll: verwirft den Rest, statt zu wachsen.
+        {
+            dropped += amount - n;
+            return;
+        }
+        int i = count++; // Index of the new particle. // Index des neuen Partikels.
+        positionX[i] = x + (NextRandom() - 0.5f) * 8.0f; // Small spread around the origin. // Kleine Streuung um den Ursprung.
+        positionY[i] = y + (NextRandom() - 0.5f) * 8.0f;
+        velocityX[i] = (NextRandom() - 0.5f) * 360.0f; // Sideways speed up to 180 px/s. // Seitliche Geschwindigkeit bis 180 px/s.
+        velocityY[i] = -120.0f - NextRandom() * 280.0f; // Initial kick upwards, gravity brings it back down. // Anfänglicher Stoß nach oben, die Schwerkraft holt es zurück.
+        float lifetime = 0.45f + NextRandom() * 0.5f; // Lives 0.45 to 0.95 seconds. // Lebt 0,45 bis 0,95 Sekunden.
+        life[i] = lifetime;
+        inverseMaxLife[i] = 1.0f / lifetime;
+        size[i] = 2.0f + NextRandom() * 3.0f; // 2 to 5 pixels. // 2 bis 5 Pixel.
+        colorIndex[i] = (unsigned char)id;
+    }
+}
+
+void ParticleSystem::EmitRowClear(int row, const int *cells) // Bursts each cell of a cleared row from its on-screen position. // Lässt jede Zelle einer geräumten Reihe von ihrer Bildschirmposition aus zerplatzen.
+{
+    for (int column = 0; column < 10; column++) // One burst per cell, in the cell's block color. // Ein Ausbruch pro Zelle, in der Blockfarbe der Zelle.
+    {
+        EmitBurst(column * 30 + 11 + 14.5f, row * 30 + 11 + 14.5f, 12, cells[column]); // Cell center: offset 11, 30-pixel cells drawn 29 pixels wide. // Zellmitte: Offset 11, 30-Pixel-Zellen 29 Pixel breit gezeichnet.
+    }
+}
+
+void ParticleSystem::EmitLanding(int row, int column, int id) // Small puff at the bottom edge of a tile that just locked. // Kleiner Staubstoß an der Unterkante einer gerade gesperrten Kachel.
+{
+    EmitBurst(column * 30 + 11 + 14.5f, row * 30 + 11 + 29.0f, 3, id);
+}
+
+void ParticleSystem::Update(float deltaTime) // Integrates motion and expires dead particles. // Integriert Bewegung und entfernt tote Partikel.
+{
+    if (count == 0) // Nothing to animate; keeps the revision still so the pacer can go idle. // Nichts zu animieren; hält die Revision fest, damit der Pacer in den Leerlauf gehen kann.
+    {
+        updateMs = 0;
+        return;
+    }
+    double start = GetTime(); // Starts the update timer. // Startet den Update-Timer.
+    if (deltaTime > 0.05f) // Clamps the first step after an idle frame so particles do not jump. // Begrenzt den ersten Schritt nach einem Leerlauf-Frame, damit Partikel nicht springen.
+    {
+        deltaTime = 0.05f;
+    }
+    int n = count; // Local copy so the loops have a fixed trip count. // Lokale Kopie, damit die Schleifen eine feste Durchlaufzahl haben.
+    float *x = positionX.data(); // Raw pointers keep the loops simple enough for auto-vectorization. // Rohe Zeiger halten die Schleifen einfach genug für Auto-Vektorisierung.
+    float *y = positionY.data();
+    float *vx = velocityX.data();
+    float *vy = velocityY.data();
+    float *remaining = life.data();
+    float gravityStep = particleGravity * deltaTime; // Velocity change of this step. // Geschwindigkeitsänderung dieses Schritts.
+    for (int i = 0; i < n; i++) // Gravity. // Schwerkraft.
+    {
+        vy[i] += gravityStep;
+    }
+    for (int i = 0; i < n; i++) // Horizontal motion. // Horizontale Bewegung.
+    {
+        x[i] += vx[i] * deltaTime;
+    }
+    for (int i = 0; i < n; i++) // Vertical motion. // Vertikale Bewegung.
+    {
+        y[i] += vy[i] * deltaTime;
+    }
+    for (int i = 0; i < n; i++) // Aging. // Altern.
+    {
+        remaining[i] -= deltaTime;
+    }
+    int i = 0; // Compaction: moves the last live particle into each expired slot. // Verdichtung: verschiebt das letzte lebende Partikel in jeden abgelaufenen Platz.
+    while (i < n)
+    {
+        if (remaining[i] > 0.0f) // Still alive. // Lebt noch.
+        {
+            i++;
+            continue;
+        }
+        n--; // Takes the last particle; order does not matter for drawing. // Nimmt das letzte Partikel; die Reihenfolge spielt fürs Zeichnen keine Rolle.
+        x[i] = x[n];
+        y[i] = y[n];
+        vx[i] = vx[n];
+        vy[i] = vy[n];
+        remaining[i] = remaining[n];
+        inverseMaxLife[i] = inverseMaxLife[n];
+        size[i] = size[n];
+        colorIndex[i] = colorIndex[n];
+    }
+    count = n;
+    revision++; // Particles moved (or the last ones vanished), so the frame must be redrawn. // Partikel haben sich bewegt (oder die letzten sind verschwunden), daher muss der Frame neu gezeichnet werden.
+    updateMs = (GetTime() - start) * 1000.0;
+}
+
+void ParticleSystem::Draw() // Submits all particles as colored quads to raylib's render batch. // Übergibt alle Partikel als farbige Vierecke an raylibs Render-Stapel.
+{
+    if (count == 0)
+    {
+        drawMs = 0;
+        return;
+    }
+    double start = GetTime(); // Starts the draw timer. // Startet den Draw-Timer.
+    for (int begin = 0; begin < count; begin += drawChunk) // One pass per chunk; raylib flushes between chunks only when the batch is full. // Ein Durchgang pro Block; raylib leert nur zwischen Blöcken, wenn der Stapel voll ist.
+    {
+        int end = begin + drawChunk < count ? begin + drawChunk : count; // End of this chunk. // Ende dieses Blocks.
+        rlCheckRenderBatchLimit((end - begin) * 4); // Flushes first if the chunk would not fit, so rlBegin never splits it. // Leert zuerst, wenn der Block nicht passen würde, damit rlBegin ihn nie teilt.
+        rlBegin(RL_QUADS); // Untextured quads use raylib's default white texture. // Untexturierte Vierecke verwenden raylibs weiße Standardtextur.
+        for (int i = begin; i < end; i++)
+        {
+            Color color = colors[colorIndex[i]]; // Block color of the particle. // Blockfarbe des Partikels.
+            float fade = life[i] * inverseMaxLife[i]; // 1 at birth, 0 at death. // 1 bei Geburt, 0 beim Tod.
+            rlColor4ub(color.r, color.g, color.b, (unsigned char)(fade * 255.0f));
+            float left = positionX[i];
+            float top = positionY[i];
+            float right = left + size[i];
+            float bottom = top + size[i];
+            rlVertex2f(left, top); // Counter-clockwise, like DrawRectangle. // Gegen den Uhrzeigersinn, wie DrawRectangle.
+            rlVertex2f(left, bottom);
+            rlVertex2f(right, bottom);
+            rlVertex2f(right, top);
+        }
+        rlEnd();
+    }
+    drawMs = (GetTime() - start) * 1000.0;
+}
+
+int ParticleSystem::GetCount() // Returns the live particle count. // Gibt die Anzahl lebender Partikel zurück.
+{
+    return count;
+}
+
+int ParticleSystem::GetCapacity() // Returns the pool size. // Gibt die Pool-Größe zurück.
+{
+    return capacity;
+}
+
+unsigned int ParticleSystem::GetDropped() // Returns particles lost to a full pool. // Gibt durch einen vollen Pool verlorene Partikel zurück.
+{
+    return dropped;
+}
+
+double ParticleSystem::GetUpdateMs() // Returns the last update time. // Gibt die letzte Update-Zeit zurück.
+{
+    return updateMs;
+}
+
+double ParticleSystem::GetDrawMs() // Returns the last draw time. // Gibt die letzte Draw-Zeit zurück.
+{
+    return drawMs;
+}
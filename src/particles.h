@@ -0,0 +1,59 @@
+/// Particle System Header
+///
+/// Header file declaring the ParticleSystem class for line-clear and landing effects of the C++ Tetris game using raylib. // Header-Datei, die die ParticleSystem-Klasse für Linienräumungs- und Landeeffekte des C++ Tetris-Spiels mit raylib deklariert.
+/// Particles live in a fixed-capacity structure-of-arrays pool, are updated with plain loops the compiler can vectorize and are drawn in one batched pass. // Partikel leben in einem Struktur-von-Arrays-Pool fester Kapazität, werden mit einfachen Schleifen aktualisiert, die der Compiler vektorisieren kann, und in einem gebündelten Durchgang gezeichnet.
+///
+/// Usage:
+/// ```cpp
+/// #include "particles.h"
+///
+/// ParticleSystem particles(4096);  // All memory is allocated here
+/// game.SetParticles(&particles);   // Grid::ClearFullRows and Game::LockBlock emit into it
+/// particles.Update(GetFrameTime());
+/// BeginDrawing();
+/// game.Draw();
+/// particles.Draw();                // One rlBegin/rlEnd batch per chunk, no per-particle draw calls
+/// EndDrawing();
+/// ```
+///
+/// EN: Emission into a full pool drops the new particles instead of growing it, so a four-line clear never allocates or stalls a frame.
+/// DE: Emission in einen vollen Pool verwirft die neuen Partikel, statt ihn zu vergrößern, daher alloziert oder blockiert ein Vier-Linien-Abbau nie einen Frame.
+
+#pragma once // Ensures this header file is included only once during compilation. // Stellt sicher, dass diese Header-Datei nur einmal während der Kompilierung eingebunden wird.
+#include <raylib.h> // Includes raylib Color type used for the palette. // Inkludiert den raylib-Color-Typ für die Farbpalette.
+#include <vector> // Includes vector for the preallocated particle arrays. // Inkludiert vector für die vorab angelegten Partikel-Arrays.
+
+class ParticleSystem // Declares the pooled particle system. // Deklariert das gepoolte Partikelsystem.
+{
+public: // Public interface accessible from outside the class. // Öffentliche Schnittstelle, die von außerhalb der Klasse zugänglich ist.
+    ParticleSystem(int capacity); // Constructor that allocates room for capacity particles up front. // Konstruktor, der Platz für capacity Partikel im Voraus anlegt.
+    void EmitRowClear(int row, const int *cells); // Bursts every cell of a full row (cells = the 10 block ids of the row). // Lässt jede Zelle einer vollen Reihe zerplatzen (cells = die 10 Block-IDs der Reihe).
+    void EmitLanding(int row, int column, int id); // Puffs dust off the bottom edge of one locked tile. // Wirbelt Staub an der Unterkante einer gesperrten Kachel auf.
+    void EmitBurst(float x, float y, int amount, int id); // Emits amount particles around a pixel position in the color of block id. // Emittiert amount Partikel um eine Pixelposition in der Farbe der Block-ID.
+    void Update(float deltaTime); // Advances all particles and removes the expired ones. // Bewegt alle Partikel weiter und entfernt die abgelaufenen.
+    void Draw(); // Draws all live particles as quads in batched rlgl passes. // Zeichnet alle lebenden Partikel als Vierecke in gebündelten rlgl-Durchgängen.
+    int GetCount(); // Returns the number of live particles. // Gibt die Anzahl lebender Partikel zurück.
+    int GetCapacity(); // Returns the pool size. // Gibt die Pool-Größe zurück.
+    unsigned int GetDropped(); // Returns particles dropped because the pool was full. // Gibt Partikel zurück, die verworfen wurden, weil der Pool voll war.
+    double GetUpdateMs(); // Returns the duration of the last Update in milliseconds. // Gibt die Dauer des letzten Update in Millisekunden zurück.
+    double GetDrawMs(); // Returns the CPU duration of the last Draw in milliseconds (building and submitting the batch). // Gibt die CPU-Dauer des letzten Draw in Millisekunden zurück (Aufbau und Übergabe des Stapels).
+    unsigned int revision; // Public counter incremented by every Update that changed the picture (added to Game::revision for the pacer). // Öffentlicher Zähler, der von jedem Update erhöht wird, das das Bild verändert hat (wird für den Pacer zu Game::revision addiert).
+
+private: // Private members accessible only within the class. // Private Mitglieder, die nur innerhalb der Klasse zugänglich sind.
+    float NextRandom(); // Returns a uniform float in [0, 1) from a xorshift generator. // Gibt eine gleichverteilte Gleitkommazahl in [0, 1) aus einem Xorshift-Generator zurück.
+    int capacity; // Maximum number of live particles. // Maximale Anzahl lebender Partikel.
+    int count; // Live particles; they occupy indices 0 to count-1 of every array. // Lebende Partikel; sie belegen die Indizes 0 bis count-1 jedes Arrays.
+    std::vector<float> positionX; // Pixel x of each particle. // Pixel-x jedes Partikels.
+    std::vector<float> positionY; // Pixel y of each particle. // Pixel-y jedes Partikels.
+    std::vector<float> velocityX; // Horizontal speed in pixels per second. // Horizontale Geschwindigkeit in Pixeln pro Sekunde.
+    std::vector<float> velocityY; // Vertical speed in pixels per second (positive = down). // Vertikale Geschwindigkeit in Pixeln pro Sekunde (positiv = nach unten).
+    std::vector<float> life; // Remaining seconds. // Verbleibende Sekunden.
+    std::vector<float> inverseMaxLife; // 1 / initial lifetime, so the fade is a multiply. // 1 / anfängliche Lebensdauer, damit das Ausblenden eine Multiplikation ist.
+    std::vector<float> size; // Edge length in pixels. // Kantenlänge in Pixeln.
+    std::vector<unsigned char> colorIndex; // Block id into the palette (1-7). // Block-ID in die Farbpalette (1-7).
+    std::vector<Color> colors; // Palette from GetCellColors. // Farbpalette aus GetCellColors.
+    unsigned int randomState; // Xorshift state (never 0). // Xorshift-Zustand (nie 0).
+    unsigned int dropped; // Particles lost to a full pool. // Durch einen vollen Pool verlorene Partikel.
+    double updateMs; // Duration of the last Update. // Dauer des letzten Update.
+    double drawMs; // Duration of the last Draw. // Dauer des letzten Draw.
+};
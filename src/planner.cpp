@@ -0,0 +1,230 @@
+/// Planner Class Implementation
+/// 
+/// Implements the Planner class for the C++ Tetris game: flat Monte Carlo search over placements of the current block. // Implementiert die Planner-Klasse für das C++ Tetris-Spiel: flache Monte-Carlo-Suche über Platzierungen des aktuellen Blocks.
+/// Rollouts are handed out round-robin over the candidates through one atomic counter until the time budget is used. // Rollouts werden über einen atomaren Zähler reihum auf die Kandidaten verteilt, bis das Zeitbudget verbraucht ist.
+/// 
+/// Usage:
+/// ```cpp
+/// PlannerMove move = planner.Plan(engine, 0.05);
+/// PlannerStats stats = planner.GetStats();   // stats.rollouts / stats.seconds = rollouts per second
+/// ```
+/// 
+/// EN: Each thread adds into its own row of totals, so the only shared write during a plan is the rollout counter.
+/// DE: Jeder Thread addiert in seine eigene Zeile von Summen, daher ist der einzige geteilte Schreibzugriff während einer Planung der Rollout-Zähler.
+
+#include "planner.h" // Includes the Planner class header file with declarations. // Inkludiert die Planner-Klassen-Header-Datei mit Deklarationen.
+#include <atomic> // Includes the shared rollout counter. // Inkludiert den geteilten Rollout-Zähler.
+#include <chrono> // Includes steady_clock for the time budget. // Inkludiert steady_clock für das Zeitbudget.
+#include <iostream> // Includes the console output for the statistics. // Inkludiert die Konsolenausgabe für die Statistiken.
+
+Planner::Planner(WorkerPool &pool, int rolloutPieces) : pool(pool) // Constructor that stores the pool and the rollout length. // Konstruktor, der den Pool und die Rollout-Länge speichert.
+{
+    this->rolloutPieces = rolloutPieces > 0 ? rolloutPieces : 0; // Zero means candidates are compared by one random next piece only. // Null bedeutet, dass Kandidaten nur über einen zufälligen nächsten Block verglichen werden.
+    planCount = 0; // No plan yet. // Noch keine Planung.
+    stats = PlannerStats(); // Clears the counters. // Löscht die Zähler.
+}
+
+bool Planner::ApplyMove(Engine &engine, const PlannerMove &move) // Same key sequence a player would press: rotate, shift, then hold down. // Dieselbe Tastenfolge, die ein Spieler drücken würde: rotieren, verschieben, dann gedrückt halten.
+{
+    for (int i = 0; i < move.rotations; i++) // Rotates at the spawn position. // Rotiert an der Spawn-Position.
+    {
+        unsigned char before = engine.currentBlock.rotation;
+        engine.RotateBlock();
+        if (engine.currentBlock.rotation == before) // Rotation blocked. // Rotation blockiert.
+        {
+            return false;
+        }
+    }
+    while (engine.currentBlock.column != move.column) // Shifts one column at a time. // Verschiebt Spalte für Spalte.
+    {
+        int before = engine.currentBlock.column;
+        if (move.column < before)
+        {
+            engine.MoveBlockLeft();
+        }
+        else
+        {
+            engine.MoveBlockRight();
+        }
+        if (engine.currentBlock.column == before) // Wall or blocks in the way. // Wand oder Blöcke im Weg.
+        {
+            return false;
+        }
+    }
+    engine.DropBlock(); // Drops and locks the block. // Lässt den Block fallen und sperrt ihn.
+    return true;
+}
+
+int Planner::FindPlacements(const Engine &engine, PlannerMove *moves, Engine *results) // Tries every rotation at every column offset. // Probiert jede Rotation an jedem Spalten-Offset.
+{
+    int count = 0; // Distinct placements found. // Gefundene unterschiedliche Platzierungen.
+    if (engine.gameOver)
+    {
+        return 0;
+    }
+    for (int rotations = 0; rotations < blockRotations[engine.currentBlock.id]; rotations++)
+    {
+        for (int column = -3; column < 13; column++) // Shape cells span columns 0-3, so offsets -3..12 cover every position. // Formzellen umfassen Spalten 0-3, daher decken Offsets -3..12 jede Position ab.
+        {
+            PlannerMove move = {rotations, column};
+            results[count] = engine; // Cloning is a plain copy. // Klonen ist eine einfache Kopie.
+            if (!Planner::ApplyMove(results[count], move))
+            {
+                continue;
+            }
+            bool duplicate = false; // Different rotations can lock the same cells. // Verschiedene Rotationen können dieselben Zellen sperren.
+            for (int i = 0; i < count && !duplicate; i++)
+            {
+                duplicate = results[i].boardHash == results[count].boardHash && results[i].gameOver == results[count].gameOver;
+            }
+            if (!duplicate)
+            {
+                moves[count] = move;
+                count++;
+            }
+        }
+    }
+    return count; // Returns the number of distinct placements. // Gibt die Anzahl unterschiedlicher Platzierungen zurück.
+}
+
+float Planner::Evaluate(const Engine &engine) // Weighted height, holes and bumpiness, scaled so one cleared row (100 points) matches the classic line weight. // Gewichtete Höhe, Löcher und Unebenheit, so skaliert, dass eine geräumte Reihe (100 Punkte) dem klassischen Reihengewicht entspricht.
+{
+    if (engine.gameOver) // Losing is worse than any board. // Verlieren ist schlechter als jedes Spielfeld.
+    {
+        return -100000.0f;
+    }
+    int heights[10]; // Height of every column. // Höhe jeder Spalte.
+    int holes = 0; // Empty cells below the top of their column. // Leere Zellen unterhalb der Spitze ihrer Spalte.
+    int total = 0; // Sum of column heights. // Summe der Spaltenhöhen.
+    for (int column = 0; column < 10; column++)
+    {
+        heights[column] = 0;
+        for (int row = 0; row < 20; row++)
+        {
+            if (engine.cells[row][column] != 0)
+            {
+                if (heights[column] == 0)
+                {
+                    heights[column] = 20 - row; // First filled cell from the top. // Erste gefüllte Zelle von oben.
+                }
+            }
+            else if (heights[column] != 0)
+            {
+                holes++; // Empty cell under a filled one. // Leere Zelle unter einer gefüllten.
+            }
+        }
+        total += heights[column];
+    }
+    int bumpiness = 0; // Height differences between neighbouring columns. // Höhenunterschiede benachbarter Spalten.
+    for (int column = 0; column < 9; column++)
+    {
+        bumpiness += heights[column] > heights[column + 1] ? heights[column] - heights[column + 1] : heights[column + 1] - heights[column];
+    }
+    return -67.0f * (float)total - 47.0f * (float)holes - 24.0f * (float)bumpiness;
+}
+
+float Planner::Rollout(const Engine &engine, const PlannerMove &move, unsigned long long seed, long long &nodes) // Plays one possible future of a candidate. // Spielt eine mögliche Zukunft eines Kandidaten.
+{
+    Engine simulation = engine; // Clone of the real game. // Klon des echten Spiels.
+    simulation.rngState = seed; // Pieces after the preview are unknown, so every rollout draws its own sequence. // Blöcke nach der Vorschau sind unbekannt, daher zieht jeder Rollout seine eigene Folge.
+    Planner::ApplyMove(simulation, move); // Plays the candidate (reachable, FindPlacements checked it). // Spielt den Kandidaten (erreichbar, FindPlacements hat es geprüft).
+    nodes++;
+    PlannerMove moves[maxPlacements]; // Placements of the rollout piece. // Platzierungen des Rollout-Blocks.
+    Engine results[maxPlacements]; // States after each placement. // Zustände nach jeder Platzierung.
+    for (int piece = 0; piece < rolloutPieces && !simulation.gameOver; piece++) // Greedy one-ply policy for the following pieces. // Gierige Ein-Zug-Strategie für die folgenden Blöcke.
+    {
+        int count = FindPlacements(simulation, moves, results);
+        nodes += count;
+        int best = 0; // Placement with the best immediate value. // Platzierung mit dem besten unmittelbaren Wert.
+        float bestValue = -1e30f;
+        for (int i = 0; i < count; i++)
+        {
+            float value = (float)results[i].score + Evaluate(results[i]);
+            if (value > bestValue)
+            {
+                bestValue = value;
+                best = i;
+            }
+        }
+        if (count == 0)
+        {
+            break;
+        }
+        simulation = results[best];
+    }
+    return (float)(simulation.score - engine.score) + Evaluate(simulation); // Points gained plus the quality of the final board. // Gewonnene Punkte plus die Qualität des Endspielfelds.
+}
+
+PlannerMove Planner::Plan(const Engine &engine, double seconds) // Runs rollouts on all threads until the time budget is used. // Führt Rollouts auf allen Threads aus, bis das Zeitbudget verbraucht ist.
+{
+    auto start = std::chrono::steady_clock::now(); // Start timestamp. // Start-Zeitstempel.
+    auto deadline = start + std::chrono::duration_cast<std::chrono::steady_clock::duration>(std::chrono::duration<double>(seconds)); // End of the budget. // Ende des Budgets.
+    PlannerMove moves[maxPlacements]; // Root candidates. // Wurzelkandidaten.
+    Engine results[maxPlacements]; // Root candidate states (used as fallback ranking). // Zustände der Wurzelkandidaten (als Ersatzrangfolge verwendet).
+    int count = FindPlacements(engine, moves, results);
+    int threads = pool.GetThreadCount(); // Threads taking part. // Beteiligte Threads.
+    stats = PlannerStats();
+    stats.candidates = count;
+    stats.threads = threads;
+    stats.nodes = count;
+    if (count == 0) // Game over: nothing to plan. // Game Over: nichts zu planen.
+    {
+        PlannerMove none = {0, engine.currentBlock.column};
+        return none;
+    }
+    totals.assign((size_t)threads * maxPlacements, Candidate()); // Clears every thread's row. // Leert die Zeile jedes Threads.
+    threadNodes.assign((size_t)threads * 8, 0); // Eight counters per cache line, one used per thread. // Acht Zähler pro Cache-Line, einer pro Thread genutzt.
+    std::atomic<long long> nextRollout(0); // Global rollout index; candidate = index % count. // Globaler Rollout-Index; Kandidat = Index % count.
+    unsigned long long planSeed = MixSeed(engine.rngState ^ (++planCount << 32)); // Differs per call and per game. // Unterscheidet sich pro Aufruf und pro Spiel.
+    pool.RunOnAll([&](int thread) {
+        Candidate *row = &totals[(size_t)thread * maxPlacements]; // This thread's totals. // Summen dieses Threads.
+        long long nodes = 0; // This thread's node count. // Knotenzahl dieses Threads.
+        do // At least one rollout per thread, even with a zero budget. // Mindestens ein Rollout pro Thread, auch bei einem Budget von null.
+        {
+            long long index = nextRollout.fetch_add(1, std::memory_order_relaxed);
+            int candidate = (int)(index % count);
+            float value = Rollout(engine, moves[candidate], MixSeed(planSeed + (unsigned long long)index), nodes);
+            row[candidate].sum += value;
+            row[candidate].count++;
+        } while (std::chrono::steady_clock::now() < deadline);
+        threadNodes[(size_t)thread * 8] = nodes;
+    });
+    int best = 0; // Candidate with the best average. // Kandidat mit dem besten Durchschnitt.
+    double bestValue = -1e300;
+    for (int candidate = 0; candidate < count; candidate++) // Merges the rows of all threads. // Führt die Zeilen aller Threads zusammen.
+    {
+        double sum = 0.0;
+        long long rollouts = 0;
+        for (int thread = 0; thread < threads; thread++)
+        {
+            sum += totals[(size_t)thread * maxPlacements + candidate].sum;
+            rollouts += totals[(size_t)thread * maxPlacements + candidate].count;
+        }
+        stats.rollouts += rollouts;
+        double value = rollouts > 0 ? sum / (double)rollouts : (double)(results[candidate].score - engine.score) + Evaluate(results[candidate]) - 1e6; // Unsampled candidates rank last, ordered by their immediate value. // Nicht bewertete Kandidaten kommen zuletzt, nach ihrem unmittelbaren Wert geordnet.
+        if (value > bestValue)
+        {
+            bestValue = value;
+            best = candidate;
+        }
+    }
+    for (int thread = 0; thread < threads; thread++)
+    {
+        stats.nodes += threadNodes[(size_t)thread * 8];
+    }
+    stats.seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    return moves[best]; // Returns the most promising placement. // Gibt die vielversprechendste Platzierung zurück.
+}
+
+PlannerStats Planner::GetStats() // Returns the counters of the most recent Plan call. // Gibt die Zähler des letzten Plan-Aufrufs zurück.
+{
+    return stats;
+}
+
+void Planner::PrintStats(const PlannerStats &stats) // Prints throughput to the console. // Gibt den Durchsatz auf der Konsole aus.
+{
+    double seconds = stats.seconds > 0.0 ? stats.seconds : 1e-9; // Avoids dividing by zero. // Vermeidet Division durch null.
+    std::cout << "Planner threads: " << stats.threads << ", candidates: " << stats.candidates
+              << ", rollouts: " << stats.rollouts << " (" << (long long)(stats.rollouts / seconds) << "/s)"
+              << ", nodes: " << stats.nodes << " (" << (long long)(stats.nodes / seconds) << "/s)" << std::endl;
+}
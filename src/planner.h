@@ -0,0 +1,65 @@
+/// Planner Class Header
+/// 
+/// Header file declaring the Planner class, a parallel Monte Carlo lookahead player for the C++ Tetris game. // Header-Datei, die die Planner-Klasse deklariert, einen parallelen Monte-Carlo-Vorausschau-Spieler für das C++ Tetris-Spiel.
+/// Every legal placement of the current block is scored by rollouts that play several future pieces on cloned Engine states. // Jede gültige Platzierung des aktuellen Blocks wird durch Rollouts bewertet, die mehrere zukünftige Blöcke auf geklonten Engine-Zuständen spielen.
+/// 
+/// Usage:
+/// ```cpp
+/// #include "planner.h"
+/// 
+/// WorkerPool pool = WorkerPool(0);
+/// Planner planner = Planner(pool, 4);                  // Rollouts look 4 pieces ahead
+/// PlannerMove move = planner.Plan(engine, 0.05);       // 50 ms per move
+/// Planner::ApplyMove(engine, move);                    // Rotates, shifts and drops the block
+/// Planner::PrintStats(planner.GetStats());
+/// ```
+/// 
+/// EN: Pieces after the visible preview are unknown, so each rollout reseeds its clone; more threads mean more rollouts and a better average.
+/// DE: Blöcke nach der sichtbaren Vorschau sind unbekannt, daher setzt jeder Rollout seinen Klon neu auf; mehr Threads bedeuten mehr Rollouts und einen besseren Durchschnitt.
+
+#pragma once // Ensures this header file is included only once during compilation. // Stellt sicher, dass diese Header-Datei nur einmal während der Kompilierung eingebunden wird.
+#include "engine.h" // Includes the headless game rules whose states are cloned. // Inkludiert die headless Spielregeln, deren Zustände geklont werden.
+#include "workers.h" // Includes the thread pool that runs the rollouts. // Inkludiert den Thread-Pool, der die Rollouts ausführt.
+#include <vector> // Includes vector for the per-thread rollout totals. // Inkludiert vector für die Rollout-Summen pro Thread.
+
+struct PlannerMove // One placement of the current block. // Eine Platzierung des aktuellen Blocks.
+{
+    int rotations; // Number of RotateBlock calls from the spawn rotation. // Anzahl der RotateBlock-Aufrufe ab der Spawn-Rotation.
+    int column; // Target column offset of the block (PieceState::column). // Ziel-Spalten-Offset des Blocks (PieceState::column).
+};
+
+struct PlannerStats // Counters of the most recent Plan call. // Zähler des letzten Plan-Aufrufs.
+{
+    long long nodes; // Placements simulated (root candidates plus every placement tried inside rollouts). // Simulierte Platzierungen (Wurzelkandidaten plus jede in Rollouts probierte Platzierung).
+    long long rollouts; // Completed rollouts. // Abgeschlossene Rollouts.
+    int candidates; // Distinct placements of the current block. // Unterschiedliche Platzierungen des aktuellen Blocks.
+    int threads; // Threads that ran rollouts. // Threads, die Rollouts ausgeführt haben.
+    double seconds; // Wall-clock time of the call. // Wanduhrzeit des Aufrufs.
+};
+
+class Planner // Declares the Monte Carlo planner. // Deklariert den Monte-Carlo-Planer.
+{
+public: // Public interface accessible from outside the class. // Öffentliche Schnittstelle, die von außerhalb der Klasse zugänglich ist.
+    Planner(WorkerPool &pool, int rolloutPieces); // Constructor taking the thread pool and the number of pieces each rollout plays after the candidate. // Konstruktor mit dem Thread-Pool und der Anzahl der Blöcke, die jeder Rollout nach dem Kandidaten spielt.
+    PlannerMove Plan(const Engine &engine, double seconds); // Returns the placement with the best average rollout value found within the time budget. // Gibt die Platzierung mit dem besten durchschnittlichen Rollout-Wert zurück, die innerhalb des Zeitbudgets gefunden wurde.
+    PlannerStats GetStats(); // Returns the counters of the most recent Plan call. // Gibt die Zähler des letzten Plan-Aufrufs zurück.
+    static bool ApplyMove(Engine &engine, const PlannerMove &move); // Rotates, shifts and drops the current block; returns false if the placement cannot be reached. // Rotiert, verschiebt und lässt den aktuellen Block fallen; gibt falsch zurück, wenn die Platzierung nicht erreichbar ist.
+    static float Evaluate(const Engine &engine); // Scores a board by height, holes and bumpiness (higher is better). // Bewertet ein Spielfeld nach Höhe, Löchern und Unebenheit (höher ist besser).
+    static void PrintStats(const PlannerStats &stats); // Prints nodes/sec and rollouts/sec to the console. // Gibt Knoten/s und Rollouts/s auf der Konsole aus.
+
+private: // Private members accessible only within the class. // Private Mitglieder, die nur innerhalb der Klasse zugänglich sind.
+    struct Candidate // A root placement and the rollout totals of one thread. // Eine Wurzelplatzierung und die Rollout-Summen eines Threads.
+    {
+        double sum; // Sum of rollout values. // Summe der Rollout-Werte.
+        long long count; // Number of rollouts. // Anzahl der Rollouts.
+    };
+    static const int maxPlacements = 64; // Upper bound of tried placements: 4 rotations x 16 column offsets. // Obergrenze probierter Platzierungen: 4 Rotationen x 16 Spalten-Offsets.
+    static int FindPlacements(const Engine &engine, PlannerMove *moves, Engine *results); // Lists distinct reachable placements and their resulting states. // Listet unterschiedliche erreichbare Platzierungen und ihre Folgezustände auf.
+    float Rollout(const Engine &engine, const PlannerMove &move, unsigned long long seed, long long &nodes); // Plays the candidate and then greedy placements on a reseeded clone. // Spielt den Kandidaten und danach gierige Platzierungen auf einem neu geseedeten Klon.
+    WorkerPool &pool; // Threads shared with other headless code. // Mit anderem headless Code geteilte Threads.
+    int rolloutPieces; // Pieces played after the candidate in each rollout. // In jedem Rollout nach dem Kandidaten gespielte Blöcke.
+    std::vector<Candidate> totals; // Per-thread totals, one row of maxPlacements candidates per thread (no shared counters while rolling out). // Summen pro Thread, eine Zeile mit maxPlacements Kandidaten pro Thread (keine geteilten Zähler während der Rollouts).
+    std::vector<long long> threadNodes; // Per-thread node counts, spaced one cache line apart. // Knotenzahlen pro Thread, eine Cache-Line voneinander entfernt.
+    unsigned long long planCount; // Number of Plan calls, mixed into the rollout seeds. // Anzahl der Plan-Aufrufe, in die Rollout-Seeds gemischt.
+    PlannerStats stats; // Counters of the most recent Plan call. // Zähler des letzten Plan-Aufrufs.
+};
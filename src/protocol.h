@@ -0,0 +1,64 @@
+/// Network Protocol Header
+/// 
+/// Header file defining the fixed-size TCP messages between the authoritative Tetris server and its clients. // Header-Datei, die die TCP-Nachrichten fester Größe zwischen dem autoritativen Tetris-Server und seinen Clients definiert.
+/// Clients only send inputs; the server simulates every game and sends back the confirmed state, score and Zobrist hash. // Clients senden nur Eingaben; der Server simuliert jedes Spiel und sendet den bestätigten Zustand, die Punktzahl und den Zobrist-Hash zurück.
+/// 
+/// Usage:
+/// ```cpp
+/// #include "protocol.h"
+/// 
+/// InputMessage input = {MessageInput, SessionLeft, 0, ++sequence};
+/// send(socket, &input, sizeof(input), 0);
+/// // ... later a StateMessage with ackSequence >= sequence confirms the input
+/// ```
+/// 
+/// EN: Messages are plain structs in host byte order (little-endian on all supported platforms); the first byte is always the type.
+/// DE: Nachrichten sind einfache Strukturen in Host-Byte-Reihenfolge (Little-Endian auf allen unterstützten Plattformen); das erste Byte ist immer der Typ.
+
+#pragma once // Ensures this header file is included only once during compilation. // Stellt sicher, dass diese Header-Datei nur einmal während der Kompilierung eingebunden wird.
+#include <cstdint> // Includes fixed-width integers for the wire layout. // Inkludiert Ganzzahlen fester Breite für das Übertragungsformat.
+
+#define PROTOCOL_DEFAULT_PORT 7777 // TCP port the server listens on by default. // TCP-Port, auf dem der Server standardmäßig lauscht.
+#define PROTOCOL_RESTART 5 // InputMessage action that starts a new game after game over (0-4 are SessionAction codes). // InputMessage-Aktion, die nach Game Over ein neues Spiel startet (0-4 sind SessionAction-Codes).
+
+enum MessageType // First byte of every message. // Erstes Byte jeder Nachricht.
+{
+    MessageInput = 1, // Client to server: one key press. // Client zum Server: ein Tastendruck.
+    MessageWelcome = 2, // Server to client: sent once per game with the session id and timing. // Server zum Client: einmal pro Spiel mit Sitzungs-ID und Zeitverhalten gesendet.
+    MessageState = 3 // Server to client: confirmed state after a tick that changed something. // Server zum Client: bestätigter Zustand nach einem Tick, der etwas geändert hat.
+};
+
+struct InputMessage // 8 bytes, client to server. // 8 Bytes, Client zum Server.
+{
+    uint8_t type; // MessageInput. // MessageInput.
+    uint8_t action; // SessionAction code or PROTOCOL_RESTART. // SessionAction-Code oder PROTOCOL_RESTART.
+    uint16_t reserved; // Zero. // Null.
+    uint32_t sequence; // Increasing per connection; echoed as ackSequence once the input is applied. // Pro Verbindung steigend; als ackSequence zurückgesendet, sobald die Eingabe angewendet ist.
+};
+
+struct WelcomeMessage // 16 bytes, server to client. // 16 Bytes, Server zum Client.
+{
+    uint8_t type; // MessageWelcome. // MessageWelcome.
+    uint8_t tickRate; // Server ticks per second. // Server-Ticks pro Sekunde.
+    uint8_t gravityTicks; // Ticks between gravity steps. // Ticks zwischen Schwerkraftschritten.
+    uint8_t reserved; // Zero. // Null.
+    uint32_t game; // Games started on this connection so far (1 = first game). // Bisher auf dieser Verbindung gestartete Spiele (1 = erstes Spiel).
+    uint64_t session; // Server session id (the seed stays on the server, so clients cannot know future pieces). // Server-Sitzungs-ID (der Seed bleibt auf dem Server, damit Clients zukünftige Blöcke nicht kennen).
+};
+
+struct StateMessage // 32 bytes, server to client. // 32 Bytes, Server zum Client.
+{
+    uint8_t type; // MessageState. // MessageState.
+    uint8_t gameOver; // 1 once the game has ended; the score is final. // 1, sobald das Spiel beendet ist; die Punktzahl ist endgültig.
+    uint8_t currentId; // Falling block id. // ID des fallenden Blocks.
+    uint8_t rotation; // Falling block rotation state. // Rotationszustand des fallenden Blocks.
+    int8_t row; // Falling block row offset. // Reihen-Offset des fallenden Blocks.
+    int8_t column; // Falling block column offset. // Spalten-Offset des fallenden Blocks.
+    uint8_t nextId; // Preview block id. // ID des Vorschaublocks.
+    uint8_t reserved; // Zero. // Null.
+    uint32_t ackSequence; // Sequence of the last applied input. // Sequenz der zuletzt angewendeten Eingabe.
+    uint32_t tick; // Session tick this state belongs to. // Sitzungs-Tick, zu dem dieser Zustand gehört.
+    int32_t score; // Server-side score. // Serverseitige Punktzahl.
+    uint32_t reserved2; // Zero. // Null.
+    uint64_t hash; // Engine::GetHash of the confirmed position (board, falling block, preview, bag). // Engine::GetHash der bestätigten Stellung (Spielfeld, fallender Block, Vorschau, Beutel).
+};
@@ -0,0 +1,302 @@
+/// Replay Corpus Implementation
+///
+/// Implementation of the ReplayWriter that buffers game and lock-event columns and appends them as aligned blocks. // Implementierung des ReplayWriter, der Spiel- und Sperr-Ereignisspalten puffert und als ausgerichtete Blöcke anhängt.
+/// Blocks are written whole with one fwrite per column, so a crash can only lose the block that was still in memory. // Blöcke werden vollständig mit einem fwrite pro Spalte geschrieben, daher kann ein Absturz nur den Block verlieren, der noch im Speicher war.
+///
+/// Usage:
+/// ```cpp
+/// ReplayWriter writer("bots.tlr", 1 << 20);
+/// writer.BeginGame(seed);
+/// writer.RecordLock(engine.lastLock.id, engine.lastLock.rotation, engine.lastLock.row, engine.lastLock.column, engine.lastRowsCleared, engine.score);
+/// writer.EndGame(engine.score, engine.currentBlock.id);
+/// ```
+///
+/// EN: Column buffers are reserved for one block up front and reused, so recording does not allocate after the first block.
+/// DE: Spaltenpuffer werden vorab für einen Block reserviert und wiederverwendet, daher alloziert das Aufzeichnen nach dem ersten Block nicht.
+
+#include "replay.h" // Includes the format and ReplayWriter declarations. // Inkludiert die Format- und ReplayWriter-Deklarationen.
+#include <cstring> // Includes memcpy/memcmp/memset for the headers. // Inkludiert memcpy/memcmp/memset für die Köpfe.
+#ifdef _WIN32 // Windows has its own truncate call. // Windows hat einen eigenen Kürzungsaufruf.
+#include <io.h> // Includes _chsize_s. // Inkludiert _chsize_s.
+#else
+#include <unistd.h> // Includes ftruncate. // Inkludiert ftruncate.
+#endif
+
+const int replayColumnBytes[ReplayColumnCount] = {1, 1, 1, 1, 1, 2, 8, 4, 4, 1}; // Element sizes in ReplayColumn order. // Elementgrößen in ReplayColumn-Reihenfolge.
+
+static unsigned long long AlignUp(unsigned long long bytes) // Rounds up to REPLAY_ALIGNMENT. // Rundet auf REPLAY_ALIGNMENT auf.
+{
+    return (bytes + REPLAY_ALIGNMENT - 1) / REPLAY_ALIGNMENT * REPLAY_ALIGNMENT; // Integer round-up to the next multiple. // Ganzzahliges Aufrunden auf das nächste Vielfache.
+}
+
+static bool SeekFile(FILE *file, long long offset, int origin) // 64-bit fseek; bot corpora grow past 2 GB. // 64-Bit-fseek; Bot-Korpora wachsen über 2 GB.
+{
+#ifdef _WIN32 // MSVC names the 64-bit variants differently. // MSVC benennt die 64-Bit-Varianten anders.
+    return _fseeki64(file, offset, origin) == 0; // Windows 64-bit seek. // Windows-64-Bit-Seek.
+#else
+    return fseeko(file, (off_t)offset, origin) == 0; // POSIX 64-bit seek (off_t is 64 bits on Linux). // POSIX-64-Bit-Seek (off_t hat unter Linux 64 Bits).
+#endif
+}
+
+static long long TellFile(FILE *file) // 64-bit ftell. // 64-Bit-ftell.
+{
+#ifdef _WIN32 // MSVC names the 64-bit variants differently. // MSVC benennt die 64-Bit-Varianten anders.
+    return _ftelli64(file); // Windows 64-bit position. // Windows-64-Bit-Position.
+#else
+    return (long long)ftello(file); // POSIX 64-bit position. // POSIX-64-Bit-Position.
+#endif
+}
+
+static bool TruncateFile(FILE *file, long long size) // Cuts a torn last block off the corpus. // Schneidet einen zerrissenen letzten Block vom Korpus ab.
+{
+    fflush(file); // Writes buffered bytes before the size changes under them. // Schreibt gepufferte Bytes, bevor sich die Größe unter ihnen ändert.
+#ifdef _WIN32 // Windows truncates through the CRT. // Windows kürzt über die CRT.
+    return _chsize_s(_fileno(file), size) == 0; // Sets the Windows file size. // Setzt die Windows-Dateigröße.
+#else
+    return ftruncate(fileno(file), (off_t)size) == 0; // Sets the POSIX file size. // Setzt die POSIX-Dateigröße.
+#endif
+}
+
+static long long FindAppendOffset(FILE *file, long long size) // Returns the end of the last intact block, or -1 if the file is not a replay corpus of this version. // Gibt das Ende des letzten intakten Blocks zurück, oder -1, wenn die Datei kein Replay-Korpus dieser Version ist.
+{
+    ReplayFileHeader header; // Must match what the constructor writes for a new file. // Muss dem entsprechen, was der Konstruktor für eine neue Datei schreibt.
+    if (size < (long long)sizeof(header) || !SeekFile(file, 0, SEEK_SET) || fread(&header, sizeof(header), 1, file) != 1) // Too short or unreadable for a file header. // Zu kurz oder unlesbar für einen Dateikopf.
+    {
+        return -1; // Not a corpus. // Kein Korpus.
+    }
+    if (memcmp(header.magic, "TLREPLAY", 8) != 0 || header.version != REPLAY_VERSION || header.alignment != REPLAY_ALIGNMENT) // Wrong magic, version or alignment. // Falsche Kennung, Version oder Ausrichtung.
+    {
+        return -1; // Another file or an older format. // Eine andere Datei oder ein älteres Format.
+    }
+    long long position = (long long)sizeof(header); // Walks the block headers with the same checks as replay_scan. // Läuft die Blockköpfe mit denselben Prüfungen wie replay_scan ab.
+    ReplayBlockHeader block; // Header of the block at position. // Kopf des Blocks an position.
+    while (size - position >= (long long)sizeof(block) && SeekFile(file, position, SEEK_SET) && fread(&block, sizeof(block), 1, file) == 1) // Reads block headers until the end or a damaged block. // Liest Blockköpfe bis zum Ende oder einem beschädigten Block.
+    {
+        bool valid = memcmp(block.magic, "TLBLOCK1", 8) == 0 && block.blockBytes >= sizeof(block) && block.blockBytes <= (unsigned long long)(size - position); // Magic and size must fit the rest of the file. // Kennung und Größe müssen zum Rest der Datei passen.
+        for (int column = 0; column < ReplayColumnCount && valid; column++) // Every column must lie inside the block. // Jede Spalte muss innerhalb des Blocks liegen.
+        {
+            unsigned long long count = column < ReplayGameSeed ? block.eventCount : block.gameCount; // Event columns hold eventCount elements, game columns gameCount. // Ereignisspalten haben eventCount Elemente, Spielspalten gameCount.
+            valid = block.columnOffsets[column] % REPLAY_ALIGNMENT == 0 && block.columnOffsets[column] + count * replayColumnBytes[column] <= block.blockBytes; // Aligned start and end inside the block. // Ausgerichteter Beginn und Ende innerhalb des Blocks.
+        }
+        if (!valid) // A crash while appending leaves a truncated last block. // Ein Absturz beim Anhängen hinterlässt einen abgeschnittenen letzten Block.
+        {
+            break; // The intact blocks end here. // Die intakten Blöcke enden hier.
+        }
+        position += (long long)block.blockBytes; // Next block header. // Nächster Blockkopf.
+    }
+    return position; // End of the last intact block. // Ende des letzten intakten Blocks.
+}
+
+ReplayWriter::ReplayWriter(const char *path, int blockEvents) // Opens the corpus behind its last intact block, or creates it with a file header. // Öffnet das Korpus hinter seinem letzten intakten Block oder legt es mit einem Dateikopf an.
+{
+    this->blockEvents = blockEvents > 0 ? blockEvents : 1; // At least one event per block. // Mindestens ein Ereignis pro Block.
+    failed = false; // No write error yet. // Noch kein Schreibfehler.
+    inGame = false; // No game is open. // Kein Spiel ist offen.
+    lastScore = 0; // Score of the last lock. // Punktzahl der letzten Sperrung.
+    gameEvents = 0; // Locks of the open game. // Sperrungen des offenen Spiels.
+    gameSeed = 0; // Seed of the open game. // Seed des offenen Spiels.
+    writtenGames = 0; // Counters of this writer. // Zähler dieses Writers.
+    writtenEvents = 0; // Counters of this writer. // Zähler dieses Writers.
+    bytesWritten = 0; // Counters of this writer. // Zähler dieses Writers.
+    size_t reserve = (size_t)this->blockEvents + 4096; // One block plus the locks of the game that crosses the threshold. // Ein Block plus die Sperrungen des Spiels, das die Schwelle überschreitet.
+    pieces.reserve(reserve); // Event columns are reserved once. // Ereignisspalten werden einmal reserviert.
+    rotations.reserve(reserve); // Event columns are reserved once. // Ereignisspalten werden einmal reserviert.
+    rows.reserve(reserve); // Event columns are reserved once. // Ereignisspalten werden einmal reserviert.
+    columns.reserve(reserve); // Event columns are reserved once. // Ereignisspalten werden einmal reserviert.
+    clearedRows.reserve(reserve); // Event columns are reserved once. // Ereignisspalten werden einmal reserviert.
+    scoreDeltas.reserve(reserve); // Event columns are reserved once. // Ereignisspalten werden einmal reserviert.
+    file = fopen(path, "r+b"); // Keeps an existing corpus, so every launch adds to it. // Behält ein bestehendes Korpus, damit jeder Start es ergänzt.
+    if (file == nullptr) // The file does not exist yet. // Die Datei existiert noch nicht.
+    {
+        file = fopen(path, "w+b"); // First launch: creates the file. // Erster Start: legt die Datei an.
+    }
+    if (file == nullptr || !SeekFile(file, 0, SEEK_END)) // Neither opened nor created, or the end cannot be found. // Weder geöffnet noch angelegt, oder das Ende lässt sich nicht finden.
+    {
+        Fail(); // Recording continues in memory only. // Die Aufzeichnung läuft nur im Speicher weiter.
+        return; // Nothing more to check. // Nichts weiter zu prüfen.
+    }
+    long long size = TellFile(file); // Existing bytes (0 for a new file). // Bestehende Bytes (0 für eine neue Datei).
+    if (size == 0) // New or empty file. // Neue oder leere Datei.
+    {
+        ReplayFileHeader header; // Identifies the format. // Identifiziert das Format.
+        memset(&header, 0, sizeof(header)); // Zeroes the reserved fields. // Nullt die reservierten Felder.
+        memcpy(header.magic, "TLREPLAY", 8); // File magic. // Dateikennung.
+        header.version = REPLAY_VERSION; // Format version. // Formatversion.
+        header.alignment = REPLAY_ALIGNMENT; // Column alignment used by every block. // Von jedem Block verwendete Spaltenausrichtung.
+        WriteBytes(&header, sizeof(header)); // Blocks follow directly. // Blöcke folgen direkt.
+        return; // Ready for the first block. // Bereit für den ersten Block.
+    }
+    long long end = size < 0 ? -1 : FindAppendOffset(file, size); // Where the next block goes. // Wohin der nächste Block kommt.
+    if (end < 0) // Not a replay corpus of this version: never written to. // Kein Replay-Korpus dieser Version: wird nie beschrieben.
+    {
+        Fail(); // Leaves the foreign file untouched. // Lässt die fremde Datei unberührt.
+        return; // Nothing more to do. // Nichts weiter zu tun.
+    }
+    if ((end < size && !TruncateFile(file, end)) || !SeekFile(file, end, SEEK_SET)) // Drops a torn last block, then appends behind the intact ones. // Verwirft einen zerrissenen letzten Block und hängt dann hinter den intakten an.
+    {
+        Fail(); // Refuses to append behind damaged data. // Weigert sich, hinter beschädigten Daten anzuhängen.
+    }
+}
+
+ReplayWriter::~ReplayWriter() // Flushes whatever is still buffered. // Schreibt, was noch gepuffert ist.
+{
+    Close(); // Ends the game, writes the last block and closes. // Beendet das Spiel, schreibt den letzten Block und schließt.
+}
+
+bool ReplayWriter::IsOpen() // Reports whether recording still reaches the disk. // Meldet, ob die Aufzeichnung noch die Festplatte erreicht.
+{
+    return file != nullptr && !failed; // Open and no write error so far. // Offen und bisher kein Schreibfehler.
+}
+
+void ReplayWriter::BeginGame(unsigned long long seed) // Starts a game, ending an unfinished one first. // Beginnt ein Spiel und beendet vorher ein unbeendetes.
+{
+    if (inGame) // Keeps the previous game as not topped out. // Behält das vorherige Spiel als nicht übergelaufen.
+    {
+        EndGame(lastScore, 0); // Top-out piece 0 means the game was not lost. // Überlauf-Stück 0 bedeutet, dass das Spiel nicht verloren wurde.
+    }
+    inGame = true; // A game is open. // Ein Spiel ist offen.
+    lastScore = 0; // Score deltas start from 0. // Punktdifferenzen beginnen bei 0.
+    gameEvents = 0; // No locks yet. // Noch keine Sperrungen.
+    gameSeed = seed; // Stored with the game. // Mit dem Spiel gespeichert.
+}
+
+void ReplayWriter::RecordLock(int piece, int rotation, int row, int column, int rowsCleared, int score) // Appends one element to each event column. // Hängt ein Element an jede Ereignisspalte an.
+{
+    if (!inGame) // Game has no explicit start (Game::Reset knows no seed). // Game hat keinen expliziten Start (Game::Reset kennt keinen Seed).
+    {
+        BeginGame(0); // Opens a game with seed 0. // Öffnet ein Spiel mit Seed 0.
+    }
+    int delta = score - lastScore; // Points since the previous lock, including soft drops. // Punkte seit der vorherigen Sperrung, einschließlich Soft-Drops.
+    lastScore = score; // Base for the next delta. // Basis für die nächste Differenz.
+    pieces.push_back((unsigned char)piece); // Block id 1-7. // Block-ID 1-7.
+    rotations.push_back((unsigned char)rotation); // Rotation state. // Rotationszustand.
+    rows.push_back((signed char)row); // Row offset. // Reihen-Offset.
+    columns.push_back((signed char)column); // Column offset. // Spalten-Offset.
+    clearedRows.push_back((unsigned char)rowsCleared); // Rows cleared by this lock. // Durch diese Sperrung geräumte Reihen.
+    scoreDeltas.push_back((unsigned short)(delta < 0 ? 0 : (delta > 65535 ? 65535 : delta))); // Clamped to the column type. // Auf den Spaltentyp begrenzt.
+    gameEvents++; // One more lock in this game. // Eine Sperrung mehr in diesem Spiel.
+}
+
+void ReplayWriter::EndGame(int score, int topOutPiece) // Appends one element to each game column. // Hängt ein Element an jede Spielspalte an.
+{
+    if (!inGame) // A game without locks still counts (it topped out at spawn or was restarted). // Ein Spiel ohne Sperrungen zählt trotzdem (es lief beim Erscheinen über oder wurde neu gestartet).
+    {
+        BeginGame(0); // Opens a game with seed 0. // Öffnet ein Spiel mit Seed 0.
+    }
+    seeds.push_back(gameSeed); // Seed of the game. // Seed des Spiels.
+    scores.push_back(score); // Final score. // Endpunktzahl.
+    eventCounts.push_back(gameEvents); // Locks of the game, used to find its events. // Sperrungen des Spiels, um seine Ereignisse zu finden.
+    topOuts.push_back((unsigned char)topOutPiece); // Piece that topped out, 0 if none. // Stück, das überlief, 0 wenn keines.
+    inGame = false; // The game is closed. // Das Spiel ist geschlossen.
+    if (pieces.size() >= (size_t)blockEvents) // Block is full at a game boundary. // Block ist an einer Spielgrenze voll.
+    {
+        WriteBlock(); // Writes the block; games never span two blocks. // Schreibt den Block; Spiele erstrecken sich nie über zwei Blöcke.
+    }
+}
+
+bool ReplayWriter::Close() // Ends the open game, writes the rest and closes the file. // Beendet das offene Spiel, schreibt den Rest und schließt die Datei.
+{
+    if (file == nullptr) // Already closed or never opened. // Bereits geschlossen oder nie geöffnet.
+    {
+        return !failed; // Reports the earlier result. // Meldet das frühere Ergebnis.
+    }
+    if (inGame && gameEvents > 0) // Keeps a game in progress (an empty one is dropped). // Behält ein laufendes Spiel (ein leeres wird verworfen).
+    {
+        EndGame(lastScore, 0); // Stored as not topped out. // Als nicht übergelaufen gespeichert.
+    }
+    inGame = false; // Drops an empty game. // Verwirft ein leeres Spiel.
+    if (!scores.empty()) // Some games are still buffered. // Einige Spiele sind noch gepuffert.
+    {
+        WriteBlock(); // Writes them as the last block. // Schreibt sie als letzten Block.
+    }
+    if (fclose(file) != 0) // Reports errors of the final flush. // Meldet Fehler des letzten Leerens.
+    {
+        failed = true; // The last block may be lost. // Der letzte Block ist möglicherweise verloren.
+    }
+    file = nullptr; // Close is safe to call again. // Close kann erneut aufgerufen werden.
+    return !failed; // True if everything reached the file. // Wahr, wenn alles die Datei erreicht hat.
+}
+
+void ReplayWriter::WriteBlock() // Lays the columns out behind a block header, each on a 64-byte boundary. // Legt die Spalten hinter einem Blockkopf ab, jede auf einer 64-Byte-Grenze.
+{
+    const void *data[ReplayColumnCount] = {pieces.data(), rotations.data(), rows.data(), columns.data(), clearedRows.data(), scoreDeltas.data(), seeds.data(), scores.data(), eventCounts.data(), topOuts.data()}; // Buffers in ReplayColumn order. // Puffer in ReplayColumn-Reihenfolge.
+    unsigned long long counts[ReplayColumnCount]; // Elements per column. // Elemente pro Spalte.
+    for (int column = 0; column < ReplayColumnCount; column++) // Counts every column. // Zählt jede Spalte.
+    {
+        counts[column] = column < ReplayGameSeed ? pieces.size() : scores.size(); // Event columns hold locks, game columns games. // Ereignisspalten enthalten Sperrungen, Spielspalten Spiele.
+    }
+    ReplayBlockHeader header; // Describes the layout of this block. // Beschreibt das Layout dieses Blocks.
+    memset(&header, 0, sizeof(header)); // Zeroes the reserved fields. // Nullt die reservierten Felder.
+    memcpy(header.magic, "TLBLOCK1", 8); // Block magic. // Blockkennung.
+    header.gameCount = (unsigned int)scores.size(); // Games in this block. // Spiele in diesem Block.
+    header.eventCount = (unsigned int)pieces.size(); // Locks in this block. // Sperrungen in diesem Block.
+    unsigned long long offset = AlignUp(sizeof(header)); // Columns start after the header. // Spalten beginnen nach dem Kopf.
+    for (int column = 0; column < ReplayColumnCount; column++) // Places every column. // Platziert jede Spalte.
+    {
+        header.columnOffsets[column] = offset; // Column start. // Spaltenbeginn.
+        offset = AlignUp(offset + counts[column] * replayColumnBytes[column]); // Next column starts on the next boundary. // Nächste Spalte beginnt an der nächsten Grenze.
+    }
+    header.blockBytes = offset; // Whole block, padding included. // Ganzer Block, einschließlich Auffüllung.
+    static const unsigned char zeros[REPLAY_ALIGNMENT] = {}; // Padding source. // Quelle für Auffüllung.
+    WriteBytes(&header, sizeof(header)); // Header first. // Kopf zuerst.
+    unsigned long long position = sizeof(header); // Bytes of this block written so far. // Bisher geschriebene Bytes dieses Blocks.
+    for (int column = 0; column < ReplayColumnCount; column++) // Columns in ReplayColumn order. // Spalten in ReplayColumn-Reihenfolge.
+    {
+        WriteBytes(zeros, (size_t)(header.columnOffsets[column] - position)); // Pads to the column start. // Füllt bis zum Spaltenbeginn auf.
+        size_t bytes = (size_t)(counts[column] * replayColumnBytes[column]); // Bytes of this column. // Bytes dieser Spalte.
+        WriteBytes(data[column], bytes); // One fwrite per column. // Ein fwrite pro Spalte.
+        position = header.columnOffsets[column] + bytes; // End of this column. // Ende dieser Spalte.
+    }
+    WriteBytes(zeros, (size_t)(header.blockBytes - position)); // Pads the block end, so the next header is aligned too. // Füllt das Blockende auf, damit auch der nächste Kopf ausgerichtet ist.
+    fflush(file); // Hands the whole block to the OS, so a crash later does not lose it. // Übergibt den ganzen Block an das Betriebssystem, damit ein späterer Absturz ihn nicht verliert.
+    writtenGames += (long long)scores.size(); // Moves the games to the written count. // Verschiebt die Spiele in die geschriebene Anzahl.
+    writtenEvents += (long long)pieces.size(); // Moves the locks to the written count. // Verschiebt die Sperrungen in die geschriebene Anzahl.
+    pieces.clear(); // Keeps the capacity for the next block. // Behält die Kapazität für den nächsten Block.
+    rotations.clear(); // Keeps the capacity. // Behält die Kapazität.
+    rows.clear(); // Keeps the capacity. // Behält die Kapazität.
+    columns.clear(); // Keeps the capacity. // Behält die Kapazität.
+    clearedRows.clear(); // Keeps the capacity. // Behält die Kapazität.
+    scoreDeltas.clear(); // Keeps the capacity. // Behält die Kapazität.
+    seeds.clear(); // Keeps the capacity. // Behält die Kapazität.
+    scores.clear(); // Keeps the capacity. // Behält die Kapazität.
+    eventCounts.clear(); // Keeps the capacity. // Behält die Kapazität.
+    topOuts.clear(); // Keeps the capacity. // Behält die Kapazität.
+}
+
+void ReplayWriter::Fail() // Gives up on the file without writing to it. // Gibt die Datei auf, ohne in sie zu schreiben.
+{
+    failed = true; // IsOpen and Close report the failure. // IsOpen und Close melden den Fehler.
+    if (file != nullptr) // Closes the handle if there is one. // Schließt das Handle, falls vorhanden.
+    {
+        fclose(file); // Releases the handle. // Gibt das Handle frei.
+        file = nullptr; // Later writes are skipped. // Spätere Schreibvorgänge werden übersprungen.
+    }
+}
+
+void ReplayWriter::WriteBytes(const void *data, size_t bytes) // fwrite with error tracking. // fwrite mit Fehlerverfolgung.
+{
+    if (file == nullptr || bytes == 0) // Closed file or nothing to write. // Geschlossene Datei oder nichts zu schreiben.
+    {
+        return; // Skips the write. // Überspringt den Schreibvorgang.
+    }
+    if (fwrite(data, 1, bytes, file) != bytes) // Short write: disk full or I/O error. // Unvollständiges Schreiben: Festplatte voll oder E/A-Fehler.
+    {
+        failed = true; // Remembered for IsOpen and Close. // Für IsOpen und Close gemerkt.
+    }
+    bytesWritten += (long long)bytes; // Counts the bytes handed to the file. // Zählt die an die Datei übergebenen Bytes.
+}
+
+long long ReplayWriter::GetGameCount() // Returns finished games. // Gibt beendete Spiele zurück.
+{
+    return writtenGames + (long long)scores.size(); // Written plus buffered games. // Geschriebene plus gepufferte Spiele.
+}
+
+long long ReplayWriter::GetEventCount() // Returns recorded locks. // Gibt aufgezeichnete Sperrungen zurück.
+{
+    return writtenEvents + (long long)pieces.size(); // Written plus buffered locks. // Geschriebene plus gepufferte Sperrungen.
+}
+
+long long ReplayWriter::GetBytesWritten() // Returns the file size so far. // Gibt die bisherige Dateigröße zurück.
+{
+    return bytesWritten; // Returns the byte counter. // Gibt den Byte-Zähler zurück.
+}
@@ -0,0 +1,102 @@
+/// Replay Corpus Header
+///
+/// Header file declaring the columnar on-disk format for finished games and their per-lock events, plus the ReplayWriter that produces it. // Header-Datei, die das spaltenorientierte Dateiformat für beendete Spiele und ihre Sperr-Ereignisse sowie den ReplayWriter deklariert, der es erzeugt.
+/// A file is a 64-byte file header followed by self-contained blocks; each block stores every column as one contiguous, 64-byte aligned array. // Eine Datei besteht aus einem 64-Byte-Dateikopf, gefolgt von eigenständigen Blöcken; jeder Block speichert jede Spalte als ein zusammenhängendes, auf 64 Byte ausgerichtetes Array.
+///
+/// Usage:
+/// ```cpp
+/// #include "replay.h"
+///
+/// ReplayWriter writer("games.tlr", 1 << 20);  // Up to about 1M lock events per block
+/// game.recorder = &writer;                    // Game::LockBlock records every lock
+/// writer.RecordLock(3, 1, 17, 4, 2, 300);     // Or directly: I-block, rotation 1, offsets 17/4, 2 rows, score 300
+/// writer.EndGame(300, 6);                     // Topped out by a T-block
+/// writer.Close();
+/// ```
+///
+/// EN: Games never span blocks, so scanners can process blocks independently and read only the columns a query needs; a writer appends blocks to an existing corpus.
+/// DE: Spiele erstrecken sich nie über Blöcke, daher können Scanner Blöcke unabhängig verarbeiten und nur die Spalten lesen, die eine Abfrage braucht; ein Writer hängt Blöcke an ein bestehendes Korpus an.
+
+#pragma once // Ensures this header file is included only once during compilation. // Stellt sicher, dass diese Header-Datei nur einmal während der Kompilierung eingebunden wird.
+#include <cstdio> // Includes FILE for the output file. // Inkludiert FILE für die Ausgabedatei.
+#include <vector> // Includes vector for the column buffers of the open block. // Inkludiert vector für die Spaltenpuffer des offenen Blocks.
+
+#define REPLAY_VERSION 1 // Format version stored in the file header. // Im Dateikopf gespeicherte Formatversion.
+#define REPLAY_ALIGNMENT 64 // Every column starts on a cache line, so scans can use aligned vector loads. // Jede Spalte beginnt auf einer Cache-Line, damit Scans ausgerichtete Vektor-Ladebefehle verwenden können.
+
+enum ReplayColumn // Columns of a block, in on-disk order. // Spalten eines Blocks, in Dateireihenfolge.
+{
+    ReplayEventPiece = 0, // unsigned char per lock: block id 1-7. // unsigned char pro Sperrung: Block-ID 1-7.
+    ReplayEventRotation = 1, // unsigned char per lock: rotation state. // unsigned char pro Sperrung: Rotationszustand.
+    ReplayEventRow = 2, // signed char per lock: row offset (PieceState::row). // signed char pro Sperrung: Reihen-Offset (PieceState::row).
+    ReplayEventColumn = 3, // signed char per lock: column offset (PieceState::column). // signed char pro Sperrung: Spalten-Offset (PieceState::column).
+    ReplayEventRowsCleared = 4, // unsigned char per lock: rows cleared by this lock (0-4). // unsigned char pro Sperrung: durch diese Sperrung geräumte Reihen (0-4).
+    ReplayEventScoreDelta = 5, // unsigned short per lock: score gained since the previous lock, soft-drop points included. // unsigned short pro Sperrung: seit der vorherigen Sperrung gewonnene Punkte, Soft-Drop-Punkte eingeschlossen.
+    ReplayGameSeed = 6, // unsigned long long per game: Engine seed (0 for Game, which uses rand()). // unsigned long long pro Spiel: Engine-Seed (0 für Game, das rand() verwendet).
+    ReplayGameScore = 7, // int per game: final score. // int pro Spiel: Endpunktzahl.
+    ReplayGameEvents = 8, // unsigned int per game: number of locks; a game's events follow those of the previous game. // unsigned int pro Spiel: Anzahl der Sperrungen; die Ereignisse eines Spiels folgen denen des vorherigen Spiels.
+    ReplayGameTopOut = 9, // unsigned char per game: id of the block that could not spawn (0 = game did not top out). // unsigned char pro Spiel: ID des Blocks, der nicht erscheinen konnte (0 = Spiel endete nicht durch Überlauf).
+    ReplayColumnCount = 10 // Number of columns. // Anzahl der Spalten.
+};
+
+struct ReplayFileHeader // First 64 bytes of a replay file. // Erste 64 Bytes einer Replay-Datei.
+{
+    char magic[8]; // "TLREPLAY". // "TLREPLAY".
+    unsigned int version; // REPLAY_VERSION. // REPLAY_VERSION.
+    unsigned int alignment; // REPLAY_ALIGNMENT. // REPLAY_ALIGNMENT.
+    unsigned char reserved[48]; // Zero. // Null.
+};
+
+struct ReplayBlockHeader // First 128 bytes of every block. // Erste 128 Bytes jedes Blocks.
+{
+    char magic[8]; // "TLBLOCK1". // "TLBLOCK1".
+    unsigned int gameCount; // Games in this block. // Spiele in diesem Block.
+    unsigned int eventCount; // Lock events in this block. // Sperr-Ereignisse in diesem Block.
+    unsigned long long blockBytes; // Size of the block including this header; the next block starts right after. // Größe des Blocks einschließlich dieses Kopfs; der nächste Block beginnt direkt danach.
+    unsigned long long columnOffsets[ReplayColumnCount]; // Start of each column relative to the block start. // Beginn jeder Spalte relativ zum Blockbeginn.
+    unsigned char reserved[24]; // Zero. // Null.
+};
+
+extern const int replayColumnBytes[ReplayColumnCount]; // Bytes per element of each column. // Bytes pro Element jeder Spalte.
+
+class ReplayWriter // Declares the writer that collects columns in memory and appends them block by block. // Deklariert den Writer, der Spalten im Speicher sammelt und Block für Block anhängt.
+{
+public: // Public interface accessible from outside the class. // Öffentliche Schnittstelle, die von außerhalb der Klasse zugänglich ist.
+    ReplayWriter(const char *path, int blockEvents); // Constructor that opens the corpus for appending (creating it if missing); a block is written once a finished game brings it to blockEvents locks. // Konstruktor, der das Korpus zum Anhängen öffnet (und es anlegt, falls es fehlt); ein Block wird geschrieben, sobald ein beendetes Spiel ihn auf blockEvents Sperrungen bringt.
+    ~ReplayWriter(); // Destructor that closes the file (an unfinished game is kept without a top-out). // Destruktor, der die Datei schließt (ein unbeendetes Spiel wird ohne Überlauf behalten).
+    ReplayWriter(const ReplayWriter &) = delete; // Owns a file handle and is not copied. // Besitzt ein Datei-Handle und wird nicht kopiert.
+    ReplayWriter &operator=(const ReplayWriter &) = delete; // Owns a file handle and is not copied. // Besitzt ein Datei-Handle und wird nicht kopiert.
+    bool IsOpen(); // Returns true if the file could be opened as a corpus of this version and no write failed so far. // Gibt wahr zurück, wenn die Datei als Korpus dieser Version geöffnet werden konnte und bisher kein Schreiben fehlschlug.
+    void BeginGame(unsigned long long seed); // Starts a new game record (RecordLock starts one with seed 0 if needed). // Beginnt einen neuen Spieldatensatz (RecordLock beginnt bei Bedarf einen mit Seed 0).
+    void RecordLock(int piece, int rotation, int row, int column, int rowsCleared, int score); // Appends one lock event; score is the total after the lock, the delta is derived. // Hängt ein Sperr-Ereignis an; score ist die Gesamtpunktzahl nach der Sperrung, die Differenz wird abgeleitet.
+    void EndGame(int score, int topOutPiece); // Finishes the current game and writes the block if it is full. // Beendet das aktuelle Spiel und schreibt den Block, wenn er voll ist.
+    bool Close(); // Writes the last block and closes the file; returns false if any write failed. // Schreibt den letzten Block und schließt die Datei; gibt falsch zurück, wenn ein Schreiben fehlschlug.
+    long long GetGameCount(); // Returns finished games written or buffered. // Gibt geschriebene oder gepufferte beendete Spiele zurück.
+    long long GetEventCount(); // Returns lock events written or buffered. // Gibt geschriebene oder gepufferte Sperr-Ereignisse zurück.
+    long long GetBytesWritten(); // Returns bytes this writer appended so far. // Gibt die bisher von diesem Writer angehängten Bytes zurück.
+
+private: // Private members accessible only within the class. // Private Mitglieder, die nur innerhalb der Klasse zugänglich sind.
+    void WriteBlock(); // Writes the buffered games as one block and empties the buffers. // Schreibt die gepufferten Spiele als einen Block und leert die Puffer.
+    void Fail(); // Closes the file untouched and marks the writer failed. // Schließt die Datei unverändert und markiert den Writer als fehlgeschlagen.
+    void WriteBytes(const void *data, size_t bytes); // Writes and remembers failures. // Schreibt und merkt sich Fehler.
+    FILE *file; // Output file (nullptr after Close or if opening failed). // Ausgabedatei (nullptr nach Close oder wenn das Öffnen fehlschlug).
+    bool failed; // True after any failed write. // Wahr nach einem fehlgeschlagenen Schreiben.
+    int blockEvents; // Flush threshold in events. // Schreibschwelle in Ereignissen.
+    bool inGame; // True between BeginGame and EndGame. // Wahr zwischen BeginGame und EndGame.
+    int lastScore; // Score after the previous lock of the current game. // Punktzahl nach der vorherigen Sperrung des aktuellen Spiels.
+    unsigned int gameEvents; // Locks of the current game so far. // Bisherige Sperrungen des aktuellen Spiels.
+    unsigned long long gameSeed; // Seed of the current game. // Seed des aktuellen Spiels.
+    std::vector<unsigned char> pieces; // Buffered ReplayEventPiece column. // Gepufferte Spalte ReplayEventPiece.
+    std::vector<unsigned char> rotations; // Buffered ReplayEventRotation column. // Gepufferte Spalte ReplayEventRotation.
+    std::vector<signed char> rows; // Buffered ReplayEventRow column. // Gepufferte Spalte ReplayEventRow.
+    std::vector<signed char> columns; // Buffered ReplayEventColumn column. // Gepufferte Spalte ReplayEventColumn.
+    std::vector<unsigned char> clearedRows; // Buffered ReplayEventRowsCleared column. // Gepufferte Spalte ReplayEventRowsCleared.
+    std::vector<unsigned short> scoreDeltas; // Buffered ReplayEventScoreDelta column. // Gepufferte Spalte ReplayEventScoreDelta.
+    std::vector<unsigned long long> seeds; // Buffered ReplayGameSeed column. // Gepufferte Spalte ReplayGameSeed.
+    std::vector<int> scores; // Buffered ReplayGameScore column. // Gepufferte Spalte ReplayGameScore.
+    std::vector<unsigned int> eventCounts; // Buffered ReplayGameEvents column. // Gepufferte Spalte ReplayGameEvents.
+    std::vector<unsigned char> topOuts; // Buffered ReplayGameTopOut column. // Gepufferte Spalte ReplayGameTopOut.
+    long long writtenGames; // Games in blocks already written. // Spiele in bereits geschriebenen Blöcken.
+    long long writtenEvents; // Events in blocks already written. // Ereignisse in bereits geschriebenen Blöcken.
+    long long bytesWritten; // Bytes appended by this writer. // Von diesem Writer angehängte Bytes.
+};
@@ -0,0 +1,710 @@
+/// High-Score Store Implementation
+///
+/// Implementation of the ScoreStore: a checksummed append-only log is the source of truth, the memory-mapped index caches the top-K boards and how much of the log they cover. // Implementierung des ScoreStore: ein Log mit Prüfsummen, an das nur angehängt wird, ist die Quelle der Wahrheit; der speicherabgebildete Index speichert die Top-K-Listen und wie viel des Logs sie abdecken.
+/// Every file operation runs on the writer thread; the game thread only pushes into the queue and copies boards under a short lock. // Jede Dateioperation läuft auf dem Writer-Thread; der Spiel-Thread stellt nur in die Warteschlange und kopiert Listen unter einer kurzen Sperre.
+///
+/// Usage:
+/// ```cpp
+/// ScoreStore store("highscores", 65536);
+/// store.Submit("NICK", game.score, (long long)time(nullptr));
+/// ```
+///
+/// EN: Compaction keeps the best SCORE_BOARD_SIZE games per player and UTC day; every board of a whole-day period is made of those, so queries stay exact.
+/// DE: Die Verdichtung behält die besten SCORE_BOARD_SIZE Spiele pro Spieler und UTC-Tag; jede Liste eines Zeitraums aus ganzen Tagen besteht aus diesen, daher bleiben Abfragen exakt.
+
+#include "scores.h" // Includes the ScoreStore declarations and file layouts. // Inkludiert die ScoreStore-Deklarationen und Dateilayouts.
+#include <algorithm> // Includes sort for compaction. // Inkludiert sort für die Verdichtung.
+#include <cstddef> // Includes offsetof for the checksum range. // Inkludiert offsetof für den Prüfsummenbereich.
+#include <chrono> // Includes steady_clock for timing and durations for the thread's sleep. // Inkludiert steady_clock für die Zeitmessung und Zeitdauern für den Schlaf des Threads.
+#include <cstring> // Includes memcpy/memcmp/memset/strncpy. // Inkludiert memcpy/memcmp/memset/strncpy.
+#include <vector> // Includes vector for compaction and log scans. // Inkludiert vector für Verdichtung und Log-Scans.
+#ifdef _WIN32 // Windows maps files and syncs through its own API. // Windows bildet Dateien über seine eigene API ab und synchronisiert darüber.
+#define WIN32_LEAN_AND_MEAN // Leaves the rarely used parts of windows.h out. // Lässt die selten genutzten Teile von windows.h weg.
+#define NOMINMAX // Keeps windows.h from defining min and max macros. // Verhindert, dass windows.h min- und max-Makros definiert.
+#include <windows.h> // Includes CreateFileMapping/MapViewOfFile and MoveFileEx. // Inkludiert CreateFileMapping/MapViewOfFile und MoveFileEx.
+#include <io.h> // Includes _commit and _chsize_s. // Inkludiert _commit und _chsize_s.
+#else
+#include <fcntl.h> // Includes open. // Inkludiert open.
+#include <sys/mman.h> // Includes mmap/msync/munmap. // Inkludiert mmap/msync/munmap.
+#include <sys/stat.h> // Includes fstat. // Inkludiert fstat.
+#include <unistd.h> // Includes fsync/ftruncate/close. // Inkludiert fsync/ftruncate/close.
+#endif
+
+static const int scanChunk = 4096; // Records per read when the log is scanned (128 KB). // Datensätze pro Lesevorgang beim Scannen des Logs (128 KB).
+
+static unsigned int Checksum(const ScoreEntry &entry) // FNV-1a over every byte before the checksum field. // FNV-1a über jedes Byte vor dem Prüfsummenfeld.
+{
+    const unsigned char *bytes = (const unsigned char *)&entry; // Entry as raw bytes. // Eintrag als rohe Bytes.
+    unsigned int hash = 2166136261u; // FNV-1a offset basis. // FNV-1a-Startwert.
+    for (size_t i = 0; i < offsetof(ScoreEntry, checksum); i++) // Every byte up to the checksum field. // Jedes Byte bis zum Prüfsummenfeld.
+    {
+        hash = (hash ^ bytes[i]) * 16777619u; // XOR, then multiply by the FNV prime. // XOR, dann Multiplikation mit der FNV-Primzahl.
+    }
+    return hash; // Returns the checksum. // Gibt die Prüfsumme zurück.
+}
+
+static long long PeriodKey(ScorePeriod period, long long time) // Day, week or month number of a Unix time in UTC. // Tages-, Wochen- oder Monatsnummer einer Unix-Zeit in UTC.
+{
+    long long day = (time > 0 ? time : 0) / 86400; // Days since 1970-01-01. // Tage seit 1970-01-01.
+    switch (period) // Chooses the period length. // Wählt die Zeitraumlänge.
+    {
+    case ScoreToday: // Daily board. // Tagesliste.
+        return day; // One period per day. // Ein Zeitraum pro Tag.
+    case ScoreThisWeek: // Weekly board. // Wochenliste.
+        return (day + 3) / 7; // Day 0 was a Thursday; +3 makes weeks start on Monday. // Tag 0 war ein Donnerstag; +3 lässt Wochen am Montag beginnen.
+    case ScoreThisMonth: // Monthly board. // Monatsliste.
+    {
+        long long z = day + 719468; // Civil-from-days: shifts the epoch to 0000-03-01. // Kalenderdatum aus Tagen: verschiebt die Epoche auf 0000-03-01.
+        long long era = z / 146097; // 400-year cycles since the shifted epoch. // 400-Jahres-Zyklen seit der verschobenen Epoche.
+        long long dayOfEra = z - era * 146097; // Day inside the cycle. // Tag innerhalb des Zyklus.
+        long long yearOfEra = (dayOfEra - dayOfEra / 1460 + dayOfEra / 36524 - dayOfEra / 146096) / 365; // Year inside the cycle, leap days removed. // Jahr innerhalb des Zyklus, Schalttage herausgerechnet.
+        long long dayOfYear = dayOfEra - (365 * yearOfEra + yearOfEra / 4 - yearOfEra / 100); // Day inside the March-based year. // Tag innerhalb des im März beginnenden Jahres.
+        long long shiftedMonth = (5 * dayOfYear + 2) / 153; // 0 = March. // 0 = März.
+        long long month = shiftedMonth < 10 ? shiftedMonth + 3 : shiftedMonth - 9; // 1-12. // 1-12.
+        long long year = yearOfEra + era * 400 + (month <= 2 ? 1 : 0); // January and February belong to the next calendar year. // Januar und Februar gehören zum nächsten Kalenderjahr.
+        return year * 12 + month - 1; // Months since year 0. // Monate seit Jahr 0.
+    }
+    default: // All-time board. // Liste aller Zeiten.
+        return 0; // All time is one period. // Alle Zeiten sind ein Zeitraum.
+    }
+}
+
+static bool Better(const ScoreEntry &a, const ScoreEntry &b) // Higher score first, the earlier game on a tie. // Höhere Punktzahl zuerst, bei Gleichstand das frühere Spiel.
+{
+    return a.score != b.score ? a.score > b.score : a.sequence < b.sequence; // Score first, then the sequence number. // Zuerst die Punktzahl, dann die Sequenznummer.
+}
+
+static int InsertSorted(ScoreEntry *entries, int count, int capacity, const ScoreEntry &entry) // Inserts into a best-first array of at most capacity entries; returns the new count. // Fügt in ein Array mit dem Besten zuerst und höchstens capacity Einträgen ein; gibt die neue Anzahl zurück.
+{
+    if (capacity <= 0 || (count == capacity && !Better(entry, entries[count - 1]))) // Would not make the cut. // Würde es nicht hineinschaffen.
+    {
+        return count; // Leaves the array unchanged. // Lässt das Array unverändert.
+    }
+    int position = count < capacity ? count : capacity - 1; // Slot freed at the end. // Am Ende freigemachter Platz.
+    while (position > 0 && Better(entry, entries[position - 1])) // Shifts worse entries down. // Verschiebt schlechtere Einträge nach unten.
+    {
+        entries[position] = entries[position - 1]; // Moves one entry down. // Verschiebt einen Eintrag nach unten.
+        position--; // One slot up. // Einen Platz nach oben.
+    }
+    entries[position] = entry; // Places the new entry. // Setzt den neuen Eintrag.
+    return count < capacity ? count + 1 : capacity; // Grows until the array is full. // Wächst, bis das Array voll ist.
+}
+
+static void CopyTag(char *destination, const char *tag) // NUL-pads a tag to SCORE_TAG_LENGTH bytes, truncating long ones. // Füllt eine Kennung mit NUL auf SCORE_TAG_LENGTH Bytes auf und kürzt lange.
+{
+    memset(destination, 0, SCORE_TAG_LENGTH); // Clears the whole field, so unused bytes are deterministic. // Löscht das ganze Feld, damit unbenutzte Bytes deterministisch sind.
+    if (tag != nullptr) // A null tag stays empty. // Eine Null-Kennung bleibt leer.
+    {
+        strncpy(destination, tag, SCORE_TAG_LENGTH - 1); // Keeps the last byte as terminator. // Behält das letzte Byte als Abschluss.
+    }
+}
+
+static bool SeekFile(FILE *file, long long offset, int origin) // 64-bit fseek. // 64-Bit-fseek.
+{
+#ifdef _WIN32 // MSVC names the 64-bit variants differently. // MSVC benennt die 64-Bit-Varianten anders.
+    return _fseeki64(file, offset, origin) == 0; // Windows 64-bit seek. // Windows-64-Bit-Seek.
+#else
+    return fseeko(file, (off_t)offset, origin) == 0; // POSIX 64-bit seek. // POSIX-64-Bit-Seek.
+#endif
+}
+
+static long long TellFile(FILE *file) // 64-bit ftell. // 64-Bit-ftell.
+{
+#ifdef _WIN32 // MSVC names the 64-bit variants differently. // MSVC benennt die 64-Bit-Varianten anders.
+    return _ftelli64(file); // Windows 64-bit position. // Windows-64-Bit-Position.
+#else
+    return (long long)ftello(file); // POSIX 64-bit position. // POSIX-64-Bit-Position.
+#endif
+}
+
+static bool SyncFile(FILE *file) // Pushes buffered data to the OS and then to the disk. // Schiebt gepufferte Daten zum Betriebssystem und dann auf die Festplatte.
+{
+    if (fflush(file) != 0) // Hands the stdio buffer to the OS. // Übergibt den stdio-Puffer an das Betriebssystem.
+    {
+        return false; // Write error. // Schreibfehler.
+    }
+#ifdef _WIN32 // Windows commits through the CRT. // Windows schreibt über die CRT fest.
+    return _commit(_fileno(file)) == 0; // Flushes the file to the disk. // Schreibt die Datei auf die Festplatte.
+#else
+    return fsync(fileno(file)) == 0; // Flushes the file to the disk. // Schreibt die Datei auf die Festplatte.
+#endif
+}
+
+static bool TruncateFile(FILE *file, long long size) // Cuts a torn tail off the log. // Schneidet ein zerrissenes Ende vom Log ab.
+{
+    fflush(file); // Writes buffered bytes before the size changes under them. // Schreibt gepufferte Bytes, bevor sich die Größe unter ihnen ändert.
+#ifdef _WIN32 // Windows truncates through the CRT. // Windows kürzt über die CRT.
+    return _chsize_s(_fileno(file), size) == 0; // Sets the Windows file size. // Setzt die Windows-Dateigröße.
+#else
+    return ftruncate(fileno(file), (off_t)size) == 0; // Sets the POSIX file size. // Setzt die POSIX-Dateigröße.
+#endif
+}
+
+static bool MoveOver(const char *from, const char *to) // Atomically puts a finished file in place of another. // Setzt eine fertige Datei atomar an die Stelle einer anderen.
+{
+#ifdef _WIN32 // Windows needs MoveFileEx to replace a file. // Windows braucht MoveFileEx, um eine Datei zu ersetzen.
+    return MoveFileExA(from, to, MOVEFILE_REPLACE_EXISTING | MOVEFILE_WRITE_THROUGH) != 0; // Replaces the target and waits for the disk. // Ersetzt das Ziel und wartet auf die Festplatte.
+#else
+    if (rename(from, to) != 0) // POSIX rename replaces the target atomically. // POSIX-rename ersetzt das Ziel atomar.
+    {
+        return false; // Target untouched. // Ziel unberührt.
+    }
+    std::string directory(to); // Syncs the directory, so the rename itself survives a power loss. // Synchronisiert das Verzeichnis, damit das Umbenennen selbst einen Stromausfall übersteht.
+    size_t slash = directory.find_last_of('/'); // End of the directory part. // Ende des Verzeichnisteils.
+    directory = slash == std::string::npos ? std::string(".") : directory.substr(0, slash + 1); // Current directory for a bare file name. // Aktuelles Verzeichnis für einen reinen Dateinamen.
+    int descriptor = open(directory.c_str(), O_RDONLY); // Directories can be opened read-only for fsync. // Verzeichnisse lassen sich für fsync nur lesend öffnen.
+    if (descriptor >= 0) // Skips the sync if the directory cannot be opened. // Überspringt die Synchronisierung, wenn das Verzeichnis nicht geöffnet werden kann.
+    {
+        fsync(descriptor); // Writes the directory entry to the disk. // Schreibt den Verzeichniseintrag auf die Festplatte.
+        close(descriptor); // Releases the descriptor. // Gibt den Deskriptor frei.
+    }
+    return true; // The new file is in place. // Die neue Datei ist an ihrem Platz.
+#endif
+}
+
+static ScoreIndex *MapIndex(const char *path, void **mapping) // Maps the index file read-write, creating or resizing it; nullptr on failure. // Bildet die Indexdatei lesend und schreibend ab und erstellt oder vergrößert sie; nullptr bei Fehler.
+{
+#ifdef _WIN32 // Windows maps through a mapping object. // Windows bildet über ein Abbildungsobjekt ab.
+    HANDLE file = CreateFileA(path, GENERIC_READ | GENERIC_WRITE, FILE_SHARE_READ, nullptr, OPEN_ALWAYS, FILE_ATTRIBUTE_NORMAL, nullptr); // Opens or creates the index file. // Öffnet oder erstellt die Indexdatei.
+    if (file == INVALID_HANDLE_VALUE) // Cannot open the file. // Kann die Datei nicht öffnen.
+    {
+        return nullptr; // Runs without an index. // Läuft ohne Index.
+    }
+    HANDLE map = CreateFileMappingA(file, nullptr, PAGE_READWRITE, 0, (DWORD)sizeof(ScoreIndex), nullptr); // Grows a short file to the index size. // Vergrößert eine kurze Datei auf die Indexgröße.
+    CloseHandle(file); // The mapping keeps the file open. // Die Abbildung hält die Datei offen.
+    if (map == nullptr) // Cannot create the mapping. // Kann die Abbildung nicht erstellen.
+    {
+        return nullptr; // Runs without an index. // Läuft ohne Index.
+    }
+    void *memory = MapViewOfFile(map, FILE_MAP_ALL_ACCESS, 0, 0, sizeof(ScoreIndex)); // Maps the whole index. // Bildet den ganzen Index ab.
+    if (memory == nullptr) // Cannot map the view. // Kann die Ansicht nicht abbilden.
+    {
+        CloseHandle(map); // Releases the mapping object. // Gibt das Abbildungsobjekt frei.
+        return nullptr; // Runs without an index. // Läuft ohne Index.
+    }
+    *mapping = map; // Kept for UnmapIndex. // Für UnmapIndex aufbewahrt.
+    return (ScoreIndex *)memory; // The mapped index. // Der abgebildete Index.
+#else
+    *mapping = nullptr; // POSIX needs no mapping handle. // POSIX braucht kein Abbildungs-Handle.
+    int descriptor = open(path, O_RDWR | O_CREAT, 0644); // Opens or creates the index file. // Öffnet oder erstellt die Indexdatei.
+    if (descriptor < 0) // Cannot open the file. // Kann die Datei nicht öffnen.
+    {
+        return nullptr; // Runs without an index. // Läuft ohne Index.
+    }
+    struct stat info; // File size. // Dateigröße.
+    if (fstat(descriptor, &info) != 0 || info.st_size != (off_t)sizeof(ScoreIndex)) // New or foreign file: sized to the index, zero bytes fail the magic check. // Neue oder fremde Datei: auf den Index zugeschnitten, Nullbytes bestehen die Magic-Prüfung nicht.
+    {
+        if (ftruncate(descriptor, (off_t)sizeof(ScoreIndex)) != 0) // Sets the exact index size. // Setzt die genaue Indexgröße.
+        {
+            close(descriptor); // Releases the descriptor. // Gibt den Deskriptor frei.
+            return nullptr; // Runs without an index. // Läuft ohne Index.
+        }
+    }
+    void *memory = mmap(nullptr, sizeof(ScoreIndex), PROT_READ | PROT_WRITE, MAP_SHARED, descriptor, 0); // Shared mapping, so stores reach the file. // Geteilte Abbildung, damit Schreibzugriffe die Datei erreichen.
+    close(descriptor); // The mapping keeps the file open. // Die Abbildung hält die Datei offen.
+    return memory == MAP_FAILED ? nullptr : (ScoreIndex *)memory; // The mapped index, or nullptr. // Der abgebildete Index oder nullptr.
+#endif
+}
+
+static void UnmapIndex(ScoreIndex *index, void *mapping) // Writes the index back and releases the mapping. // Schreibt den Index zurück und gibt die Abbildung frei.
+{
+#ifdef _WIN32 // Windows releases view and mapping object. // Windows gibt Ansicht und Abbildungsobjekt frei.
+    FlushViewOfFile(index, sizeof(ScoreIndex)); // Writes the dirty pages. // Schreibt die geänderten Seiten.
+    UnmapViewOfFile(index); // Releases the view. // Gibt die Ansicht frei.
+    CloseHandle((HANDLE)mapping); // Releases the mapping object. // Gibt das Abbildungsobjekt frei.
+#else
+    (void)mapping; // Unused on POSIX. // Unter POSIX unbenutzt.
+    msync(index, sizeof(ScoreIndex), MS_SYNC); // Writes the dirty pages and waits. // Schreibt die geänderten Seiten und wartet.
+    munmap(index, sizeof(ScoreIndex)); // Releases the mapping. // Gibt die Abbildung frei.
+#endif
+}
+
+ScoreQueue::ScoreQueue() // Constructor that starts with an empty ring. // Konstruktor, der mit einem leeren Ring beginnt.
+{
+    head = 0; // Next slot to read. // Nächster zu lesender Platz.
+    tail = 0; // Next slot to write. // Nächster zu schreibender Platz.
+}
+
+bool ScoreQueue::Push(const ScoreEntry &entry) // Writes the entry, then publishes it with a release store. // Schreibt den Eintrag und veröffentlicht ihn dann mit einem Release-Store.
+{
+    unsigned int position = tail.load(std::memory_order_relaxed); // Only this thread writes tail. // Nur dieser Thread schreibt tail.
+    if (position - head.load(std::memory_order_acquire) >= capacity) // Ring full. // Ring voll.
+    {
+        return false; // The caller counts the drop. // Der Aufrufer zählt das Verwerfen.
+    }
+    entries[position % capacity] = entry; // Copies the entry into its slot. // Kopiert den Eintrag in seinen Platz.
+    tail.store(position + 1, std::memory_order_release); // Makes the entry visible to the consumer. // Macht den Eintrag für den Konsumenten sichtbar.
+    return true; // Queued. // Eingereiht.
+}
+
+bool ScoreQueue::Pop(ScoreEntry &entry) // Reads the oldest entry, then frees its slot with a release store. // Liest den ältesten Eintrag und gibt dann seinen Platz mit einem Release-Store frei.
+{
+    unsigned int position = head.load(std::memory_order_relaxed); // Only this thread writes head. // Nur dieser Thread schreibt head.
+    if (position == tail.load(std::memory_order_acquire)) // Ring empty. // Ring leer.
+    {
+        return false; // Nothing to store. // Nichts zu speichern.
+    }
+    entry = entries[position % capacity]; // Copies the entry out of its slot. // Kopiert den Eintrag aus seinem Platz.
+    head.store(position + 1, std::memory_order_release); // Returns the slot to the producer. // Gibt den Platz an den Produzenten zurück.
+    return true; // Dequeued. // Entnommen.
+}
+
+ScoreStore::ScoreStore(const char *path, int compactEvery) // Constructor that starts the writer thread; the files are opened there, so construction never waits for the disk. // Konstruktor, der den Writer-Thread startet; die Dateien werden dort geöffnet, daher wartet die Konstruktion nie auf die Festplatte.
+{
+    logPath = std::string(path) + ".log"; // Append-only log of every game. // Log jedes Spiels, an das nur angehängt wird.
+    indexPath = std::string(path) + ".idx"; // Memory-mapped board cache. // Speicherabgebildeter Listen-Cache.
+    this->compactEvery = compactEvery > 0 ? compactEvery : 1; // At least one game between compactions. // Mindestens ein Spiel zwischen Verdichtungen.
+    log = nullptr; // Opened by the writer thread. // Vom Writer-Thread geöffnet.
+    index = nullptr; // Mapped by the writer thread. // Vom Writer-Thread abgebildet.
+    heapIndex = nullptr; // Only used if the index cannot be mapped. // Nur verwendet, wenn der Index nicht abgebildet werden kann.
+    mapping = nullptr; // Platform mapping handle. // Plattform-Abbildungs-Handle.
+    committedBytes = sizeof(ScoreLogHeader); // An empty log is just its header. // Ein leeres Log ist nur sein Kopf.
+    revision = 0; // No board changed yet. // Noch keine Liste geändert.
+    ready = false; // Set once the files are open. // Gesetzt, sobald die Dateien geöffnet sind.
+    running = true; // Cleared by the destructor. // Vom Destruktor gelöscht.
+    compactRequested = false; // No compaction requested. // Keine Verdichtung angefordert.
+    persistent = false; // Set by Open if the log can be written. // Von Open gesetzt, wenn das Log beschreibbar ist.
+    rebuilt = false; // Set by Open if the index had to be rebuilt. // Von Open gesetzt, wenn der Index neu gebaut werden musste.
+    storedCount = 0; // Counters of this process. // Zähler dieses Prozesses.
+    droppedCount = 0; // Counters of this process. // Zähler dieses Prozesses.
+    compactions = 0; // Counters of this process. // Zähler dieses Prozesses.
+    openMs = 0; // Timings, set by the writer thread. // Zeitmessungen, vom Writer-Thread gesetzt.
+    compactionMs = 0; // Timings, set by the writer thread. // Zeitmessungen, vom Writer-Thread gesetzt.
+    thread = std::thread(&ScoreStore::Run, this); // Starts after every member is initialized. // Startet, nachdem jedes Mitglied initialisiert ist.
+}
+
+ScoreStore::~ScoreStore() // Destructor that stops the writer thread. // Destruktor, der den Writer-Thread stoppt.
+{
+    running = false; // The thread stores what is still queued, closes the log and unmaps the index before it returns. // Der Thread speichert, was noch eingestellt ist, schließt das Log und gibt den Index frei, bevor er zurückkehrt.
+    thread.join(); // Waits for the writer thread. // Wartet auf den Writer-Thread.
+    delete heapIndex; // Frees the fallback index (nullptr if the file was mapped). // Gibt den Ersatzindex frei (nullptr, wenn die Datei abgebildet wurde).
+}
+
+bool ScoreStore::Submit(const char *tag, int score, long long time) // Queues a finished game from the game thread. // Stellt ein beendetes Spiel vom Spiel-Thread ein.
+{
+    ScoreEntry entry; // Sequence and checksum are filled in by the writer thread. // Sequenz und Prüfsumme werden vom Writer-Thread ausgefüllt.
+    memset(&entry, 0, sizeof(entry)); // Zeroes the padding, so checksums are reproducible. // Nullt die Auffüllung, damit Prüfsummen reproduzierbar sind.
+    entry.time = time; // Unix time of the game end. // Unix-Zeit des Spielendes.
+    entry.score = score; // Final score. // Endpunktzahl.
+    CopyTag(entry.tag, tag); // Player tag, NUL-padded. // Spielerkennung, mit NUL aufgefüllt.
+    if (!queue.Push(entry)) // A thousand games pending: drops instead of blocking the game. // Tausend Spiele ausstehend: verwirft, statt das Spiel zu blockieren.
+    {
+        droppedCount.fetch_add(1, std::memory_order_relaxed); // Counted for GetDropped. // Für GetDropped gezählt.
+        return false; // Not queued. // Nicht eingereiht.
+    }
+    return true; // Queued for the writer thread. // Für den Writer-Thread eingereiht.
+}
+
+int ScoreStore::GetTop(ScorePeriod period, long long now, ScoreEntry *out, int limit) // Copies a board from the index. // Kopiert eine Liste aus dem Index.
+{
+    if (!ready.load(std::memory_order_acquire) || period < 0 || period >= ScorePeriodCount) // Not open yet or no such period. // Noch nicht offen oder kein solcher Zeitraum.
+    {
+        return 0; // Empty board. // Leere Liste.
+    }
+    std::lock_guard<std::mutex> lock(indexMutex); // Held only for the copy; the writer holds it only while inserting. // Nur für die Kopie gehalten; der Writer hält sie nur beim Einfügen.
+    const ScoreBoard &board = index->boards[period]; // Board of the period. // Liste des Zeitraums.
+    if (period != ScoreAllTime && board.periodKey != PeriodKey(period, now)) // No game stored in the current period yet. // Noch kein Spiel im aktuellen Zeitraum gespeichert.
+    {
+        return 0; // Empty board. // Leere Liste.
+    }
+    int count = board.count < limit ? board.count : limit; // At most limit entries. // Höchstens limit Einträge.
+    if (count > 0) // Copies only if there is something to copy. // Kopiert nur, wenn etwas zu kopieren ist.
+    {
+        memcpy(out, board.entries, sizeof(ScoreEntry) * count); // Best-first copy of the board. // Kopie der Liste mit dem Besten zuerst.
+    }
+    return count > 0 ? count : 0; // Entries copied (never negative). // Kopierte Einträge (nie negativ).
+}
+
+int ScoreStore::Query(ScorePeriod period, const char *tag, long long now, ScoreEntry *out, int limit) // Scans the committed part of the log for one player's best games. // Scannt den festgeschriebenen Teil des Logs nach den besten Spielen eines Spielers.
+{
+    if (!ready.load(std::memory_order_acquire) || period < 0 || period >= ScorePeriodCount) // Not open yet or no such period. // Noch nicht offen oder kein solcher Zeitraum.
+    {
+        return 0; // No results. // Keine Ergebnisse.
+    }
+    limit = limit < SCORE_BOARD_SIZE ? limit : SCORE_BOARD_SIZE; // Compaction guarantees exact results up to the board size. // Die Verdichtung garantiert exakte Ergebnisse bis zur Listengröße.
+    char wanted[SCORE_TAG_LENGTH]; // Tag padded like the stored ones. // Kennung, aufgefüllt wie die gespeicherten.
+    CopyTag(wanted, tag); // Pads the wanted tag. // Füllt die gesuchte Kennung auf.
+    long long key = PeriodKey(period, now); // Period the results must fall into. // Zeitraum, in den die Ergebnisse fallen müssen.
+    std::lock_guard<std::mutex> lock(logMutex); // Keeps compaction from replacing the file during the scan. // Hält die Verdichtung davon ab, die Datei während des Scans zu ersetzen.
+    FILE *file = fopen(logPath.c_str(), "rb"); // Own handle; the writer keeps appending behind committedBytes. // Eigenes Handle; der Writer hängt hinter committedBytes weiter an.
+    if (file == nullptr) // No log yet. // Noch kein Log.
+    {
+        return 0; // No results. // Keine Ergebnisse.
+    }
+    unsigned long long remaining = (committedBytes.load(std::memory_order_acquire) - sizeof(ScoreLogHeader)) / sizeof(ScoreEntry); // Records flushed before the scan started. // Vor dem Scan geleerte Datensätze.
+    std::vector<ScoreEntry> chunk(scanChunk); // Read buffer, reused for every chunk. // Lesepuffer, für jeden Block wiederverwendet.
+    int count = 0; // Results so far. // Bisherige Ergebnisse.
+    SeekFile(file, sizeof(ScoreLogHeader), SEEK_SET); // Skips the log header. // Überspringt den Log-Kopf.
+    while (remaining > 0) // Reads the log chunk by chunk. // Liest das Log Block für Block.
+    {
+        size_t wantedRecords = remaining < (unsigned long long)scanChunk ? (size_t)remaining : (size_t)scanChunk; // Records in this chunk. // Datensätze in diesem Block.
+        size_t read = fread(chunk.data(), sizeof(ScoreEntry), wantedRecords, file); // Reads the chunk. // Liest den Block.
+        for (size_t i = 0; i < read; i++) // Checks every record. // Prüft jeden Datensatz.
+        {
+            const ScoreEntry &entry = chunk[i]; // Current record. // Aktueller Datensatz.
+            if ((tag == nullptr || memcmp(entry.tag, wanted, SCORE_TAG_LENGTH) == 0) && (period == ScoreAllTime || PeriodKey(period, entry.time) == key)) // nullptr tag = every player. // nullptr-Kennung = jeder Spieler.
+            {
+                count = InsertSorted(out, count, limit, entry); // Keeps the best limit matches. // Behält die besten limit Treffer.
+            }
+        }
+        if (read < wantedRecords) // File shorter than expected; keeps what was read. // Datei kürzer als erwartet; behält, was gelesen wurde.
+        {
+            break; // Stops the scan. // Beendet den Scan.
+        }
+        remaining -= read; // Records still to read. // Noch zu lesende Datensätze.
+    }
+    fclose(file); // Releases the own handle. // Gibt das eigene Handle frei.
+    return count; // Matches found. // Gefundene Treffer.
+}
+
+void ScoreStore::RequestCompaction() // Asks the writer thread to compact. // Bittet den Writer-Thread zu verdichten.
+{
+    compactRequested = true; // Picked up by the next Run iteration. // Von der nächsten Run-Iteration aufgenommen.
+}
+
+bool ScoreStore::IsReady() // Returns true once the files are open. // Gibt wahr zurück, sobald die Dateien geöffnet sind.
+{
+    return ready.load(std::memory_order_acquire); // Returns the ready flag. // Gibt die Bereit-Flagge zurück.
+}
+
+bool ScoreStore::IsPersistent() // Returns true if scores reach the disk. // Gibt wahr zurück, wenn Punktzahlen die Festplatte erreichen.
+{
+    return persistent.load(std::memory_order_relaxed); // Returns the persistent flag. // Gibt die Persistent-Flagge zurück.
+}
+
+long long ScoreStore::GetStoredCount() // Returns games stored by this process. // Gibt von diesem Prozess gespeicherte Spiele zurück.
+{
+    return storedCount.load(std::memory_order_acquire); // Returns the stored counter. // Gibt den Speicherzähler zurück.
+}
+
+long long ScoreStore::GetLogCount() // Returns the records in the log. // Gibt die Datensätze im Log zurück.
+{
+    return (long long)((committedBytes.load(std::memory_order_acquire) - sizeof(ScoreLogHeader)) / sizeof(ScoreEntry)); // Committed bytes without the header, in records. // Festgeschriebene Bytes ohne Kopf, in Datensätzen.
+}
+
+unsigned int ScoreStore::GetDropped() // Returns games dropped because the queue was full. // Gibt wegen voller Warteschlange verworfene Spiele zurück.
+{
+    return droppedCount.load(std::memory_order_relaxed); // Returns the drop counter. // Gibt den Verwerfzähler zurück.
+}
+
+unsigned int ScoreStore::GetCompactions() // Returns compactions done by this process. // Gibt von diesem Prozess durchgeführte Verdichtungen zurück.
+{
+    return compactions.load(std::memory_order_acquire); // Returns the compaction counter. // Gibt den Verdichtungszähler zurück.
+}
+
+double ScoreStore::GetOpenMs() // Returns the open and recovery time. // Gibt die Öffnungs- und Wiederherstellungszeit zurück.
+{
+    return openMs.load(std::memory_order_relaxed); // Returns the stored time. // Gibt die gespeicherte Zeit zurück.
+}
+
+double ScoreStore::GetCompactionMs() // Returns the last compaction time. // Gibt die letzte Verdichtungszeit zurück.
+{
+    return compactionMs.load(std::memory_order_relaxed); // Returns the stored time. // Gibt die gespeicherte Zeit zurück.
+}
+
+bool ScoreStore::WasRebuilt() // Returns true if the index was rebuilt at startup. // Gibt wahr zurück, wenn der Index beim Start neu gebaut wurde.
+{
+    return rebuilt.load(std::memory_order_relaxed); // Returns the rebuilt flag. // Gibt die Neubau-Flagge zurück.
+}
+
+bool ScoreStore::CreateLog(const char *path, unsigned long long generation, const ScoreEntry *entries, size_t count) // Writes header and records, then syncs. // Schreibt Kopf und Datensätze und synchronisiert dann.
+{
+    FILE *file = fopen(path, "wb"); // Creates or empties the file. // Erstellt oder leert die Datei.
+    if (file == nullptr) // Cannot create the file. // Kann die Datei nicht erstellen.
+    {
+        return false; // Nothing written. // Nichts geschrieben.
+    }
+    ScoreLogHeader header; // Identifies the format and the generation. // Identifiziert das Format und die Generation.
+    memset(&header, 0, sizeof(header)); // Zeroes the reserved fields. // Nullt die reservierten Felder.
+    memcpy(header.magic, "TLSCLOG1", 8); // Log magic. // Log-Kennung.
+    header.version = SCORE_VERSION; // Format version. // Formatversion.
+    header.generation = generation; // Ties the index to this log. // Bindet den Index an dieses Log.
+    bool written = fwrite(&header, sizeof(header), 1, file) == 1 && (count == 0 || fwrite(entries, sizeof(ScoreEntry), count, file) == count) && SyncFile(file); // Header, records and sync must all succeed. // Kopf, Datensätze und Synchronisierung müssen alle gelingen.
+    if (fclose(file) != 0) // Reports errors of the final flush. // Meldet Fehler des letzten Leerens.
+    {
+        written = false; // The file may be incomplete. // Die Datei ist möglicherweise unvollständig.
+    }
+    return written; // True if the whole file is on disk. // Wahr, wenn die ganze Datei auf der Festplatte ist.
+}
+
+void ScoreStore::ResetIndex(unsigned long long generation) // Empties the boards; the caller replays the log into them. // Leert die Listen; der Aufrufer spielt das Log in sie ein.
+{
+    memset(index, 0, sizeof(ScoreIndex)); // Clears every board. // Löscht jede Liste.
+    memcpy(index->magic, "TLSCIDX1", 8); // Index magic. // Index-Kennung.
+    index->version = SCORE_VERSION; // Format version. // Formatversion.
+    index->dirty = 1; // Stays dirty until the replay is complete. // Bleibt unsauber, bis das Einspielen fertig ist.
+    index->generation = generation; // Log generation the boards belong to. // Log-Generation, zu der die Listen gehören.
+    index->appliedBytes = sizeof(ScoreLogHeader); // Nothing of the log applied yet. // Noch nichts vom Log angewendet.
+}
+
+void ScoreStore::InsertIndexed(const ScoreEntry &entry) // Adds an entry to the board of every period. // Fügt einen Eintrag der Liste jedes Zeitraums hinzu.
+{
+    for (int period = 0; period < ScorePeriodCount; period++) // Every period has its own board. // Jeder Zeitraum hat eine eigene Liste.
+    {
+        ScoreBoard &board = index->boards[period]; // Board of the period. // Liste des Zeitraums.
+        long long key = PeriodKey((ScorePeriod)period, entry.time); // Period the game falls into. // Zeitraum, in den das Spiel fällt.
+        if (key < board.periodKey) // Game from an earlier period (clock set back): no current board shows it. // Spiel aus einem früheren Zeitraum (Uhr zurückgestellt): keine aktuelle Liste zeigt es.
+        {
+            continue; // Skips this board. // Überspringt diese Liste.
+        }
+        if (key > board.periodKey) // First game of a new day, week or month. // Erstes Spiel eines neuen Tages, einer neuen Woche oder eines neuen Monats.
+        {
+            board.periodKey = key; // Starts the new period. // Beginnt den neuen Zeitraum.
+            board.count = 0; // Empties the board. // Leert die Liste.
+        }
+        board.count = InsertSorted(board.entries, board.count, SCORE_BOARD_SIZE, entry); // Keeps the best SCORE_BOARD_SIZE games. // Behält die besten SCORE_BOARD_SIZE Spiele.
+    }
+    if (entry.sequence >= index->nextSequence) // Keeps sequences unique after a replay. // Hält Sequenzen nach einem Einspielen eindeutig.
+    {
+        index->nextSequence = entry.sequence + 1; // Next sequence after the highest seen. // Nächste Sequenz nach der höchsten gesehenen.
+    }
+}
+
+void ScoreStore::Open() // Opens the log and index and brings them back in line. // Öffnet Log und Index und bringt sie wieder in Einklang.
+{
+    auto start = std::chrono::steady_clock::now(); // Starts the open timer. // Startet den Öffnungs-Timer.
+    remove((logPath + ".tmp").c_str()); // Leftover of a compaction that did not finish; the old log is still complete. // Überrest einer nicht beendeten Verdichtung; das alte Log ist noch vollständig.
+    index = MapIndex(indexPath.c_str(), &mapping); // Maps the index file. // Bildet die Indexdatei ab.
+    bool mapped = index != nullptr; // False if the index lives on the heap. // Falsch, wenn der Index auf dem Heap liegt.
+    if (!mapped) // Read-only or full disk: keeps a working board in memory. // Schreibgeschützte oder volle Festplatte: behält eine funktionierende Liste im Speicher.
+    {
+        heapIndex = new ScoreIndex(); // Zeroed, so the magic check fails and the index is rebuilt. // Genullt, daher schlägt die Kennungsprüfung fehl und der Index wird neu gebaut.
+        index = heapIndex; // Used like the mapped index. // Wie der abgebildete Index verwendet.
+    }
+    bool indexKnown = memcmp(index->magic, "TLSCIDX1", 8) == 0 && index->version == SCORE_VERSION; // Index from an earlier run of this format. // Index aus einem früheren Lauf dieses Formats.
+
+    ScoreLogHeader header; // Header of the existing log. // Kopf des vorhandenen Logs.
+    log = fopen(logPath.c_str(), "rb+"); // Opens the existing log for reading and appending. // Öffnet das vorhandene Log zum Lesen und Anhängen.
+    bool logValid = log != nullptr && fread(&header, sizeof(header), 1, log) == 1 && memcmp(header.magic, "TLSCLOG1", 8) == 0 && header.version == SCORE_VERSION; // Readable header with the right magic and version. // Lesbarer Kopf mit richtiger Kennung und Version.
+    if (!logValid) // Missing, foreign or damaged log. // Fehlendes, fremdes oder beschädigtes Log.
+    {
+        if (log != nullptr) // Unreadable log: kept aside instead of overwritten. // Unlesbares Log: beiseitegelegt statt überschrieben.
+        {
+            fclose(log); // Releases the handle before the rename. // Gibt das Handle vor dem Umbenennen frei.
+            MoveOver(logPath.c_str(), (logPath + ".bad").c_str()); // Keeps the old log as .bad for inspection. // Behält das alte Log als .bad zur Untersuchung.
+        }
+        unsigned long long generation = indexKnown ? index->generation + 1 : 1; // Never matches the stale index. // Passt nie zum veralteten Index.
+        log = CreateLog(logPath.c_str(), generation, nullptr, 0) ? fopen(logPath.c_str(), "rb+") : nullptr; // Starts an empty log, or runs without one. // Beginnt ein leeres Log oder läuft ohne eines.
+        memset(&header, 0, sizeof(header)); // Header of the new log. // Kopf des neuen Logs.
+        header.generation = generation; // Generation the index is compared with. // Generation, mit der der Index verglichen wird.
+    }
+
+    unsigned long long fileBytes = 0; // Current log size. // Aktuelle Log-Größe.
+    if (log != nullptr && SeekFile(log, 0, SEEK_END)) // Finds the end of the log. // Findet das Ende des Logs.
+    {
+        long long size = TellFile(log); // Log size in bytes. // Log-Größe in Bytes.
+        fileBytes = size > (long long)sizeof(header) ? (unsigned long long)size : sizeof(header); // At least the header. // Mindestens der Kopf.
+    }
+    unsigned long long wholeBytes = sizeof(header) + (fileBytes - sizeof(header)) / sizeof(ScoreEntry) * sizeof(ScoreEntry); // Ignores a partial last record. // Ignoriert einen unvollständigen letzten Datensatz.
+    bool indexValid = indexKnown && index->dirty == 0 && index->generation == header.generation && index->appliedBytes >= sizeof(header) && index->appliedBytes <= wholeBytes && (index->appliedBytes - sizeof(header)) % sizeof(ScoreEntry) == 0; // Boards describe a prefix of this log. // Listen beschreiben einen Anfang dieses Logs.
+    if (!indexValid) // Crash during an update, new or foreign index, or a compacted log: replays the whole log once. // Absturz während einer Aktualisierung, neuer oder fremder Index oder ein verdichtetes Log: spielt das ganze Log einmal ein.
+    {
+        ResetIndex(header.generation); // Empty boards of this generation. // Leere Listen dieser Generation.
+        rebuilt = true; // Reported by WasRebuilt. // Von WasRebuilt gemeldet.
+    }
+    index->dirty = 1; // Marked until the replay below is complete. // Markiert, bis das Einspielen unten fertig ist.
+
+    unsigned long long validBytes = index->appliedBytes; // End of the records that passed the checksum. // Ende der Datensätze, die die Prüfsumme bestanden haben.
+    if (log != nullptr && validBytes < wholeBytes) // Only records written after the last index update are read. // Nur nach der letzten Indexaktualisierung geschriebene Datensätze werden gelesen.
+    {
+        std::vector<ScoreEntry> chunk(scanChunk); // Read buffer, reused for every chunk. // Lesepuffer, für jeden Block wiederverwendet.
+        SeekFile(log, (long long)validBytes, SEEK_SET); // First record the index has not seen. // Erster Datensatz, den der Index nicht gesehen hat.
+        bool torn = false; // Set at the first bad checksum. // Bei der ersten falschen Prüfsumme gesetzt.
+        while (!torn && validBytes < wholeBytes) // Reads the rest of the log chunk by chunk. // Liest den Rest des Logs Block für Block.
+        {
+            unsigned long long left = (wholeBytes - validBytes) / sizeof(ScoreEntry); // Whole records still to read. // Noch zu lesende ganze Datensätze.
+            size_t wanted = left < (unsigned long long)scanChunk ? (size_t)left : (size_t)scanChunk; // Records in this chunk. // Datensätze in diesem Block.
+            size_t read = fread(chunk.data(), sizeof(ScoreEntry), wanted, log); // Reads the chunk. // Liest den Block.
+            for (size_t i = 0; i < read && !torn; i++) // Checks and applies every record. // Prüft und wendet jeden Datensatz an.
+            {
+                if (chunk[i].checksum != Checksum(chunk[i])) // Torn write of a crash: everything from here on is dropped. // Zerrissener Schreibvorgang eines Absturzes: alles ab hier wird verworfen.
+                {
+                    torn = true; // Stops the replay. // Beendet das Einspielen.
+                    break;
+                }
+                InsertIndexed(chunk[i]); // Adds the game to the boards. // Fügt das Spiel den Listen hinzu.
+                index->sinceCompaction++; // Counts toward the next compaction. // Zählt zur nächsten Verdichtung.
+                validBytes += sizeof(ScoreEntry); // Record is valid. // Datensatz ist gültig.
+            }
+            if (read < wanted) // Read error or shorter file. // Lesefehler oder kürzere Datei.
+            {
+                break; // Stops the replay. // Beendet das Einspielen.
+            }
+        }
+    }
+    if (log != nullptr && validBytes < fileBytes) // Cuts off a partial or damaged tail, so appends continue after whole records. // Schneidet ein unvollständiges oder beschädigtes Ende ab, damit Anhänge nach ganzen Datensätzen weitergehen.
+    {
+        TruncateFile(log, (long long)validBytes); // Drops everything after the last valid record. // Verwirft alles nach dem letzten gültigen Datensatz.
+    }
+    if (log != nullptr) // Only with an open log. // Nur mit offenem Log.
+    {
+        SeekFile(log, 0, SEEK_END); // Appends go to the end (also switches the stream from reading to writing). // Anhänge gehen ans Ende (schaltet den Stream auch vom Lesen auf Schreiben um).
+    }
+    index->appliedBytes = validBytes; // The boards cover every valid record. // Die Listen decken jeden gültigen Datensatz ab.
+    index->dirty = 0; // Index is consistent again. // Index ist wieder konsistent.
+    committedBytes = validBytes; // Queries read up to here. // Abfragen lesen bis hierher.
+    persistent = mapped && log != nullptr; // Both files must be on disk to survive a restart. // Beide Dateien müssen auf der Festplatte sein, um einen Neustart zu überstehen.
+    openMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count(); // Stores the open time in milliseconds. // Speichert die Öffnungszeit in Millisekunden.
+}
+
+int ScoreStore::AppendQueued() // Moves queued games to the log in batches, one sync per batch. // Verschiebt eingestellte Spiele stapelweise ins Log, eine Synchronisation pro Stapel.
+{
+    ScoreEntry batch[256]; // Games written with one fwrite and one sync. // Mit einem fwrite und einer Synchronisation geschriebene Spiele.
+    int total = 0; // Games stored by this call. // Von diesem Aufruf gespeicherte Spiele.
+    while (true) // Until the queue is empty. // Bis die Warteschlange leer ist.
+    {
+        int count = 0; // Games in this batch. // Spiele in diesem Stapel.
+        while (count < 256 && queue.Pop(batch[count])) // Takes up to 256 games. // Nimmt bis zu 256 Spiele.
+        {
+            batch[count].sequence = index->nextSequence++; // Unique, increasing sequence number. // Eindeutige, steigende Sequenznummer.
+            batch[count].checksum = Checksum(batch[count]); // Checksum over the finished record. // Prüfsumme über den fertigen Datensatz.
+            count++; // Next slot in the batch. // Nächster Platz im Stapel.
+        }
+        if (count == 0) // Queue empty. // Warteschlange leer.
+        {
+            break; // Done. // Fertig.
+        }
+        bool written = log != nullptr && fwrite(batch, sizeof(ScoreEntry), count, log) == (size_t)count && SyncFile(log); // The log is the source of truth, so it is synced before the index changes. // Das Log ist die Quelle der Wahrheit, daher wird es vor der Indexänderung synchronisiert.
+        if (!written && log != nullptr) // Disk full or failing: removes the partial batch so the log stays whole; the boards still show the games. // Festplatte voll oder fehlerhaft: entfernt den unvollständigen Stapel, damit das Log ganz bleibt; die Listen zeigen die Spiele trotzdem.
+        {
+            TruncateFile(log, (long long)committedBytes.load()); // Cuts the log back to the last committed record. // Kürzt das Log auf den letzten festgeschriebenen Datensatz.
+            SeekFile(log, 0, SEEK_END); // Appends continue at the new end. // Anhänge gehen am neuen Ende weiter.
+            persistent = false; // Reported by IsPersistent. // Von IsPersistent gemeldet.
+        }
+        { // Scope of the index lock. // Bereich der Index-Sperre.
+            std::lock_guard<std::mutex> lock(indexMutex); // GetTop waits while the boards change. // GetTop wartet, während sich die Listen ändern.
+            index->dirty = 1; // A crash from here on leaves the index marked for a rebuild. // Ein Absturz ab hier hinterlässt den Index zum Neuaufbau markiert.
+            for (int i = 0; i < count; i++) // Adds every game of the batch. // Fügt jedes Spiel des Stapels hinzu.
+            {
+                InsertIndexed(batch[i]); // Adds the game to the boards. // Fügt das Spiel den Listen hinzu.
+            }
+            if (written) // Only games on disk count as applied. // Nur Spiele auf der Festplatte zählen als angewendet.
+            {
+                index->appliedBytes += sizeof(ScoreEntry) * count; // The boards cover the new records. // Die Listen decken die neuen Datensätze ab.
+                index->sinceCompaction += count; // Counts toward the next compaction. // Zählt zur nächsten Verdichtung.
+            }
+            index->dirty = 0; // Index is consistent again. // Index ist wieder konsistent.
+        }
+        if (written) // Only games on disk are visible to Query. // Nur Spiele auf der Festplatte sind für Query sichtbar.
+        {
+            committedBytes.fetch_add(sizeof(ScoreEntry) * count, std::memory_order_release); // Publishes the new records to Query. // Veröffentlicht die neuen Datensätze für Query.
+        }
+        storedCount.fetch_add(count, std::memory_order_release); // Counted even if the disk failed (the boards show them). // Gezählt, auch wenn die Festplatte versagt hat (die Listen zeigen sie).
+        revision.fetch_add(1, std::memory_order_relaxed); // The boards may have changed. // Die Listen können sich geändert haben.
+        total += count; // Adds the batch to the total. // Addiert den Stapel zur Summe.
+    }
+    return total; // Games stored by this call. // Von diesem Aufruf gespeicherte Spiele.
+}
+
+void ScoreStore::Compact() // Keeps the best SCORE_BOARD_SIZE games of each player per day and swaps the new log in. // Behält die besten SCORE_BOARD_SIZE Spiele jedes Spielers pro Tag und tauscht das neue Log ein.
+{
+    if (log == nullptr) // Nothing to compact without a log. // Ohne Log nichts zu verdichten.
+    {
+        return; // Skips the compaction. // Überspringt die Verdichtung.
+    }
+    auto start = std::chrono::steady_clock::now(); // Starts the compaction timer. // Startet den Verdichtungs-Timer.
+    {
+        std::lock_guard<std::mutex> lock(indexMutex); // Counts from now, so a failed attempt is not retried before compactEvery more games. // Zählt ab jetzt, damit ein fehlgeschlagener Versuch nicht vor compactEvery weiteren Spielen wiederholt wird.
+        index->sinceCompaction = 0; // Restarts the count. // Startet die Zählung neu.
+    }
+    unsigned long long end = committedBytes.load(std::memory_order_acquire); // Committed end of the log. // Festgeschriebenes Ende des Logs.
+    std::vector<ScoreEntry> entries((size_t)((end - sizeof(ScoreLogHeader)) / sizeof(ScoreEntry))); // Whole log; a compacted log plus compactEvery games. // Ganzes Log; ein verdichtetes Log plus compactEvery Spiele.
+    fflush(log); // Writes buffered appends before reading. // Schreibt gepufferte Anhänge vor dem Lesen.
+    SeekFile(log, sizeof(ScoreLogHeader), SEEK_SET); // First record. // Erster Datensatz.
+    size_t read = entries.empty() ? 0 : fread(entries.data(), sizeof(ScoreEntry), entries.size(), log); // Reads every committed record. // Liest jeden festgeschriebenen Datensatz.
+    SeekFile(log, 0, SEEK_END); // Back to appending. // Zurück zum Anhängen.
+    if (read != entries.size()) // Read error: keeps the old log. // Lesefehler: behält das alte Log.
+    {
+        return; // Skips the compaction. // Überspringt die Verdichtung.
+    }
+
+    std::sort(entries.begin(), entries.end(), [](const ScoreEntry &a, const ScoreEntry &b) { // Groups by player and day, best first inside a group. // Gruppiert nach Spieler und Tag, innerhalb einer Gruppe der Beste zuerst.
+        int tagOrder = memcmp(a.tag, b.tag, SCORE_TAG_LENGTH); // Player first. // Zuerst der Spieler.
+        if (tagOrder != 0) // Different players. // Verschiedene Spieler.
+        {
+            return tagOrder < 0; // Orders by tag. // Ordnet nach Kennung.
+        }
+        long long dayA = PeriodKey(ScoreToday, a.time); // UTC day of a. // UTC-Tag von a.
+        long long dayB = PeriodKey(ScoreToday, b.time); // UTC day of b. // UTC-Tag von b.
+        return dayA != dayB ? dayA < dayB : Better(a, b); // Then the day, then the better game. // Dann der Tag, dann das bessere Spiel.
+    });
+    size_t kept = 0; // Entries moved to the front. // An den Anfang verschobene Einträge.
+    int rank = 0; // Position inside the current group. // Position innerhalb der aktuellen Gruppe.
+    for (size_t i = 0; i < entries.size(); i++) // Walks the sorted entries once. // Durchläuft die sortierten Einträge einmal.
+    {
+        bool sameGroup = i > 0 && memcmp(entries[i].tag, entries[i - 1].tag, SCORE_TAG_LENGTH) == 0 && PeriodKey(ScoreToday, entries[i].time) == PeriodKey(ScoreToday, entries[i - 1].time); // Same player and day as the previous entry. // Gleicher Spieler und Tag wie der vorherige Eintrag.
+        rank = sameGroup ? rank + 1 : 0; // Rank inside the group. // Rang innerhalb der Gruppe.
+        if (rank < SCORE_BOARD_SIZE) // Anything below can never reach a board or a query of that size. // Alles darunter kann nie eine Liste oder Abfrage dieser Größe erreichen.
+        {
+            entries[kept++] = entries[i]; // Keeps the entry. // Behält den Eintrag.
+        }
+    }
+    entries.resize(kept); // Drops the rest. // Verwirft den Rest.
+    std::sort(entries.begin(), entries.end(), [](const ScoreEntry &a, const ScoreEntry &b) { // Back to insertion order, so a rebuild replays games as they happened. // Zurück in Einfügereihenfolge, damit ein Neuaufbau Spiele so einspielt, wie sie passiert sind.
+        return a.sequence < b.sequence; // Older games first. // Ältere Spiele zuerst.
+    });
+
+    std::string temporary = logPath + ".tmp"; // Written next to the log, so the rename stays on one file system. // Neben das Log geschrieben, damit das Umbenennen auf einem Dateisystem bleibt.
+    unsigned long long generation = index->generation + 1; // New generation, so a stale index is detected. // Neue Generation, damit ein veralteter Index erkannt wird.
+    if (!CreateLog(temporary.c_str(), generation, entries.data(), entries.size())) // Fully written and synced before it replaces anything. // Vollständig geschrieben und synchronisiert, bevor es etwas ersetzt.
+    {
+        remove(temporary.c_str()); // Deletes the partial file. // Löscht die unvollständige Datei.
+        return; // Keeps the old log. // Behält das alte Log.
+    }
+    unsigned long long compactedBytes = sizeof(ScoreLogHeader) + sizeof(ScoreEntry) * entries.size(); // Size of the compacted log. // Größe des verdichteten Logs.
+    { // Scope of the log lock. // Bereich der Log-Sperre.
+        std::lock_guard<std::mutex> lock(logMutex); // No Query may have the file open during the swap. // Keine Query darf die Datei während des Tauschs geöffnet haben.
+        fclose(log); // Releases the old log. // Gibt das alte Log frei.
+        bool replaced = MoveOver(temporary.c_str(), logPath.c_str()); // Puts the compacted log in place. // Setzt das verdichtete Log an seinen Platz.
+        log = fopen(logPath.c_str(), "rb+"); // The new log, or the untouched old one if the swap failed. // Das neue Log oder das unberührte alte, wenn der Tausch fehlschlug.
+        if (log != nullptr) // Reopened. // Wieder geöffnet.
+        {
+            SeekFile(log, 0, SEEK_END); // Appends continue at the end. // Anhänge gehen am Ende weiter.
+        }
+        if (!replaced) // Old log still in place. // Altes Log noch an seinem Platz.
+        {
+            remove(temporary.c_str()); // Deletes the unused file. // Löscht die unbenutzte Datei.
+            return; // Nothing more to update. // Nichts weiter zu aktualisieren.
+        }
+        committedBytes = compactedBytes; // Queries read the compacted log. // Abfragen lesen das verdichtete Log.
+    }
+    { // Scope of the index lock. // Bereich der Index-Sperre.
+        std::lock_guard<std::mutex> lock(indexMutex); // Boards are unchanged: every entry on them survived compaction. // Listen bleiben unverändert: jeder Eintrag darauf hat die Verdichtung überlebt.
+        index->dirty = 1; // A crash from here on rebuilds the index. // Ein Absturz ab hier baut den Index neu.
+        index->generation = generation; // Ties the index to the new log. // Bindet den Index an das neue Log.
+        index->appliedBytes = compactedBytes; // The boards cover the whole compacted log. // Die Listen decken das ganze verdichtete Log ab.
+        index->dirty = 0; // Index is consistent again. // Index ist wieder konsistent.
+    }
+    compactionMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count(); // Stores the compaction time in milliseconds. // Speichert die Verdichtungszeit in Millisekunden.
+    compactions.fetch_add(1, std::memory_order_release); // Counted for GetCompactions. // Für GetCompactions gezählt.
+}
+
+void ScoreStore::Run() // Writer thread body. // Rumpf des Writer-Threads.
+{
+    Open(); // Opens and recovers the files on this thread. // Öffnet und stellt die Dateien auf diesem Thread wieder her.
+    ready.store(true, std::memory_order_release); // Boards can be read from now on. // Listen können ab jetzt gelesen werden.
+    revision.fetch_add(1, std::memory_order_relaxed); // The boards may have changed. // Die Listen können sich geändert haben.
+    while (running.load(std::memory_order_relaxed)) // Runs until the destructor clears the flag. // Läuft, bis der Destruktor die Flagge löscht.
+    {
+        int appended = AppendQueued(); // Stores queued games. // Speichert eingestellte Spiele.
+        bool requested = compactRequested.exchange(false); // Takes a pending request. // Nimmt eine ausstehende Anforderung.
+        if (requested || index->sinceCompaction >= (unsigned int)compactEvery) // Requested or enough games since the last compaction. // Angefordert oder genug Spiele seit der letzten Verdichtung.
+        {
+            Compact(); // Shrinks the log. // Verkleinert das Log.
+        }
+        if (appended == 0) // Idle: a finished game waits at most this long. // Untätig: ein beendetes Spiel wartet höchstens so lange.
+        {
+            std::this_thread::sleep_for(std::chrono::milliseconds(10)); // Sleeps briefly. // Schläft kurz.
+        }
+    }
+    AppendQueued(); // Games submitted right before shutdown. // Direkt vor dem Beenden eingereichte Spiele.
+    if (log != nullptr) // Closes the log if it is open. // Schließt das Log, falls es offen ist.
+    {
+        fclose(log); // Writes and closes the log. // Schreibt und schließt das Log.
+        log = nullptr; // Closed. // Geschlossen.
+    }
+    if (index != heapIndex) // Only a mapped index is unmapped. // Nur ein abgebildeter Index wird freigegeben.
+    {
+        UnmapIndex(index, mapping); // Writes the index back and releases it. // Schreibt den Index zurück und gibt ihn frei.
+    }
+}
@@ -0,0 +1,145 @@
+/// High-Score Store Header
+///
+/// Header file declaring the ScoreStore, a persistent leaderboard made of an append-only score log and a memory-mapped top-K index. // Header-Datei, die den ScoreStore deklariert, eine persistente Bestenliste aus einem nur anhängenden Punkte-Log und einem speicherabgebildeten Top-K-Index.
+/// The game thread posts finished games into a lock-free queue; a writer thread appends them to the log, updates the index and compacts the log now and then. // Der Spiel-Thread stellt beendete Spiele in eine sperrfreie Warteschlange; ein Writer-Thread hängt sie an das Log an, aktualisiert den Index und verdichtet das Log ab und zu.
+///
+/// Usage:
+/// ```cpp
+/// #include "scores.h"
+///
+/// ScoreStore store("highscores", 65536);                     // highscores.log + highscores.idx, compacts every 65536 games
+/// store.Submit("NICK", 4200, (long long)time(nullptr));        // Never blocks; written by the store's thread
+/// ScoreEntry top[10];
+/// int count = store.GetTop(ScoreToday, time(nullptr), top, 10);        // Copied from the index, no file access
+/// int mine = store.Query(ScoreAllTime, "NICK", time(nullptr), top, 10); // Scans the log, not for every frame
+/// ```
+///
+/// EN: Startup maps the fixed-size index and checks only the log records written after it, so opening costs the same for a thousand or ten million games.
+/// DE: Der Start bildet den Index fester Größe ab und prüft nur die danach geschriebenen Log-Datensätze, daher kostet das Öffnen bei tausend oder zehn Millionen Spielen gleich viel.
+
+#pragma once // Ensures this header file is included only once during compilation. // Stellt sicher, dass diese Header-Datei nur einmal während der Kompilierung eingebunden wird.
+#include <atomic> // Includes atomics for the lock-free queue, the counters and the stop flag. // Inkludiert Atomics für die sperrfreie Warteschlange, die Zähler und die Stopp-Flagge.
+#include <cstdio> // Includes FILE for the log. // Inkludiert FILE für das Log.
+#include <mutex> // Includes mutex for index reads and log scans. // Inkludiert mutex für Index-Lesezugriffe und Log-Scans.
+#include <string> // Includes string for the file paths. // Inkludiert string für die Dateipfade.
+#include <thread> // Includes std::thread for the writer thread. // Inkludiert std::thread für den Writer-Thread.
+
+#define SCORE_VERSION 1 // Format version of log and index. // Formatversion von Log und Index.
+#define SCORE_BOARD_SIZE 100 // Entries per leaderboard (K); compaction keeps exactly what boards of this size can show. // Einträge pro Bestenliste (K); die Verdichtung behält genau das, was Listen dieser Größe zeigen können.
+#define SCORE_TAG_LENGTH 12 // Bytes per player tag, NUL-padded (up to 11 characters). // Bytes pro Spielerkennung, mit NUL aufgefüllt (bis zu 11 Zeichen).
+
+enum ScorePeriod // Leaderboards kept in the index; periods are UTC calendar units. // Im Index geführte Bestenlisten; Zeiträume sind UTC-Kalendereinheiten.
+{
+    ScoreAllTime = 0, // Every game ever stored. // Jedes jemals gespeicherte Spiel.
+    ScoreToday = 1, // Games of the current day. // Spiele des aktuellen Tages.
+    ScoreThisWeek = 2, // Games of the current week (Monday to Sunday). // Spiele der aktuellen Woche (Montag bis Sonntag).
+    ScoreThisMonth = 3, // Games of the current month. // Spiele des aktuellen Monats.
+    ScorePeriodCount = 4 // Number of periods. // Anzahl der Zeiträume.
+};
+
+struct ScoreEntry // One finished game; also the 32-byte log record. // Ein beendetes Spiel; zugleich der 32-Byte-Log-Datensatz.
+{
+    long long time; // Unix time in seconds when the game ended. // Unix-Zeit in Sekunden, als das Spiel endete.
+    int score; // Final score. // Endpunktzahl.
+    unsigned int sequence; // Insertion number, assigned by the store; breaks ties in favour of the earlier game. // Einfügenummer, vom Store vergeben; entscheidet Gleichstände zugunsten des früheren Spiels.
+    char tag[SCORE_TAG_LENGTH]; // Player tag. // Spielerkennung.
+    unsigned int checksum; // FNV-1a of the bytes above; a torn or garbage record fails it. // FNV-1a der Bytes darüber; ein zerrissener oder unsinniger Datensatz besteht ihn nicht.
+};
+
+struct ScoreLogHeader // First 64 bytes of the log file. // Erste 64 Bytes der Log-Datei.
+{
+    char magic[8]; // "TLSCLOG1". // "TLSCLOG1".
+    unsigned int version; // SCORE_VERSION. // SCORE_VERSION.
+    unsigned int reserved; // Zero. // Null.
+    unsigned long long generation; // Incremented by every compaction, so an index can tell which log it describes. // Bei jeder Verdichtung erhöht, damit ein Index erkennt, welches Log er beschreibt.
+    unsigned char padding[40]; // Zero. // Null.
+};
+
+struct ScoreBoard // One top-K leaderboard inside the index. // Eine Top-K-Bestenliste im Index.
+{
+    long long periodKey; // Day, week or month number the entries belong to (0 for all time). // Tages-, Wochen- oder Monatsnummer, zu der die Einträge gehören (0 für alle Zeiten).
+    int count; // Valid entries. // Gültige Einträge.
+    int reserved; // Zero. // Null.
+    ScoreEntry entries[SCORE_BOARD_SIZE]; // Best first. // Bester zuerst.
+};
+
+struct ScoreIndex // Layout of the memory-mapped index file (about 13 KB). // Layout der speicherabgebildeten Indexdatei (etwa 13 KB).
+{
+    char magic[8]; // "TLSCIDX1". // "TLSCIDX1".
+    unsigned int version; // SCORE_VERSION. // SCORE_VERSION.
+    unsigned int dirty; // 1 while the writer changes the boards; still 1 after a crash means rebuild. // 1, während der Writer die Listen ändert; nach einem Absturz noch 1 bedeutet Neuaufbau.
+    unsigned long long generation; // Log generation the boards were built from. // Log-Generation, aus der die Listen gebaut wurden.
+    unsigned long long appliedBytes; // Log bytes already in the boards; only records after this are checked at startup. // Bereits in den Listen enthaltene Log-Bytes; nur Datensätze danach werden beim Start geprüft.
+    unsigned int nextSequence; // Sequence of the next stored game. // Sequenz des nächsten gespeicherten Spiels.
+    unsigned int sinceCompaction; // Games appended since the last compaction. // Seit der letzten Verdichtung angehängte Spiele.
+    unsigned char padding[24]; // Zero. // Null.
+    ScoreBoard boards[ScorePeriodCount]; // One leaderboard per ScorePeriod. // Eine Bestenliste pro ScorePeriod.
+};
+
+class ScoreQueue // Lock-free ring buffer of finished games for one producer (game thread) and one consumer (writer thread). // Sperrfreier Ringpuffer beendeter Spiele für einen Produzenten (Spiel-Thread) und einen Konsumenten (Writer-Thread).
+{
+public: // Public interface accessible from outside the class. // Öffentliche Schnittstelle, die von außerhalb der Klasse zugänglich ist.
+    ScoreQueue(); // Constructor that starts with an empty ring. // Konstruktor, der mit einem leeren Ring beginnt.
+    bool Push(const ScoreEntry &entry); // Producer side: returns false if the ring is full. // Produzentenseite: gibt falsch zurück, wenn der Ring voll ist.
+    bool Pop(ScoreEntry &entry); // Consumer side: returns false if the ring is empty. // Konsumentenseite: gibt falsch zurück, wenn der Ring leer ist.
+
+private: // Private members accessible only within the class. // Private Mitglieder, die nur innerhalb der Klasse zugänglich sind.
+    static const unsigned int capacity = 1024; // Ring size (power of two); a cabinet ends a game every few minutes. // Ringgröße (Zweierpotenz); ein Automat beendet alle paar Minuten ein Spiel.
+    ScoreEntry entries[capacity]; // Ring storage. // Ringspeicher.
+    alignas(64) std::atomic<unsigned int> head; // Next slot to read, written only by the consumer (own cache line). // Nächster zu lesender Platz, nur vom Konsumenten geschrieben (eigene Cache-Line).
+    alignas(64) std::atomic<unsigned int> tail; // Next slot to write, written only by the producer (own cache line). // Nächster zu schreibender Platz, nur vom Produzenten geschrieben (eigene Cache-Line).
+};
+
+class ScoreStore // Declares the persistent leaderboard with its own writer thread. // Deklariert die persistente Bestenliste mit eigenem Writer-Thread.
+{
+public: // Public interface accessible from outside the class. // Öffentliche Schnittstelle, die von außerhalb der Klasse zugänglich ist.
+    ScoreStore(const char *path, int compactEvery); // Constructor that starts the writer thread, which opens <path>.log and maps <path>.idx; compacts after compactEvery new games. // Konstruktor, der den Writer-Thread startet, der <path>.log öffnet und <path>.idx abbildet; verdichtet nach compactEvery neuen Spielen.
+    ~ScoreStore(); // Destructor that stores every queued game, then stops the thread and unmaps the index. // Destruktor, der jedes eingestellte Spiel speichert, dann den Thread stoppt und den Index freigibt.
+    ScoreStore(const ScoreStore &) = delete; // Owns a thread and files and is not copied. // Besitzt einen Thread und Dateien und wird nicht kopiert.
+    ScoreStore &operator=(const ScoreStore &) = delete; // Owns a thread and files and is not copied. // Besitzt einen Thread und Dateien und wird nicht kopiert.
+    bool Submit(const char *tag, int score, long long time); // Queues a finished game from the game thread; never blocks, returns false if the queue is full. // Stellt ein beendetes Spiel vom Spiel-Thread ein; blockiert nie, gibt falsch zurück, wenn die Warteschlange voll ist.
+    int GetTop(ScorePeriod period, long long now, ScoreEntry *out, int limit); // Copies up to limit entries of a leaderboard from the index; empty until the store is ready. // Kopiert bis zu limit Einträge einer Bestenliste aus dem Index; leer, bis der Store bereit ist.
+    int Query(ScorePeriod period, const char *tag, long long now, ScoreEntry *out, int limit); // Best games of one player in a period, found by scanning the log (milliseconds for millions of games). // Beste Spiele eines Spielers in einem Zeitraum, gefunden durch Scannen des Logs (Millisekunden für Millionen Spiele).
+    void RequestCompaction(); // Asks the writer thread to compact at its next wake-up. // Bittet den Writer-Thread, beim nächsten Aufwachen zu verdichten.
+    bool IsReady(); // Returns true once the writer thread has opened the files. // Gibt wahr zurück, sobald der Writer-Thread die Dateien geöffnet hat.
+    bool IsPersistent(); // Returns true if the log is writable and the index is mapped. // Gibt wahr zurück, wenn das Log beschreibbar und der Index abgebildet ist.
+    long long GetStoredCount(); // Returns games stored by this process. // Gibt von diesem Prozess gespeicherte Spiele zurück.
+    long long GetLogCount(); // Returns games in the log (after compaction only those that can still rank). // Gibt Spiele im Log zurück (nach der Verdichtung nur die, die noch platziert werden können).
+    unsigned int GetDropped(); // Returns games dropped because the queue was full. // Gibt Spiele zurück, die verworfen wurden, weil die Warteschlange voll war.
+    unsigned int GetCompactions(); // Returns compactions done by this process. // Gibt von diesem Prozess durchgeführte Verdichtungen zurück.
+    double GetOpenMs(); // Returns the time the writer thread needed to open and recover the files. // Gibt die Zeit zurück, die der Writer-Thread zum Öffnen und Wiederherstellen der Dateien brauchte.
+    double GetCompactionMs(); // Returns the duration of the last compaction. // Gibt die Dauer der letzten Verdichtung zurück.
+    bool WasRebuilt(); // Returns true if the index had to be rebuilt from the whole log at startup. // Gibt wahr zurück, wenn der Index beim Start aus dem ganzen Log neu gebaut werden musste.
+    std::atomic<unsigned int> revision; // Incremented whenever the boards change (used to skip redundant redraws). // Bei jeder Änderung der Listen erhöht (zum Überspringen überflüssiger Neuzeichnungen).
+
+private: // Private members accessible only within the class. // Private Mitglieder, die nur innerhalb der Klasse zugänglich sind.
+    void Run(); // Writer thread body: open, append queued games, compact, close. // Rumpf des Writer-Threads: öffnen, eingestellte Spiele anhängen, verdichten, schließen.
+    void Open(); // Opens or creates the log, maps the index and recovers whatever a crash left behind. // Öffnet oder erstellt das Log, bildet den Index ab und stellt wieder her, was ein Absturz hinterlassen hat.
+    bool CreateLog(const char *path, unsigned long long generation, const ScoreEntry *entries, size_t count); // Writes a complete log file and syncs it to disk. // Schreibt eine vollständige Log-Datei und synchronisiert sie auf die Festplatte.
+    void ResetIndex(unsigned long long generation); // Empties the boards for a log generation. // Leert die Listen für eine Log-Generation.
+    void InsertIndexed(const ScoreEntry &entry); // Adds an entry to every board whose period it falls into. // Fügt einen Eintrag jeder Liste hinzu, in deren Zeitraum er fällt.
+    int AppendQueued(); // Writes all queued games to the log and the index; returns how many. // Schreibt alle eingestellten Spiele in das Log und den Index; gibt zurück, wie viele.
+    void Compact(); // Rewrites the log with only the games that can still appear on a leaderboard. // Schreibt das Log neu, nur mit den Spielen, die noch auf einer Bestenliste erscheinen können.
+    ScoreQueue queue; // Games from the game thread. // Spiele vom Spiel-Thread.
+    std::string logPath; // <path>.log. // <path>.log.
+    std::string indexPath; // <path>.idx. // <path>.idx.
+    int compactEvery; // Compaction threshold in new games. // Verdichtungsschwelle in neuen Spielen.
+    FILE *log; // Append handle of the log (used only on the writer thread). // Anhänge-Handle des Logs (nur auf dem Writer-Thread verwendet).
+    ScoreIndex *index; // Mapped index, or heapIndex if mapping failed. // Abgebildeter Index oder heapIndex, wenn das Abbilden fehlschlug.
+    ScoreIndex *heapIndex; // In-memory fallback, rebuilt at every start. // Fallback im Speicher, bei jedem Start neu gebaut.
+    void *mapping; // Platform handle of the mapping (Windows only). // Plattform-Handle der Abbildung (nur Windows).
+    std::mutex indexMutex; // Held briefly while boards are changed or copied. // Kurz gehalten, während Listen geändert oder kopiert werden.
+    std::mutex logMutex; // Held while Query scans the log and while compaction replaces it. // Gehalten, während Query das Log scannt und während die Verdichtung es ersetzt.
+    std::atomic<unsigned long long> committedBytes; // Log size covered by whole, flushed records; Query reads up to here. // Durch ganze, geleerte Datensätze abgedeckte Log-Größe; Query liest bis hierher.
+    std::atomic<bool> ready; // Set once Open finished. // Gesetzt, sobald Open fertig ist.
+    std::atomic<bool> running; // Cleared by the destructor to stop the thread. // Vom Destruktor gelöscht, um den Thread zu stoppen.
+    std::atomic<bool> compactRequested; // Set by RequestCompaction. // Von RequestCompaction gesetzt.
+    std::atomic<bool> persistent; // Log writable and index mapped. // Log beschreibbar und Index abgebildet.
+    std::atomic<bool> rebuilt; // Index was rebuilt at startup. // Index wurde beim Start neu gebaut.
+    std::atomic<long long> storedCount; // Games stored by this process. // Von diesem Prozess gespeicherte Spiele.
+    std::atomic<unsigned int> droppedCount; // Games lost to a full queue. // Durch eine volle Warteschlange verlorene Spiele.
+    std::atomic<unsigned int> compactions; // Compactions done by this process. // Von diesem Prozess durchgeführte Verdichtungen.
+    std::atomic<double> openMs; // Time spent in Open. // In Open verbrachte Zeit.
+    std::atomic<double> compactionMs; // Duration of the last compaction. // Dauer der letzten Verdichtung.
+    std::thread thread; // The writer thread (started last in the constructor). // Der Writer-Thread (im Konstruktor zuletzt gestartet).
+};
@@ -0,0 +1,178 @@
+/// Session Pool Implementation
+/// 
+/// Implements the SessionPool class for hosting many concurrent games of the C++ Tetris game. // Implementiert die SessionPool-Klasse zum Beherbergen vieler gleichzeitiger Spiele des C++ Tetris-Spiels.
+/// A session id is the slot index in the low 32 bits and the slot generation in the high 32 bits. // Eine Sitzungs-ID besteht aus dem Platzindex in den unteren 32 Bits und der Platzgeneration in den oberen 32 Bits.
+/// 
+/// Usage:
+/// ```cpp
+/// for (int i = 0; i < sessions.GetLiveCount(); i++) {
+///     sessions.Get(sessions.GetId(i))->action = SessionDown;
+/// }
+/// ```
+/// 
+/// EN: Memory only grows by whole slabs; destroyed slots are reused before a new slab is allocated.
+/// DE: Speicher wächst nur um ganze Slabs; zerstörte Plätze werden wiederverwendet, bevor ein neuer Slab angelegt wird.
+
+#include "sessions.h" // Includes the SessionPool class header file with declarations. // Inkludiert die SessionPool-Klassen-Header-Datei mit Deklarationen.
+
+SessionPool::SessionPool(int slabSize, int gravityTicks) // Constructor that stores the settings; the first slab is allocated by the first Create. // Konstruktor, der die Einstellungen speichert; der erste Slab wird beim ersten Create angelegt.
+{
+    this->slabSize = slabSize > 0 ? slabSize : 4096; // Sessions per slab (4096 sessions = 1 MB). // Sitzungen pro Slab (4096 Sitzungen = 1 MB).
+    this->gravityTicks = gravityTicks < 1 ? 1 : (gravityTicks > 255 ? 255 : gravityTicks); // 1-255: Session::gravityCounter is one byte, a larger value would never be reached and gravity would stop. // 1-255: Session::gravityCounter ist ein Byte, ein größerer Wert würde nie erreicht und die Schwerkraft würde stoppen.
+    freeHead = -1; // No slots yet. // Noch keine Plätze.
+    for (int kind = 0; kind < 3; kind++)
+    {
+        kindCounts[kind] = 0;
+    }
+}
+
+SessionPool::~SessionPool() // Destructor that frees all slabs. // Destruktor, der alle Slabs freigibt.
+{
+    for (Session *slab : slabs)
+    {
+        delete[] slab;
+    }
+}
+
+Session &SessionPool::Slot(int index) // Two-level lookup: slab, then slot. // Zweistufige Suche: Slab, dann Platz.
+{
+    return slabs[index / slabSize][index % slabSize];
+}
+
+void SessionPool::AddSlab() // Allocates a slab and pushes its slots onto the free list. // Legt einen Slab an und legt seine Plätze auf die Freiliste.
+{
+    int first = (int)slabs.size() * slabSize; // Global index of the first slot in the new slab. // Globaler Index des ersten Platzes im neuen Slab.
+    Session *slab = new Session[slabSize]; // One contiguous allocation for slabSize sessions. // Eine zusammenhängende Speicheranlage für slabSize Sitzungen.
+    for (int i = 0; i < slabSize; i++) // Links the slots in ascending order, ending at the previous free head. // Verkettet die Plätze aufsteigend und endet beim vorherigen Freilisten-Kopf.
+    {
+        slab[i].generation = 1; // First ids of this slot use generation 1, so no id is 0. // Erste IDs dieses Platzes verwenden Generation 1, daher ist keine ID 0.
+        slab[i].link = i + 1 < slabSize ? first + i + 1 : freeHead;
+        slab[i].active = false;
+    }
+    slabs.push_back(slab);
+    freeHead = first; // The new slab is used first. // Der neue Slab wird zuerst verwendet.
+    live.reserve(slabs.size() * (size_t)slabSize); // The live list never reallocates inside Create. // Die Live-Liste wird innerhalb von Create nie neu angelegt.
+}
+
+unsigned long long SessionPool::Create(unsigned long long seed, int kind) // Pops a free slot and starts a game in it. // Nimmt einen freien Platz und startet darin ein Spiel.
+{
+    if (freeHead < 0) // All slabs are full. // Alle Slabs sind voll.
+    {
+        AddSlab();
+    }
+    int index = freeHead; // Slot that receives the session. // Platz, der die Sitzung aufnimmt.
+    Session &session = Slot(index);
+    freeHead = session.link; // Pops the slot from the free list. // Nimmt den Platz von der Freiliste.
+    session.engine.Reset(seed); // Starts the game. // Startet das Spiel.
+    session.ticks = 0;
+    session.kind = (unsigned char)(kind >= 0 && kind < 3 ? kind : SessionBot);
+    session.action = SessionNoop;
+    session.gravityCounter = 0;
+    session.active = true;
+    session.link = (int)live.size(); // Position in the live list. // Position in der Live-Liste.
+    live.push_back(index);
+    kindCounts[session.kind]++;
+    return ((unsigned long long)session.generation << 32) | (unsigned int)index; // Generation and slot index. // Generation und Platzindex.
+}
+
+Session *SessionPool::Get(unsigned long long id) // Validates index and generation. // Prüft Index und Generation.
+{
+    unsigned int index = (unsigned int)id; // Slot index from the low bits. // Platzindex aus den unteren Bits.
+    if (index >= slabs.size() * (size_t)slabSize) // Never allocated. // Nie angelegt.
+    {
+        return nullptr;
+    }
+    Session &session = Slot((int)index);
+    if (!session.active || session.generation != (unsigned int)(id >> 32)) // Free slot or reused by a newer session. // Freier Platz oder von einer neueren Sitzung wiederverwendet.
+    {
+        return nullptr;
+    }
+    return &session;
+}
+
+bool SessionPool::Destroy(unsigned long long id) // Swap-removes from the live list and pushes the slot onto the free list. // Entfernt per Tausch aus der Live-Liste und legt den Platz auf die Freiliste.
+{
+    Session *session = Get(id); // Session being destroyed. // Zu zerstörende Sitzung.
+    if (session == nullptr)
+    {
+        return false;
+    }
+    int position = session->link; // Its position in the live list. // Ihre Position in der Live-Liste.
+    int last = live.back(); // Slot index moved into the gap. // In die Lücke verschobener Platzindex.
+    live[position] = last;
+    Slot(last).link = position;
+    live.pop_back();
+    kindCounts[session->kind]--;
+    session->active = false;
+    session->generation = session->generation + 1 != 0 ? session->generation + 1 : 1; // Invalidates old ids (skipping 0 keeps ids non-zero). // Macht alte IDs ungültig (das Überspringen von 0 hält IDs ungleich null).
+    session->link = freeHead; // Pushes the slot onto the free list. // Legt den Platz auf die Freiliste.
+    freeHead = (int)(unsigned int)id;
+    return true;
+}
+
+unsigned long long SessionPool::GetId(int liveIndex) // Rebuilds the id of a live session. // Baut die ID einer aktiven Sitzung neu auf.
+{
+    int index = live[liveIndex]; // Slot index. // Platzindex.
+    return ((unsigned long long)Slot(index).generation << 32) | (unsigned int)index;
+}
+
+void SessionPool::Step(WorkerPool &pool) // One tick for every live session. // Ein Tick für jede aktive Sitzung.
+{
+    pool.ParallelFor((int)live.size(), 256, [&](int begin, int end) {
+        for (int i = begin; i < end; i++) // Steps the sessions of this chunk. // Führt die Sitzungen dieses Blocks aus.
+        {
+            Session &session = Slot(live[i]); // Session stepped in this iteration. // In dieser Iteration ausgeführte Sitzung.
+            Engine &game = session.engine;
+            if (game.gameOver) // Finished sessions wait until the host destroys or restarts them. // Beendete Sitzungen warten, bis der Host sie zerstört oder neu startet.
+            {
+                session.action = SessionNoop;
+                continue;
+            }
+            switch (session.action) // Same mapping as the arrow keys in Game::HandleInput. // Gleiche Zuordnung wie die Pfeiltasten in Game::HandleInput.
+            {
+            case SessionLeft:
+                game.MoveBlockLeft();
+                break;
+            case SessionRight:
+                game.MoveBlockRight();
+                break;
+            case SessionRotate:
+                game.RotateBlock();
+                break;
+            case SessionDown:
+                game.MoveBlockDown();
+                game.UpdateScore(0, 1); // Soft-drop point, like KEY_DOWN. // Soft-Drop-Punkt, wie KEY_DOWN.
+                break;
+            default: // SessionNoop and unknown values. // SessionNoop und unbekannte Werte.
+                break;
+            }
+            session.action = SessionNoop; // Each input is applied once. // Jede Eingabe wird einmal angewendet.
+            if (++session.gravityCounter >= gravityTicks) // Gravity like EventTriggered(0.2) in main.cpp. // Schwerkraft wie EventTriggered(0.2) in main.cpp.
+            {
+                session.gravityCounter = 0;
+                game.MoveBlockDown();
+            }
+            session.ticks++;
+        }
+    });
+}
+
+int SessionPool::GetLiveCount() // Returns the number of live sessions. // Gibt die Anzahl aktiver Sitzungen zurück.
+{
+    return (int)live.size();
+}
+
+int SessionPool::GetKindCount(int kind) // Returns the number of live sessions of one kind. // Gibt die Anzahl aktiver Sitzungen einer Art zurück.
+{
+    return kind >= 0 && kind < 3 ? kindCounts[kind] : 0;
+}
+
+long long SessionPool::GetReservedBytes() // Slabs plus the live index list. // Slabs plus die Live-Indexliste.
+{
+    return (long long)slabs.size() * slabSize * (long long)sizeof(Session) + (long long)live.capacity() * (long long)sizeof(int) + (long long)slabs.capacity() * (long long)sizeof(Session *);
+}
+
+double SessionPool::GetBytesPerSession() // Includes unused slots of partly filled slabs. // Schließt ungenutzte Plätze teilweise gefüllter Slabs ein.
+{
+    return live.empty() ? 0.0 : (double)GetReservedBytes() / (double)live.size();
+}
@@ -0,0 +1,79 @@
+/// Session Pool Header
+/// 
+/// Header file declaring the SessionPool class, which hosts very large numbers of concurrent Tetris games in one process. // Header-Datei, die die SessionPool-Klasse deklariert, die sehr viele gleichzeitige Tetris-Spiele in einem Prozess beherbergt.
+/// Sessions are 256-byte records (an Engine plus bookkeeping) in fixed-size slabs, created and destroyed in O(1) through a free list. // Sitzungen sind 256-Byte-Datensätze (eine Engine plus Verwaltung) in Slabs fester Größe, in O(1) über eine Freiliste erzeugt und zerstört.
+/// 
+/// Usage:
+/// ```cpp
+/// #include "sessions.h"
+/// 
+/// SessionPool sessions = SessionPool(4096, 4);                 // 4096 sessions per slab, gravity every 4 ticks
+/// unsigned long long id = sessions.Create(seed, SessionRanked);
+/// sessions.Get(id)->action = SessionLeft;                      // Input for the next tick
+/// sessions.Step(pool);                                         // One tick of every live session
+/// sessions.Destroy(id);
+/// ```
+/// 
+/// EN: Shapes, Zobrist keys and the palette are static tables shared by all sessions; sessions never load audio or allocate per game.
+/// DE: Formen, Zobrist-Schlüssel und die Palette sind statische Tabellen, die alle Sitzungen teilen; Sitzungen laden nie Audio und legen pro Spiel keinen Speicher an.
+
+#pragma once // Ensures this header file is included only once during compilation. // Stellt sicher, dass diese Header-Datei nur einmal während der Kompilierung eingebunden wird.
+#include "engine.h" // Includes the compact headless game state stored per session. // Inkludiert den kompakten headless Spielzustand, der pro Sitzung gespeichert wird.
+#include "workers.h" // Includes the thread pool used for stepping. // Inkludiert den Thread-Pool, der für Schritte verwendet wird.
+#include <vector> // Includes vector for the slab list and the live list. // Inkludiert vector für die Slab-Liste und die Live-Liste.
+
+enum SessionKind // Purpose of a session, used for accounting only. // Zweck einer Sitzung, nur für die Abrechnung verwendet.
+{
+    SessionBot = 0, // Driven by a bot. // Von einem Bot gesteuert.
+    SessionPractice = 1, // Unranked player game. // Ungewertetes Spielerspiel.
+    SessionRanked = 2 // Ranked player game. // Gewertetes Spielerspiel.
+};
+
+enum SessionAction // Input applied at the next tick (same codes as TetrisEnvAction). // Bei der nächsten Ausführung angewendete Eingabe (gleiche Codes wie TetrisEnvAction).
+{
+    SessionNoop = 0, // No input. // Keine Eingabe.
+    SessionLeft = 1, // KEY_LEFT: MoveBlockLeft. // KEY_LEFT: MoveBlockLeft.
+    SessionRight = 2, // KEY_RIGHT: MoveBlockRight. // KEY_RIGHT: MoveBlockRight.
+    SessionRotate = 3, // KEY_UP: RotateBlock. // KEY_UP: RotateBlock.
+    SessionDown = 4 // KEY_DOWN: MoveBlockDown plus one soft-drop point. // KEY_DOWN: MoveBlockDown plus ein Soft-Drop-Punkt.
+};
+
+struct Session // One hosted game: 240 bytes of Engine plus 16 bytes of bookkeeping. // Ein beherbergtes Spiel: 240 Bytes Engine plus 16 Bytes Verwaltung.
+{
+    Engine engine; // Complete game state (byte cells, small piece records, own random generator). // Vollständiger Spielzustand (Byte-Zellen, kleine Blockdatensätze, eigener Zufallsgenerator).
+    unsigned int generation; // Bumped on every destroy, so stale ids are rejected. // Wird bei jeder Zerstörung erhöht, damit veraltete IDs abgelehnt werden.
+    int link; // Next free slot while free, position in the live list while live. // Nächster freier Platz im freien Zustand, Position in der Live-Liste im aktiven Zustand.
+    unsigned int ticks; // Ticks stepped since creation. // Seit der Erzeugung ausgeführte Ticks.
+    unsigned char kind; // SessionKind. // SessionKind.
+    unsigned char action; // SessionAction for the next tick, cleared after it is applied. // SessionAction für den nächsten Tick, nach dem Anwenden gelöscht.
+    unsigned char gravityCounter; // Ticks since the last gravity step. // Ticks seit dem letzten Schwerkraftschritt.
+    bool active; // True while the slot holds a live session. // Wahr, solange der Platz eine aktive Sitzung enthält.
+};
+
+class SessionPool // Declares the slab-backed session pool. // Deklariert den Slab-basierten Sitzungspool.
+{
+public: // Public interface accessible from outside the class. // Öffentliche Schnittstelle, die von außerhalb der Klasse zugänglich ist.
+    SessionPool(int slabSize, int gravityTicks); // Constructor taking the sessions per slab and the ticks between gravity steps (0.2 s in main.cpp; clamped to 1-255). // Konstruktor mit den Sitzungen pro Slab und den Ticks zwischen Schwerkraftschritten (0,2 s in main.cpp; auf 1-255 begrenzt).
+    ~SessionPool(); // Destructor that frees all slabs. // Destruktor, der alle Slabs freigibt.
+    SessionPool(const SessionPool &) = delete; // Slabs are owned and not copied. // Slabs sind im Besitz und werden nicht kopiert.
+    SessionPool &operator=(const SessionPool &) = delete; // Slabs are owned and not copied. // Slabs sind im Besitz und werden nicht kopiert.
+    unsigned long long Create(unsigned long long seed, int kind); // Starts a session in O(1) and returns its id (never 0). // Startet eine Sitzung in O(1) und gibt ihre ID zurück (nie 0).
+    bool Destroy(unsigned long long id); // Ends a session in O(1); returns false for unknown or stale ids. // Beendet eine Sitzung in O(1); gibt bei unbekannten oder veralteten IDs falsch zurück.
+    Session *Get(unsigned long long id); // Returns the session or nullptr for unknown or stale ids. // Gibt die Sitzung oder nullptr bei unbekannten oder veralteten IDs zurück.
+    unsigned long long GetId(int liveIndex); // Returns the id of the liveIndex-th live session (0 <= liveIndex < GetLiveCount()). // Gibt die ID der liveIndex-ten aktiven Sitzung zurück (0 <= liveIndex < GetLiveCount()).
+    void Step(WorkerPool &pool); // Applies each live session's action and gravity, in parallel over the live list. // Wendet Aktion und Schwerkraft jeder aktiven Sitzung an, parallel über die Live-Liste.
+    int GetLiveCount(); // Returns the number of live sessions. // Gibt die Anzahl aktiver Sitzungen zurück.
+    int GetKindCount(int kind); // Returns the number of live sessions of one kind. // Gibt die Anzahl aktiver Sitzungen einer Art zurück.
+    long long GetReservedBytes(); // Returns the bytes held by slabs and index lists. // Gibt die von Slabs und Indexlisten belegten Bytes zurück.
+    double GetBytesPerSession(); // Returns reserved bytes divided by live sessions. // Gibt reservierte Bytes geteilt durch aktive Sitzungen zurück.
+
+private: // Private members accessible only within the class. // Private Mitglieder, die nur innerhalb der Klasse zugänglich sind.
+    Session &Slot(int index); // Returns the slot with a global index (slab = index / slabSize). // Gibt den Platz mit einem globalen Index zurück (Slab = Index / slabSize).
+    void AddSlab(); // Allocates one more slab and links its slots into the free list. // Legt einen weiteren Slab an und verkettet seine Plätze in die Freiliste.
+    std::vector<Session *> slabs; // Slabs of slabSize sessions; never moved, so Session pointers stay valid. // Slabs mit slabSize Sitzungen; werden nie verschoben, daher bleiben Session-Zeiger gültig.
+    std::vector<int> live; // Dense list of live slot indices, stepped in order (swap-remove on destroy). // Dichte Liste aktiver Platzindizes, der Reihe nach ausgeführt (Tausch-Entfernen beim Zerstören).
+    int slabSize; // Sessions per slab. // Sitzungen pro Slab.
+    int gravityTicks; // Ticks between gravity steps (1-255, the range of Session::gravityCounter). // Ticks zwischen Schwerkraftschritten (1-255, der Bereich von Session::gravityCounter).
+    int freeHead; // First free slot, -1 if every slab is full. // Erster freier Platz, -1, wenn jeder Slab voll ist.
+    int kindCounts[3]; // Live sessions per SessionKind. // Aktive Sitzungen pro SessionKind.
+};
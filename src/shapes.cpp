@@ -0,0 +1,30 @@
+/// Block Shapes Implementation
+/// 
+/// Plain-array copies of the seven Tetris block definitions from blocks.cpp. // Einfache Array-Kopien der sieben Tetris-Blockdefinitionen aus blocks.cpp.
+/// Ids, rotation states and spawn offsets must stay identical to the block classes (keep both in sync). // IDs, Rotationszustände und Spawn-Offsets müssen mit den Block-Klassen identisch bleiben (beide synchron halten).
+/// 
+/// Usage:
+/// ```cpp
+/// int rotations = blockRotations[4]; // 1 (O-block)
+/// ShapeCell spawn = blockSpawn[3];   // {-1, 3} (I-block)
+/// ```
+/// 
+/// EN: Defines the shape tables used by the headless Engine without depending on raylib.
+/// DE: Definiert die Formtabellen, die von der headless Engine ohne Abhängigkeit von raylib verwendet werden.
+
+#include "shapes.h" // Includes the shape table declarations. // Inkludiert die Deklarationen der Formtabellen.
+
+const ShapeCell blockShapes[8][4][4] = { // Cell patterns per block id and rotation state. // Zellmuster pro Block-ID und Rotationszustand.
+    {{{0, 0}, {0, 0}, {0, 0}, {0, 0}}, {{0, 0}, {0, 0}, {0, 0}, {0, 0}}, {{0, 0}, {0, 0}, {0, 0}, {0, 0}}, {{0, 0}, {0, 0}, {0, 0}, {0, 0}}}, // 0: no block. // 0: kein Block.
+    {{{0, 2}, {1, 0}, {1, 1}, {1, 2}}, {{0, 1}, {1, 1}, {2, 1}, {2, 2}}, {{1, 0}, {1, 1}, {1, 2}, {2, 0}}, {{0, 0}, {0, 1}, {1, 1}, {2, 1}}}, // 1: LBlock. // 1: LBlock.
+    {{{0, 0}, {1, 0}, {1, 1}, {1, 2}}, {{0, 1}, {0, 2}, {1, 1}, {2, 1}}, {{1, 0}, {1, 1}, {1, 2}, {2, 2}}, {{0, 1}, {1, 1}, {2, 0}, {2, 1}}}, // 2: JBlock. // 2: JBlock.
+    {{{1, 0}, {1, 1}, {1, 2}, {1, 3}}, {{0, 2}, {1, 2}, {2, 2}, {3, 2}}, {{2, 0}, {2, 1}, {2, 2}, {2, 3}}, {{0, 1}, {1, 1}, {2, 1}, {3, 1}}}, // 3: IBlock. // 3: IBlock.
+    {{{0, 0}, {0, 1}, {1, 0}, {1, 1}}, {{0, 0}, {0, 1}, {1, 0}, {1, 1}}, {{0, 0}, {0, 1}, {1, 0}, {1, 1}}, {{0, 0}, {0, 1}, {1, 0}, {1, 1}}}, // 4: OBlock (only rotation 0 is used). // 4: OBlock (nur Rotation 0 wird verwendet).
+    {{{0, 1}, {0, 2}, {1, 0}, {1, 1}}, {{0, 1}, {1, 1}, {1, 2}, {2, 2}}, {{1, 1}, {1, 2}, {2, 0}, {2, 1}}, {{0, 0}, {1, 0}, {1, 1}, {2, 1}}}, // 5: SBlock. // 5: SBlock.
+    {{{0, 1}, {1, 0}, {1, 1}, {1, 2}}, {{0, 1}, {1, 1}, {1, 2}, {2, 1}}, {{1, 0}, {1, 1}, {1, 2}, {2, 1}}, {{0, 1}, {1, 0}, {1, 1}, {2, 1}}}, // 6: TBlock. // 6: TBlock.
+    {{{0, 0}, {0, 1}, {1, 1}, {1, 2}}, {{0, 2}, {1, 1}, {1, 2}, {2, 1}}, {{1, 0}, {1, 1}, {2, 1}, {2, 2}}, {{0, 1}, {1, 0}, {1, 1}, {2, 0}}}  // 7: ZBlock. // 7: ZBlock.
+};
+
+const int blockRotations[8] = {1, 4, 4, 4, 1, 4, 4, 4}; // The O-block defines a single rotation state. // Der O-Block definiert einen einzigen Rotationszustand.
+
+const ShapeCell blockSpawn[8] = {{0, 0}, {0, 3}, {0, 3}, {-1, 3}, {0, 4}, {0, 3}, {0, 3}, {0, 3}}; // I-block starts one row higher, O-block one column further right. // I-Block startet eine Reihe höher, O-Block eine Spalte weiter rechts.
@@ -0,0 +1,30 @@
+/// Block Shapes Header
+/// 
+/// Header file declaring raylib-free shape tables for the seven Tetris blocks of the C++ Tetris game. // Header-Datei, die raylib-freie Formtabellen für die sieben Tetris-Blöcke des C++ Tetris-Spiels deklariert.
+/// Holds the same cell patterns, rotation counts and spawn offsets as the block classes in blocks.cpp, as plain arrays. // Enthält dieselben Zellmuster, Rotationsanzahlen und Spawn-Offsets wie die Block-Klassen in blocks.cpp, als einfache Arrays.
+/// 
+/// Usage:
+/// ```cpp
+/// #include "shapes.h"
+/// 
+/// const ShapeCell *cells = blockShapes[3][1]; // I-block, rotation state 1
+/// for (int i = 0; i < 4; i++) {
+///     int row = cells[i].row + blockSpawn[3].row;
+///     int column = cells[i].column + blockSpawn[3].column;
+/// }
+/// ```
+/// 
+/// EN: Shared immutable data for headless simulations, which must not allocate a std::map per block.
+/// DE: Geteilte unveränderliche Daten für headless Simulationen, die keine std::map pro Block anlegen dürfen.
+
+#pragma once // Ensures this header file is included only once during compilation. // Stellt sicher, dass diese Header-Datei nur einmal während der Kompilierung eingebunden wird.
+
+struct ShapeCell // One cell of a block shape relative to the block's offset. // Eine Zelle einer Blockform relativ zum Offset des Blocks.
+{
+    signed char row; // Row relative to the block offset. // Reihe relativ zum Block-Offset.
+    signed char column; // Column relative to the block offset. // Spalte relativ zum Block-Offset.
+};
+
+extern const ShapeCell blockShapes[8][4][4]; // Cell patterns indexed by [block id][rotation state][cell] (id 0 unused). // Zellmuster indiziert nach [Block-ID][Rotationszustand][Zelle] (ID 0 unbenutzt).
+extern const int blockRotations[8]; // Number of rotation states per block id (1 for the O-block, 4 otherwise). // Anzahl der Rotationszustände pro Block-ID (1 für den O-Block, sonst 4).
+extern const ShapeCell blockSpawn[8]; // Initial row/column offset per block id (the Move() call in each block constructor). // Anfänglicher Reihen-/Spalten-Offset pro Block-ID (der Move()-Aufruf in jedem Block-Konstruktor).
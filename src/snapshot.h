@@ -0,0 +1,30 @@
+/// Board Snapshot Header
+/// 
+/// Header file declaring the BoardSnapshot structure for the C++ Tetris game. // Header-Datei, die die BoardSnapshot-Struktur für das C++ Tetris-Spiel deklariert.
+/// A plain copy of everything visible on the playing field that does not depend on raylib or a graphics context. // Eine einfache Kopie von allem Sichtbaren auf dem Spielfeld, die nicht von raylib oder einem Grafikkontext abhängt.
+/// 
+/// Usage:
+/// ```cpp
+/// #include "snapshot.h"
+/// 
+/// BoardSnapshot snapshot = game.GetSnapshot();
+/// int cellValue = snapshot.cells[19][0]; // Bottom-left cell (0 = empty, 1-7 = block id)
+/// ```
+/// 
+/// EN: Lets headless code (software renderer, tools) observe a game without touching raylib types.
+/// DE: Ermöglicht headless Code (Software-Renderer, Werkzeuge), ein Spiel zu beobachten, ohne raylib-Typen zu berühren.
+
+#pragma once // Ensures this header file is included only once during compilation. // Stellt sicher, dass diese Header-Datei nur einmal während der Kompilierung eingebunden wird.
+
+struct BoardSnapshot // Plain data copy of the visible game state (grid, current block, next block, score). // Einfache Datenkopie des sichtbaren Spielzustands (Raster, aktueller Block, nächster Block, Punktzahl).
+{
+    unsigned char cells[20][10]; // Locked cells of the 20x10 grid (0 = empty, 1-7 = block id). // Gesperrte Zellen des 20x10-Rasters (0 = leer, 1-7 = Block-ID).
+    int currentId; // Block id of the falling block (0 = no falling block). // Block-ID des fallenden Blocks (0 = kein fallender Block).
+    int currentRows[4]; // Grid rows of the four cells of the falling block. // Rasterreihen der vier Zellen des fallenden Blocks.
+    int currentColumns[4]; // Grid columns of the four cells of the falling block. // Rasterspalten der vier Zellen des fallenden Blocks.
+    int nextId; // Block id shown in the next-piece preview (0 = none). // Block-ID in der Vorschau des nächsten Stücks (0 = keiner).
+    int nextRows[4]; // Rows of the next block's cells at its spawn position (as returned by Block::GetCellPositions). // Reihen der Zellen des nächsten Blocks an seiner Spawn-Position (wie von Block::GetCellPositions geliefert).
+    int nextColumns[4]; // Columns of the next block's cells at its spawn position. // Spalten der Zellen des nächsten Blocks an seiner Spawn-Position.
+    int score; // Current score points. // Aktuelle Punktzahl.
+    bool gameOver; // True if the game has ended. // Wahr, wenn das Spiel beendet ist.
+};
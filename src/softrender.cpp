@@ -0,0 +1,204 @@
+/// Software Renderer Implementation
+/// 
+/// Pure-CPU rasterizer for the C++ Tetris game layout, independent of raylib and any GL context. // Reiner CPU-Rasterisierer für das C++ Tetris-Spiellayout, unabhängig von raylib und jedem GL-Kontext.
+/// Copies a prebuilt background (clear color, panels and empty grid) and then fills only the occupied cells. // Kopiert einen vorgefertigten Hintergrund (Löschfarbe, Panels und leeres Raster) und füllt dann nur die belegten Zellen.
+/// 
+/// Usage:
+/// ```cpp
+/// SoftRenderer renderer = SoftRenderer(1);
+/// renderer.Render(game.GetSnapshot(), rgba); // Same pixels as the window, except for text
+/// ```
+/// 
+/// EN: Cells and panels follow the GL pixel-center rule, so they match raylib's DrawRectangle/DrawRectangleRounded output; text (score, labels, GAME OVER) is not rasterized.
+/// DE: Zellen und Panels folgen der GL-Pixelmittelpunkt-Regel und stimmen daher mit der Ausgabe von raylibs DrawRectangle/DrawRectangleRounded überein; Text (Punktzahl, Beschriftungen, GAME OVER) wird nicht gerastert.
+
+#include "softrender.h" // Includes the SoftRenderer class header file with declarations. // Inkludiert die SoftRenderer-Klassen-Header-Datei mit Deklarationen.
+#include "palette.h" // Includes the RGBA table that colors.cpp builds the game colors from. // Inkludiert die RGBA-Tabelle, aus der colors.cpp die Spielfarben baut.
+#include <algorithm> // Includes std::min/max for clamping. // Inkludiert std::min/max zum Begrenzen.
+#include <cmath> // Includes cosf/sinf for the rounded panel corners. // Inkludiert cosf/sinf für die abgerundeten Panel-Ecken.
+#include <cstring> // Includes memcpy for copying the background frame, packing colors and writing pixels. // Inkludiert memcpy zum Kopieren des Hintergrund-Frames, Packen von Farben und Schreiben von Pixeln.
+
+static const int windowWidth = 500; // Window width used by main.cpp. // Von main.cpp verwendete Fensterbreite.
+static const int windowHeight = 620; // Window height used by main.cpp. // Von main.cpp verwendete Fensterhöhe.
+static const int gridOffset = 11; // Pixel offset of the grid from the window corner (as in Grid::Draw and Game::Draw). // Pixel-Offset des Rasters von der Fensterecke (wie in Grid::Draw und Game::Draw).
+static const int backgroundIndex = paletteDarkBlue; // Palette index of the clear color. // Palettenindex der Löschfarbe.
+static const int panelIndex = paletteLightBlue; // Palette index of the rounded panels. // Palettenindex der abgerundeten Panels.
+
+static bool InsideRoundedRect(float px, float py, float x, float y, float width, float height, float roundness, int segments) // Tests a sample point against the polygon raylib's DrawRectangleRounded emits. // Testet einen Abtastpunkt gegen das Polygon, das raylibs DrawRectangleRounded erzeugt.
+{
+    float radius = (width > height) ? (height * roundness) / 2 : (width * roundness) / 2; // Same corner radius formula as raylib. // Gleiche Eckradius-Formel wie raylib.
+    float centersX[4] = {x + radius, x + width - radius, x + width - radius, x + radius}; // Corner arc centers (top-left, top-right, bottom-right, bottom-left). // Mittelpunkte der Eckbögen (oben links, oben rechts, unten rechts, unten links).
+    float centersY[4] = {y + radius, y + radius, y + height - radius, y + height - radius}; // Matching y coordinates of the arc centers. // Zugehörige y-Koordinaten der Bogenmittelpunkte.
+    float angles[4] = {180.0f, 270.0f, 0.0f, 90.0f}; // Start angle of each corner arc in degrees. // Startwinkel jedes Eckbogens in Grad.
+    std::vector<float> vx, vy; // Vertices of the convex outline. // Eckpunkte des konvexen Umrisses.
+    for (int corner = 0; corner < 4; corner++) // Walks the four corners clockwise (screen coordinates). // Läuft die vier Ecken im Uhrzeigersinn ab (Bildschirmkoordinaten).
+    {
+        for (int i = 0; i <= segments; i++) // Emits segments + 1 points per arc like raylib's triangle fan. // Erzeugt segments + 1 Punkte pro Bogen wie raylibs Dreiecksfächer.
+        {
+            float angle = (angles[corner] + i * 90.0f / segments) * 3.14159265f / 180.0f; // Current arc angle in radians. // Aktueller Bogenwinkel im Bogenmaß.
+            vx.push_back(centersX[corner] + cosf(angle) * radius); // Arc point x. // Bogenpunkt x.
+            vy.push_back(centersY[corner] + sinf(angle) * radius); // Arc point y. // Bogenpunkt y.
+        }
+    }
+    for (size_t i = 0; i < vx.size(); i++) // Checks the point against every edge of the convex outline. // Prüft den Punkt gegen jede Kante des konvexen Umrisses.
+    {
+        size_t j = (i + 1) % vx.size(); // Index of the edge's end vertex. // Index des Endpunkts der Kante.
+        float cross = (vx[j] - vx[i]) * (py - vy[i]) - (vy[j] - vy[i]) * (px - vx[i]); // Side of the edge the point lies on. // Seite der Kante, auf der der Punkt liegt.
+        if (cross < 0) // Clockwise outline: a negative cross product means outside. // Umriss im Uhrzeigersinn: negatives Kreuzprodukt bedeutet außerhalb.
+        {
+            return false; // The point is outside this edge. // Der Punkt liegt außerhalb dieser Kante.
+        }
+    }
+    return true; // The point is inside all edges. // Der Punkt liegt innerhalb aller Kanten.
+}
+
+SoftRenderer::SoftRenderer(int downscale) // Constructor that computes the output size and prebuilds the background frames. // Konstruktor, der die Ausgabegröße berechnet und die Hintergrund-Frames vorbaut.
+{
+    this->downscale = downscale < 1 ? 1 : downscale; // Stores the downscale factor (at least 1). // Speichert den Verkleinerungsfaktor (mindestens 1).
+    cellSize = 30; // Same cell size as Grid and Block. // Gleiche Zellgröße wie Grid und Block.
+    width = ToOutput(windowWidth); // Output width covering every sampled window column. // Ausgabebreite, die jede abgetastete Fensterspalte abdeckt.
+    height = ToOutput(windowHeight); // Output height covering every sampled window row. // Ausgabehöhe, die jede abgetastete Fensterreihe abdeckt.
+    for (int i = 0; i < 10; i++) // Prepares both color tables from the palette. // Bereitet beide Farbtabellen aus der Palette vor.
+    {
+        memcpy(&rgbaColors[i], paletteRgba[i], 4); // Packs R, G, B, A in memory byte order (endian-independent). // Packt R, G, B, A in Speicher-Byte-Reihenfolge (endian-unabhängig).
+        indexColors[i] = (unsigned char)i; // Indexed output writes the palette index itself. // Indizierte Ausgabe schreibt den Palettenindex selbst.
+    }
+    BuildBackground(); // Rasterizes the static parts of the frame once. // Rastert die statischen Teile des Frames einmalig.
+}
+
+int SoftRenderer::GetWidth() // Returns the output width. // Gibt die Ausgabebreite zurück.
+{
+    return width; // Returns the stored width. // Gibt die gespeicherte Breite zurück.
+}
+
+int SoftRenderer::GetHeight() // Returns the output height. // Gibt die Ausgabehöhe zurück.
+{
+    return height; // Returns the stored height. // Gibt die gespeicherte Höhe zurück.
+}
+
+int SoftRenderer::ToOutput(int coordinate) // Maps a window coordinate to an output pixel index (rounding up). // Bildet eine Fensterkoordinate auf einen Ausgabepixelindex ab (aufrunden).
+{
+    return (coordinate + downscale - 1) / downscale; // Output pixel u samples window pixel u * downscale, so the first covered u is ceil(coordinate / downscale). // Ausgabepixel u tastet Fensterpixel u * downscale ab, daher ist das erste abgedeckte u gleich ceil(coordinate / downscale).
+}
+
+void SoftRenderer::BuildBackground() // Builds the static frame: clear color, two rounded panels and the empty grid. // Baut den statischen Frame: Löschfarbe, zwei abgerundete Panels und das leere Raster.
+{
+    backgroundIndexed.assign((size_t)width * height, (unsigned char)backgroundIndex); // Clears with darkBlue like ClearBackground(darkBlue). // Löscht mit darkBlue wie ClearBackground(darkBlue).
+    for (int v = 0; v < height; v++) // Iterates over output rows. // Iteriert über Ausgabereihen.
+    {
+        for (int u = 0; u < width; u++) // Iterates over output columns. // Iteriert über Ausgabespalten.
+        {
+            float px = u * downscale + 0.5f; // Pixel center x of the sampled window pixel. // Pixelmittelpunkt x des abgetasteten Fensterpixels.
+            float py = v * downscale + 0.5f; // Pixel center y of the sampled window pixel. // Pixelmittelpunkt y des abgetasteten Fensterpixels.
+            if (InsideRoundedRect(px, py, 320, 55, 170, 60, 0.3f, 6) || InsideRoundedRect(px, py, 320, 215, 170, 180, 0.3f, 6)) // Score panel and next-piece panel from main.cpp. // Punkte-Panel und Vorschau-Panel aus main.cpp.
+            {
+                backgroundIndexed[(size_t)v * width + u] = (unsigned char)panelIndex; // Paints the panel color. // Malt die Panel-Farbe.
+            }
+        }
+    }
+    for (int row = 0; row < 20; row++) // Iterates over all grid rows. // Iteriert über alle Rasterreihen.
+    {
+        for (int column = 0; column < 10; column++) // Iterates over all grid columns. // Iteriert über alle Rasterspalten.
+        {
+            FillRect(backgroundIndexed.data(), column * cellSize + gridOffset, row * cellSize + gridOffset, cellSize - 1, cellSize - 1, (unsigned char)0); // Empty cell in darkGrey, same rectangle as Grid::Draw. // Leere Zelle in darkGrey, gleiches Rechteck wie Grid::Draw.
+        }
+    }
+    backgroundRgba.resize(backgroundIndexed.size()); // Allocates the RGBA version of the background. // Reserviert die RGBA-Version des Hintergrunds.
+    for (size_t i = 0; i < backgroundIndexed.size(); i++) // Expands indices to packed colors. // Erweitert Indizes zu gepackten Farben.
+    {
+        backgroundRgba[i] = rgbaColors[backgroundIndexed[i]]; // Looks up the packed RGBA color. // Schlägt die gepackte RGBA-Farbe nach.
+    }
+}
+
+template <typename Pixel>
+void SoftRenderer::FillRect(unsigned char *out, int x, int y, int width, int height, Pixel color) // Fills all output pixels whose sample point lies inside the window rectangle. // Füllt alle Ausgabepixel, deren Abtastpunkt im Fensterrechteck liegt.
+{
+    int u0 = std::max(0, ToOutput(x)); // First covered output column. // Erste abgedeckte Ausgabespalte.
+    int u1 = std::min(this->width, ToOutput(x + width)); // One past the last covered output column. // Eins nach der letzten abgedeckten Ausgabespalte.
+    int v0 = std::max(0, ToOutput(y)); // First covered output row. // Erste abgedeckte Ausgabereihe.
+    int v1 = std::min(this->height, ToOutput(y + height)); // One past the last covered output row. // Eins nach der letzten abgedeckten Ausgabereihe.
+    if (u0 >= u1) // Nothing to fill horizontally (rectangle collapsed by downscaling or clipped). // Horizontal nichts zu füllen (Rechteck durch Verkleinerung kollabiert oder abgeschnitten).
+    {
+        return; // Skips empty spans. // Überspringt leere Spannen.
+    }
+    for (int v = v0; v < v1; v++) // Fills one horizontal span per covered row. // Füllt eine horizontale Spanne pro abgedeckter Reihe.
+    {
+        unsigned char *span = out + ((size_t)v * this->width + u0) * sizeof(Pixel); // First byte of the span. // Erstes Byte der Spanne.
+        for (int u = 0; u < u1 - u0; u++) // Fixed-size memcpy compiles to one store per pixel and needs no alignment. // memcpy fester Größe wird zu einem Speicherbefehl pro Pixel kompiliert und braucht keine Ausrichtung.
+        {
+            memcpy(span + (size_t)u * sizeof(Pixel), &color, sizeof(Pixel));
+        }
+    }
+}
+
+template <typename Pixel>
+void SoftRenderer::DrawBoard(const BoardSnapshot &board, unsigned char *out, const Pixel *colors) // Draws the dynamic parts of the frame on top of the copied background. // Zeichnet die dynamischen Teile des Frames über den kopierten Hintergrund.
+{
+    for (int row = 0; row < 20; row++) // Iterates over grid rows. // Iteriert über Rasterreihen.
+    {
+        for (int column = 0; column < 10; column++) // Iterates over grid columns. // Iteriert über Rasterspalten.
+        {
+            int cellValue = board.cells[row][column]; // Block id stored in this cell. // In dieser Zelle gespeicherte Block-ID.
+            if (cellValue != 0) // Empty cells are already part of the background. // Leere Zellen sind bereits Teil des Hintergrunds.
+            {
+                FillRect(out, column * cellSize + gridOffset, row * cellSize + gridOffset, cellSize - 1, cellSize - 1, colors[cellValue]); // Same rectangle as Grid::Draw. // Gleiches Rechteck wie Grid::Draw.
+            }
+        }
+    }
+    if (board.currentId != 0) // Draws the falling block if there is one. // Zeichnet den fallenden Block, falls vorhanden.
+    {
+        for (int i = 0; i < 4; i++) // Iterates over the four cells of the block. // Iteriert über die vier Zellen des Blocks.
+        {
+            FillRect(out, board.currentColumns[i] * cellSize + gridOffset, board.currentRows[i] * cellSize + gridOffset, cellSize - 1, cellSize - 1, colors[board.currentId]); // Same rectangle as currentBlock.Draw(11, 11). // Gleiches Rechteck wie currentBlock.Draw(11, 11).
+        }
+    }
+    if (board.nextId != 0) // Draws the next-piece preview if there is one. // Zeichnet die Vorschau des nächsten Stücks, falls vorhanden.
+    {
+        int offsetX = 270; // Default preview offset from Game::Draw. // Standard-Vorschau-Offset aus Game::Draw.
+        int offsetY = 270; // Default preview offset from Game::Draw. // Standard-Vorschau-Offset aus Game::Draw.
+        if (board.nextId == 3) // I-block preview position. // Vorschauposition des I-Blocks.
+        {
+            offsetX = 255; // Same as nextBlock.Draw(255, 290). // Gleich wie nextBlock.Draw(255, 290).
+            offsetY = 290;
+        }
+        else if (board.nextId == 4) // O-block preview position. // Vorschauposition des O-Blocks.
+        {
+            offsetX = 255; // Same as nextBlock.Draw(255, 280). // Gleich wie nextBlock.Draw(255, 280).
+            offsetY = 280;
+        }
+        for (int i = 0; i < 4; i++) // Iterates over the four preview cells. // Iteriert über die vier Vorschauzellen.
+        {
+            FillRect(out, board.nextColumns[i] * cellSize + offsetX, board.nextRows[i] * cellSize + offsetY, cellSize - 1, cellSize - 1, colors[board.nextId]); // Same rectangle as Block::Draw. // Gleiches Rechteck wie Block::Draw.
+        }
+    }
+}
+
+void SoftRenderer::Render(const BoardSnapshot &board, unsigned char *rgba) // Renders an RGBA8 frame into a caller buffer of any alignment. // Rendert einen RGBA8-Frame in einen Puffer des Aufrufers mit beliebiger Ausrichtung.
+{
+    memcpy(rgba, backgroundRgba.data(), backgroundRgba.size() * sizeof(unsigned int)); // Starts from the prebuilt background. // Beginnt mit dem vorgefertigten Hintergrund.
+    DrawBoard(board, rgba, rgbaColors); // Adds occupied cells and both blocks; pixels are written bytewise through memcpy. // Fügt belegte Zellen und beide Blöcke hinzu; Pixel werden byteweise über memcpy geschrieben.
+}
+
+void SoftRenderer::RenderIndexed(const BoardSnapshot &board, unsigned char *indices) // Renders a palette-indexed frame into a caller buffer. // Rendert einen palettenindizierten Frame in einen Puffer des Aufrufers.
+{
+    memcpy(indices, backgroundIndexed.data(), backgroundIndexed.size()); // Starts from the prebuilt background. // Beginnt mit dem vorgefertigten Hintergrund.
+    DrawBoard(board, indices, indexColors); // Adds occupied cells and both blocks. // Fügt belegte Zellen und beide Blöcke hinzu.
+}
+
+void SoftRenderer::RenderCells(const BoardSnapshot &board, unsigned char *cells) // Writes the 20x10 grid as one block id per byte, including the falling block. // Schreibt das 20x10-Raster als eine Block-ID pro Byte, einschließlich des fallenden Blocks.
+{
+    memcpy(cells, board.cells, sizeof(board.cells)); // Copies the locked cells. // Kopiert die gesperrten Zellen.
+    if (board.currentId == 0) // No falling block to merge. // Kein fallender Block zum Einfügen.
+    {
+        return; // The locked cells are the whole observation. // Die gesperrten Zellen sind die gesamte Beobachtung.
+    }
+    for (int i = 0; i < 4; i++) // Merges the four cells of the falling block. // Fügt die vier Zellen des fallenden Blocks ein.
+    {
+        int row = board.currentRows[i]; // Row of this cell. // Reihe dieser Zelle.
+        int column = board.currentColumns[i]; // Column of this cell. // Spalte dieser Zelle.
+        if (row >= 0 && row < 20 && column >= 0 && column < 10) // Ignores cells above or beside the grid. // Ignoriert Zellen über oder neben dem Raster.
+        {
+            cells[row * 10 + column] = (unsigned char)board.currentId; // Writes the block id. // Schreibt die Block-ID.
+        }
+    }
+}
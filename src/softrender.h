@@ -0,0 +1,49 @@
+/// Software Renderer Header
+/// 
+/// Header file declaring the SoftRenderer class, a pure-CPU renderer for the C++ Tetris game. // Header-Datei, die die SoftRenderer-Klasse deklariert, einen reinen CPU-Renderer für das C++ Tetris-Spiel.
+/// Rasterizes the same layout as main.cpp (30-px cells, 11-px grid offset, score and next-piece panels) into caller-provided buffers. // Rastert dasselbe Layout wie main.cpp (30-px-Zellen, 11-px-Raster-Offset, Punkte- und Vorschau-Panels) in vom Aufrufer bereitgestellte Puffer.
+/// 
+/// Usage:
+/// ```cpp
+/// #include "softrender.h"
+/// 
+/// SoftRenderer renderer = SoftRenderer(1);           // Full 500x620 resolution
+/// std::vector<unsigned char> rgba(renderer.GetWidth() * renderer.GetHeight() * 4);
+/// renderer.Render(snapshot, rgba.data());            // RGBA8, pixel-comparable to the window
+/// 
+/// SoftRenderer small = SoftRenderer(5);              // 100x124 downscaled observation
+/// small.RenderIndexed(snapshot, indices);            // One palette index per pixel
+/// SoftRenderer::RenderCells(snapshot, cells);        // One byte per grid cell (20x10)
+/// ```
+/// 
+/// EN: Needs no window, GL context or raylib library, so observations can be produced on GPU-less servers.
+/// DE: Benötigt kein Fenster, keinen GL-Kontext und keine raylib-Bibliothek, sodass Beobachtungen auf Servern ohne GPU erzeugt werden können.
+
+#pragma once // Ensures this header file is included only once during compilation. // Stellt sicher, dass diese Header-Datei nur einmal während der Kompilierung eingebunden wird.
+#include <vector> // Includes the standard vector container for the prebuilt background frames. // Inkludiert den Standard-Vektor-Container für die vorgefertigten Hintergrund-Frames.
+#include "snapshot.h" // Includes the raylib-free BoardSnapshot structure that is rendered. // Inkludiert die raylib-freie BoardSnapshot-Struktur, die gerendert wird.
+
+class SoftRenderer // Declares the SoftRenderer class that draws game frames into memory buffers. // Deklariert die SoftRenderer-Klasse, die Spiel-Frames in Speicherpuffer zeichnet.
+{
+public: // Public interface accessible from outside the class. // Öffentliche Schnittstelle, die von außerhalb der Klasse zugänglich ist.
+    SoftRenderer(int downscale); // Constructor taking an integer downscale factor (1 = full 500x620 window resolution). // Konstruktor mit ganzzahligem Verkleinerungsfaktor (1 = volle Fensterauflösung 500x620).
+    int GetWidth(); // Returns the output width in pixels (500 / downscale, rounded up). // Gibt die Ausgabebreite in Pixeln zurück (500 / Verkleinerung, aufgerundet).
+    int GetHeight(); // Returns the output height in pixels (620 / downscale, rounded up). // Gibt die Ausgabehöhe in Pixeln zurück (620 / Verkleinerung, aufgerundet).
+    void Render(const BoardSnapshot &board, unsigned char *rgba); // Renders an RGBA8 frame (width * height * 4 bytes). // Rendert einen RGBA8-Frame (Breite * Höhe * 4 Bytes).
+    void RenderIndexed(const BoardSnapshot &board, unsigned char *indices); // Renders a palette-indexed frame (width * height bytes, indices into paletteRgba from palette.h). // Rendert einen palettenindizierten Frame (Breite * Höhe Bytes, Indizes in paletteRgba aus palette.h).
+    static void RenderCells(const BoardSnapshot &board, unsigned char *cells); // Writes 200 bytes, one block id per grid cell with the falling block merged in. // Schreibt 200 Bytes, eine Block-ID pro Rasterzelle mit eingefügtem fallendem Block.
+
+private: // Private members accessible only within the class. // Private Mitglieder, die nur innerhalb der Klasse zugänglich sind.
+    template <typename Pixel> void DrawBoard(const BoardSnapshot &board, unsigned char *out, const Pixel *colors); // Draws grid cells, falling block and next block into a byte buffer of sizeof(Pixel)-byte pixels. // Zeichnet Rasterzellen, fallenden Block und nächsten Block in einen Bytepuffer mit Pixeln von sizeof(Pixel) Bytes.
+    template <typename Pixel> void FillRect(unsigned char *out, int x, int y, int width, int height, Pixel color); // Fills a rectangle given in window coordinates, mapped to the output resolution. // Füllt ein in Fensterkoordinaten gegebenes Rechteck, abgebildet auf die Ausgabeauflösung.
+    void BuildBackground(); // Prebuilds the static background (clear color and rounded panels) once. // Baut den statischen Hintergrund (Löschfarbe und abgerundete Panels) einmalig vor.
+    int ToOutput(int coordinate); // Maps a window coordinate to the first output pixel whose sample point is at or after it. // Bildet eine Fensterkoordinate auf das erste Ausgabepixel ab, dessen Abtastpunkt bei oder nach ihr liegt.
+    int downscale; // Integer downscale factor (output pixel (u, v) samples window pixel (u * downscale, v * downscale)). // Ganzzahliger Verkleinerungsfaktor (Ausgabepixel (u, v) tastet Fensterpixel (u * downscale, v * downscale) ab).
+    int width; // Output width in pixels. // Ausgabebreite in Pixeln.
+    int height; // Output height in pixels. // Ausgabehöhe in Pixeln.
+    int cellSize; // Size of each grid cell in window pixels (30, like Grid and Block). // Größe jeder Rasterzelle in Fensterpixeln (30, wie Grid und Block).
+    std::vector<unsigned char> backgroundIndexed; // Prebuilt palette-indexed background frame. // Vorgefertigter palettenindizierter Hintergrund-Frame.
+    std::vector<unsigned int> backgroundRgba; // Prebuilt RGBA background frame (one 32-bit word per pixel). // Vorgefertigter RGBA-Hintergrund-Frame (ein 32-Bit-Wort pro Pixel).
+    unsigned int rgbaColors[10]; // Palette packed into 32-bit RGBA words in memory byte order. // Palette gepackt in 32-Bit-RGBA-Wörter in Speicher-Byte-Reihenfolge.
+    unsigned char indexColors[10]; // Identity table so the indexed path can share the drawing template. // Identitätstabelle, damit der indizierte Pfad die Zeichenvorlage teilen kann.
+};
@@ -0,0 +1,145 @@
+/// Tetris Environment Implementation
+/// 
+/// Vectorized environment over N headless Engine games with a plain C interface. // Vektorisierte Umgebung über N headless Engine-Spiele mit einfacher C-Schnittstelle.
+/// Games are stored contiguously and stepped in chunks on a persistent WorkerPool once the batch is large enough. // Spiele werden zusammenhängend gespeichert und in Blöcken auf einem persistenten WorkerPool ausgeführt, sobald der Stapel groß genug ist.
+/// 
+/// Usage:
+/// ```cpp
+/// TetrisEnv *env = tetris_env_create(4096, 1);
+/// tetris_env_step(env, actions, observations, rewards, dones);
+/// ```
+/// 
+/// EN: The hot path only reads actions and writes into the caller's buffers; all memory is allocated in tetris_env_create.
+/// DE: Der heiße Pfad liest nur Aktionen und schreibt in die Puffer des Aufrufers; der gesamte Speicher wird in tetris_env_create angelegt.
+
+#include "tetrisenv.h" // Includes the C interface declarations. // Inkludiert die Deklarationen der C-Schnittstelle.
+#include "engine.h" // Includes the headless rules engine that is stepped. // Inkludiert die headless Regel-Engine, die ausgeführt wird.
+#include "workers.h" // Includes the worker pool for parallel stepping. // Inkludiert den Worker-Pool für paralleles Ausführen.
+#include <cstring> // Includes memcpy/memset for writing observations. // Inkludiert memcpy/memset zum Schreiben von Beobachtungen.
+#include <memory> // Includes unique_ptr for the replaceable worker pool. // Inkludiert unique_ptr für den austauschbaren Worker-Pool.
+#include <new> // Includes std::nothrow for allocation without exceptions across the C boundary. // Inkludiert std::nothrow für Speicheranlage ohne Ausnahmen über die C-Grenze.
+#include <vector> // Includes vector for the contiguous game array. // Inkludiert vector für das zusammenhängende Spiel-Array.
+
+struct TetrisEnv // Batch of games plus the threads that step them. // Stapel von Spielen plus die Threads, die sie ausführen.
+{
+    std::vector<Engine> games; // All games, contiguous in memory. // Alle Spiele, zusammenhängend im Speicher.
+    std::unique_ptr<WorkerPool> pool; // Threads used for stepping. // Für Schritte verwendete Threads.
+    int grain; // Games per chunk; batches of at most one chunk run on the calling thread only. // Spiele pro Block; Stapel von höchstens einem Block laufen nur auf dem aufrufenden Thread.
+};
+
+static void WriteObservation(const Engine &game, unsigned char *out) // Writes one TETRIS_ENV_OBS_SIZE record. // Schreibt einen Datensatz mit TETRIS_ENV_OBS_SIZE Bytes.
+{
+    memcpy(out, game.cells, 200); // Locked cells, row by row. // Gesperrte Zellen, Reihe für Reihe.
+    out[TETRIS_ENV_OBS_CURRENT_ID] = game.currentBlock.id; // Falling block id. // ID des fallenden Blocks.
+    out[TETRIS_ENV_OBS_CURRENT_ROTATION] = game.currentBlock.rotation; // Falling block rotation. // Rotation des fallenden Blocks.
+    out[TETRIS_ENV_OBS_CURRENT_ROW] = (unsigned char)game.currentBlock.row; // Falling block row offset (two's complement). // Reihen-Offset des fallenden Blocks (Zweierkomplement).
+    out[TETRIS_ENV_OBS_CURRENT_COLUMN] = (unsigned char)game.currentBlock.column; // Falling block column offset. // Spalten-Offset des fallenden Blocks.
+    out[TETRIS_ENV_OBS_NEXT_ID] = game.nextBlock.id; // Next block id. // ID des nächsten Blocks.
+    out[TETRIS_ENV_OBS_BAG] = game.bag; // Remaining blocks of the current bag. // Verbleibende Blöcke des aktuellen Beutels.
+    out[206] = 0; // Padding. // Auffüllung.
+    out[207] = 0; // Padding. // Auffüllung.
+}
+
+TetrisEnv *tetris_env_create(int n_envs, unsigned long long seed) // Allocates all games and the worker pool up front. // Legt alle Spiele und den Worker-Pool im Voraus an.
+{
+    if (n_envs <= 0) // Rejects empty batches. // Weist leere Stapel zurück.
+    {
+        return nullptr;
+    }
+    TetrisEnv *env = new (std::nothrow) TetrisEnv(); // Allocates the handle without throwing into C code. // Legt den Handle an, ohne Ausnahmen in C-Code zu werfen.
+    if (env == nullptr)
+    {
+        return nullptr;
+    }
+    try // Vector and thread creation may throw; C callers get NULL instead. // Vektor- und Thread-Erzeugung können werfen; C-Aufrufer erhalten stattdessen NULL.
+    {
+        env->games.resize(n_envs); // One Engine per game. // Eine Engine pro Spiel.
+        env->pool.reset(new WorkerPool(0)); // Uses all hardware threads by default. // Verwendet standardmäßig alle Hardware-Threads.
+    }
+    catch (...)
+    {
+        delete env;
+        return nullptr;
+    }
+    env->grain = 256; // Stepping 256 games takes tens of microseconds, enough to amortize a wake-up. // 256 Spiele auszuführen dauert zehn Mikrosekunden oder mehr, genug um ein Aufwecken zu amortisieren.
+    unsigned long long sequence = seed; // SplitMix64 state: game i gets output i + 1 of the sequence started at seed. // SplitMix64-Zustand: Spiel i erhält Ausgabe i + 1 der bei seed gestarteten Folge.
+    for (int i = 0; i < n_envs; i++) // Seeds every game independently. // Seedet jedes Spiel unabhängig.
+    {
+        env->games[i].Reset(SplitMix64(sequence));
+    }
+    return env; // Returns the ready environment. // Gibt die bereite Umgebung zurück.
+}
+
+void tetris_env_destroy(TetrisEnv *env) // Frees the environment. // Gibt die Umgebung frei.
+{
+    delete env; // The destructor joins the worker threads. // Der Destruktor führt die Worker-Threads zusammen.
+}
+
+int tetris_env_num_envs(TetrisEnv *env) // Returns the batch size. // Gibt die Stapelgröße zurück.
+{
+    return (int)env->games.size();
+}
+
+int tetris_env_set_threads(TetrisEnv *env, int threads) // Replaces the worker pool with one of the requested size. // Ersetzt den Worker-Pool durch einen der gewünschten Größe.
+{
+    std::unique_ptr<WorkerPool> pool; // New pool, built before the old one is released. // Neuer Pool, aufgebaut, bevor der alte freigegeben wird.
+    try // Thread creation may throw; C callers get an error code instead. // Thread-Erzeugung kann werfen; C-Aufrufer erhalten stattdessen einen Fehlercode.
+    {
+        pool.reset(new WorkerPool(threads)); // Starts the new threads. // Startet die neuen Threads.
+    }
+    catch (...)
+    {
+        return -1; // env->pool is untouched, so stepping keeps working. // env->pool bleibt unberührt, daher funktionieren Schritte weiter.
+    }
+    env->pool.swap(pool); // Installs the new pool. // Setzt den neuen Pool ein.
+    return 0; // pool now holds the old threads and joins them on return. // pool hält jetzt die alten Threads und führt sie beim Zurückkehren zusammen.
+}
+
+void tetris_env_reset(TetrisEnv *env, unsigned char *observations) // Starts a new episode in every game. // Startet eine neue Episode in jedem Spiel.
+{
+    env->pool->ParallelFor((int)env->games.size(), env->grain, [&](int begin, int end) {
+        for (int i = begin; i < end; i++) // Resets the games of this chunk. // Setzt die Spiele dieses Blocks zurück.
+        {
+            Engine &game = env->games[i];
+            game.Reset(game.rngState); // Continues the game's own random stream, so runs stay reproducible. // Setzt den eigenen Zufallsstrom des Spiels fort, damit Läufe reproduzierbar bleiben.
+            WriteObservation(game, observations + (size_t)i * TETRIS_ENV_OBS_SIZE);
+        }
+    });
+}
+
+void tetris_env_step(TetrisEnv *env, const int *actions, unsigned char *observations, float *rewards, unsigned char *dones) // Applies one action plus gravity to every game. // Wendet eine Aktion plus Schwerkraft auf jedes Spiel an.
+{
+    env->pool->ParallelFor((int)env->games.size(), env->grain, [&](int begin, int end) {
+        for (int i = begin; i < end; i++) // Steps the games of this chunk. // Führt die Spiele dieses Blocks aus.
+        {
+            Engine &game = env->games[i]; // The game stepped in this iteration. // Das in dieser Iteration ausgeführte Spiel.
+            int before = game.score; // Score before the step, for the reward. // Punktzahl vor dem Schritt, für die Belohnung.
+            switch (actions[i]) // Same mapping as the arrow keys in Game::HandleInput. // Gleiche Zuordnung wie die Pfeiltasten in Game::HandleInput.
+            {
+            case TETRIS_ENV_LEFT:
+                game.MoveBlockLeft();
+                break;
+            case TETRIS_ENV_RIGHT:
+                game.MoveBlockRight();
+                break;
+            case TETRIS_ENV_ROTATE:
+                game.RotateBlock();
+                break;
+            case TETRIS_ENV_DOWN:
+                game.MoveBlockDown();
+                game.UpdateScore(0, 1); // Soft-drop point, like KEY_DOWN. // Soft-Drop-Punkt, wie KEY_DOWN.
+                break;
+            default: // TETRIS_ENV_NOOP and unknown values. // TETRIS_ENV_NOOP und unbekannte Werte.
+                break;
+            }
+            game.MoveBlockDown(); // One gravity step, like EventTriggered in main.cpp. // Ein Schwerkraftschritt, wie EventTriggered in main.cpp.
+            rewards[i] = (float)(game.score - before); // Reward is the score gained in this step. // Belohnung ist die in diesem Schritt gewonnene Punktzahl.
+            dones[i] = game.gameOver ? 1 : 0; // Reports the end of the episode. // Meldet das Ende der Episode.
+            if (game.gameOver) // Restarts finished games right away. // Startet beendete Spiele sofort neu.
+            {
+                game.Reset(game.rngState);
+            }
+            WriteObservation(game, observations + (size_t)i * TETRIS_ENV_OBS_SIZE); // Writes the observation after the step (or of the new episode). // Schreibt die Beobachtung nach dem Schritt (oder der neuen Episode).
+        }
+    });
+}
@@ -0,0 +1,62 @@
+/// Tetris Environment C Interface
+/// 
+/// Plain C interface of the vectorized Tetris environment for training infrastructure (Python ctypes/cffi, C, Rust, ...). // Einfache C-Schnittstelle der vektorisierten Tetris-Umgebung für Trainings-Infrastruktur (Python ctypes/cffi, C, Rust, ...).
+/// Steps N independent Engine games and writes observations into caller-owned contiguous buffers without allocating per step. // Führt N unabhängige Engine-Spiele aus und schreibt Beobachtungen in zusammenhängende Puffer des Aufrufers, ohne pro Schritt Speicher anzulegen.
+/// 
+/// Usage:
+/// ```cpp
+/// // Build the shared library (no raylib needed)
+/// g++ -O2 -std=c++14 -shared -fPIC -o libtetrisenv.so src/tetrisenv.cpp src/engine.cpp src/shapes.cpp src/zobrist.cpp src/workers.cpp -lpthread
+/// 
+/// TetrisEnv *env = tetris_env_create(1024, 42);
+/// unsigned char *obs = malloc(1024 * TETRIS_ENV_OBS_SIZE);
+/// tetris_env_reset(env, obs);
+/// tetris_env_step(env, actions, obs, rewards, dones);
+/// tetris_env_destroy(env);
+/// ```
+/// 
+/// EN: Each step applies one action (like one key press in Game::HandleInput) followed by one gravity step (Game::MoveBlockDown); finished games restart automatically.
+/// DE: Jeder Schritt wendet eine Aktion an (wie ein Tastendruck in Game::HandleInput), gefolgt von einem Schwerkraftschritt (Game::MoveBlockDown); beendete Spiele starten automatisch neu.
+
+#pragma once // Ensures this header file is included only once during compilation. // Stellt sicher, dass diese Header-Datei nur einmal während der Kompilierung eingebunden wird.
+
+#if defined(_WIN32) // Windows needs explicit DLL exports. // Windows benötigt explizite DLL-Exporte.
+#define TETRIS_ENV_API __declspec(dllexport)
+#else // Other platforms export visible symbols by default. // Andere Plattformen exportieren sichtbare Symbole standardmäßig.
+#define TETRIS_ENV_API __attribute__((visibility("default")))
+#endif
+
+#define TETRIS_ENV_OBS_SIZE 208 // Bytes per observation (one record per game, records are contiguous). // Bytes pro Beobachtung (ein Datensatz pro Spiel, Datensätze liegen zusammenhängend).
+#define TETRIS_ENV_OBS_CURRENT_ID 200 // Offset of the falling block id (1-7). // Offset der ID des fallenden Blocks (1-7).
+#define TETRIS_ENV_OBS_CURRENT_ROTATION 201 // Offset of the falling block rotation state. // Offset des Rotationszustands des fallenden Blocks.
+#define TETRIS_ENV_OBS_CURRENT_ROW 202 // Offset of the falling block row offset (signed char). // Offset des Reihen-Offsets des fallenden Blocks (signed char).
+#define TETRIS_ENV_OBS_CURRENT_COLUMN 203 // Offset of the falling block column offset (signed char). // Offset des Spalten-Offsets des fallenden Blocks (signed char).
+#define TETRIS_ENV_OBS_NEXT_ID 204 // Offset of the next block id (1-7). // Offset der ID des nächsten Blocks (1-7).
+#define TETRIS_ENV_OBS_BAG 205 // Offset of the bag bit mask (bit id - 1 set = block still in the pool). // Offset der Beutel-Bitmaske (Bit ID - 1 gesetzt = Block noch im Pool).
+// Bytes 0-199: locked cells row by row (0 = empty, 1-7 = block id); bytes 206-207: zero padding. // Bytes 0-199: gesperrte Zellen Reihe für Reihe (0 = leer, 1-7 = Block-ID); Bytes 206-207: Null-Auffüllung.
+
+enum TetrisEnvAction // Actions accepted by tetris_env_step, one per game. // Von tetris_env_step akzeptierte Aktionen, eine pro Spiel.
+{
+    TETRIS_ENV_NOOP = 0, // Only gravity. // Nur Schwerkraft.
+    TETRIS_ENV_LEFT = 1, // KEY_LEFT: MoveBlockLeft. // KEY_LEFT: MoveBlockLeft.
+    TETRIS_ENV_RIGHT = 2, // KEY_RIGHT: MoveBlockRight. // KEY_RIGHT: MoveBlockRight.
+    TETRIS_ENV_ROTATE = 3, // KEY_UP: RotateBlock. // KEY_UP: RotateBlock.
+    TETRIS_ENV_DOWN = 4 // KEY_DOWN: MoveBlockDown plus one soft-drop point. // KEY_DOWN: MoveBlockDown plus ein Soft-Drop-Punkt.
+};
+
+#ifdef __cplusplus
+extern "C" { // C linkage so the symbols are not name-mangled. // C-Bindung, damit die Symbole nicht namensverfälscht werden.
+#endif
+
+typedef struct TetrisEnv TetrisEnv; // Opaque handle to a batch of games. // Undurchsichtiger Handle auf einen Stapel von Spielen.
+
+TETRIS_ENV_API TetrisEnv *tetris_env_create(int n_envs, unsigned long long seed); // Creates n_envs games; game i is seeded from seed and i. Returns NULL on invalid arguments. // Erzeugt n_envs Spiele; Spiel i wird aus seed und i geseedet. Gibt bei ungültigen Argumenten NULL zurück.
+TETRIS_ENV_API void tetris_env_destroy(TetrisEnv *env); // Frees all games and stops the worker threads. // Gibt alle Spiele frei und stoppt die Worker-Threads.
+TETRIS_ENV_API int tetris_env_num_envs(TetrisEnv *env); // Returns the number of games. // Gibt die Anzahl der Spiele zurück.
+TETRIS_ENV_API int tetris_env_set_threads(TetrisEnv *env, int threads); // Sets the stepping thread count (0 = all hardware threads, 1 = single-threaded). Returns 0, or -1 if the threads could not be started (the previous ones keep stepping). // Setzt die Thread-Anzahl für Schritte (0 = alle Hardware-Threads, 1 = einzelner Thread). Gibt 0 zurück, oder -1, wenn die Threads nicht gestartet werden konnten (die bisherigen führen weiter aus).
+TETRIS_ENV_API void tetris_env_reset(TetrisEnv *env, unsigned char *observations); // Restarts every game and writes n_envs * TETRIS_ENV_OBS_SIZE bytes of observations. // Startet jedes Spiel neu und schreibt n_envs * TETRIS_ENV_OBS_SIZE Bytes Beobachtungen.
+TETRIS_ENV_API void tetris_env_step(TetrisEnv *env, const int *actions, unsigned char *observations, float *rewards, unsigned char *dones); // Applies n_envs actions; writes observations, score deltas as rewards and done flags (1 = game ended and was restarted). // Wendet n_envs Aktionen an; schreibt Beobachtungen, Punktdifferenzen als Belohnungen und Ende-Flaggen (1 = Spiel beendet und neu gestartet).
+
+#ifdef __cplusplus
+}
+#endif
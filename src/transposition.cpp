@@ -0,0 +1,193 @@
+/// Transposition Table Implementation
+/// 
+/// Implements the TranspositionTable class used by the lookahead code of the C++ Tetris game. // Implementiert die TranspositionTable-Klasse, die vom Vorausschau-Code des C++ Tetris-Spiels verwendet wird.
+/// Each entry is two relaxed atomic words (key XOR data, data), so readers detect torn writes without locks. // Jeder Eintrag besteht aus zwei relaxed-atomaren Wörtern (Schlüssel XOR Daten, Daten), daher erkennen Leser zerrissene Schreibvorgänge ohne Sperren.
+/// 
+/// Usage:
+/// ```cpp
+/// table.NewSearch();                                     // Once per move decision
+/// table.Store(key, check, value, depth, move, stats);
+/// ```
+/// 
+/// EN: Replacement prefers the same position, then an empty entry, then entries of older searches, then the shallowest entry.
+/// DE: Die Ersetzung bevorzugt dieselbe Stellung, dann einen leeren Eintrag, dann Einträge älterer Suchen, dann den flachsten Eintrag.
+
+#include "transposition.h" // Includes the TranspositionTable class header file with declarations. // Inkludiert die TranspositionTable-Klassen-Header-Datei mit Deklarationen.
+#include <climits> // Includes INT_MIN/INT_MAX for the replacement scores. // Inkludiert INT_MIN/INT_MAX für die Ersetzungswerte.
+#include <cstring> // Includes memcpy for the float bit pattern. // Inkludiert memcpy für das Bitmuster der Gleitkommazahl.
+#include <cstdint> // Includes uintptr_t for the alignment arithmetic. // Inkludiert uintptr_t für die Ausrichtungsberechnung.
+#include <new> // Includes placement new for constructing the buckets. // Inkludiert Placement-new zum Konstruieren der Buckets.
+#include <iostream> // Includes the console output for the statistics. // Inkludiert die Konsolenausgabe für die Statistiken.
+
+// Data word layout: bits 0-7 check, 8-15 generation, 16-23 depth, 24-31 move, 32-63 value. // Aufbau des Datenworts: Bits 0-7 Prüfung, 8-15 Generation, 16-23 Tiefe, 24-31 Zug, 32-63 Wert.
+static unsigned long long PackData(float value, int move, int depth, unsigned int generation, unsigned char check) // Packs one entry into a word. // Packt einen Eintrag in ein Wort.
+{
+    unsigned int valueBits; // Raw bits of the value. // Rohe Bits des Werts.
+    std::memcpy(&valueBits, &value, sizeof(valueBits));
+    return ((unsigned long long)valueBits << 32) | ((unsigned long long)(move & 0xFF) << 24) | ((unsigned long long)(depth & 0xFF) << 16) | ((unsigned long long)(generation & 0xFF) << 8) | check;
+}
+
+static unsigned int DataGeneration(unsigned long long data) // Extracts the generation (0 = empty entry). // Extrahiert die Generation (0 = leerer Eintrag).
+{
+    return (unsigned int)(data >> 8) & 0xFF;
+}
+
+static int DataDepth(unsigned long long data) // Extracts the depth. // Extrahiert die Tiefe.
+{
+    return (int)(data >> 16) & 0xFF;
+}
+
+TranspositionTable::TranspositionTable(int megabytes) // Constructor that allocates and clears the buckets. // Konstruktor, der die Buckets anlegt und leert.
+{
+    unsigned long long bytes = (unsigned long long)(megabytes > 0 ? megabytes : 1) << 20; // Requested size in bytes (at least 1 MB). // Gewünschte Größe in Bytes (mindestens 1 MB).
+    unsigned long long count = 1; // Bucket count, kept a power of two so the index is a mask. // Bucket-Anzahl, als Zweierpotenz gehalten, damit der Index eine Maske ist.
+    while (count * 2 * sizeof(Bucket) <= bytes)
+    {
+        count *= 2;
+    }
+    mask = count - 1;
+    memory = new unsigned char[count * sizeof(Bucket) + 64]; // One extra cache line to align the start (aligned new needs C++17). // Eine zusätzliche Cache-Line zum Ausrichten des Anfangs (ausgerichtetes new benötigt C++17).
+    buckets = reinterpret_cast<Bucket *>(((std::uintptr_t)memory + 63) & ~(std::uintptr_t)63); // First 64-byte boundary inside the allocation. // Erste 64-Byte-Grenze innerhalb der Speicheranlage.
+    for (unsigned long long i = 0; i < count; i++) // Constructs the atomics in place. // Konstruiert die Atomics an Ort und Stelle.
+    {
+        new (&buckets[i]) Bucket();
+    }
+    generation = 1; // First search generation. // Erste Suchgeneration.
+    Clear(); // Starts empty. // Beginnt leer.
+}
+
+TranspositionTable::~TranspositionTable() // Destructor that frees the bucket memory. // Destruktor, der den Bucket-Speicher freigibt.
+{
+    delete[] memory; // Buckets are trivially destructible, so freeing the raw memory is enough. // Buckets sind trivial zerstörbar, daher genügt das Freigeben des Rohspeichers.
+}
+
+bool TranspositionTable::Probe(unsigned long long key, unsigned char check, TranspositionEntry &entry, TranspositionStats &stats) // Looks a position up. // Schlägt eine Stellung nach.
+{
+    stats.probes++; // Counts the lookup. // Zählt die Abfrage.
+    Bucket &bucket = buckets[key & mask]; // Bucket selected by the low key bits. // Über die unteren Schlüsselbits gewählter Bucket.
+    for (int i = 0; i < 4; i++) // Scans the four entries of the cache line. // Durchsucht die vier Einträge der Cache-Line.
+    {
+        unsigned long long data = bucket.data[i].load(std::memory_order_relaxed); // Entry data. // Daten des Eintrags.
+        if (DataGeneration(data) == 0 || (bucket.keys[i].load(std::memory_order_relaxed) ^ data) != key) // Empty, other position or torn write. // Leer, andere Stellung oder zerrissener Schreibvorgang.
+        {
+            continue;
+        }
+        if ((unsigned char)(data & 0xFF) != check) // Same 64-bit key but a different position. // Gleicher 64-Bit-Schlüssel, aber eine andere Stellung.
+        {
+            stats.collisions++; // Counts the detected collision and treats it as a miss. // Zählt die erkannte Kollision und behandelt sie als Fehltreffer.
+            return false;
+        }
+        unsigned int valueBits = (unsigned int)(data >> 32); // Raw bits of the value. // Rohe Bits des Werts.
+        std::memcpy(&entry.value, &valueBits, sizeof(valueBits));
+        entry.depth = DataDepth(data);
+        entry.move = (int)(data >> 24) & 0xFF;
+        stats.hits++; // Counts the hit. // Zählt den Treffer.
+        return true;
+    }
+    return false; // Position is not stored. // Stellung ist nicht gespeichert.
+}
+
+void TranspositionTable::Store(unsigned long long key, unsigned char check, float value, int depth, int move, TranspositionStats &stats) // Stores a position. // Speichert eine Stellung.
+{
+    Bucket &bucket = buckets[key & mask]; // Bucket selected by the low key bits. // Über die unteren Schlüsselbits gewählter Bucket.
+    int victim = -1; // Entry that will be overwritten. // Eintrag, der überschrieben wird.
+    int victimScore = INT_MAX; // Lower means more replaceable. // Niedriger bedeutet eher ersetzbar.
+    bool samePosition = false; // True if the victim already holds this position, so nothing is evicted. // Wahr, wenn das Opfer diese Stellung bereits enthält, daher wird nichts verdrängt.
+    for (int i = 0; i < 4; i++) // Picks the entry to overwrite. // Wählt den zu überschreibenden Eintrag.
+    {
+        unsigned long long data = bucket.data[i].load(std::memory_order_relaxed); // Entry data. // Daten des Eintrags.
+        unsigned int entryGeneration = DataGeneration(data); // Generation of the entry (0 = empty). // Generation des Eintrags (0 = leer).
+        if (entryGeneration != 0 && (bucket.keys[i].load(std::memory_order_relaxed) ^ data) == key) // Same position already stored. // Dieselbe Stellung ist bereits gespeichert.
+        {
+            if (entryGeneration == generation && DataDepth(data) > depth) // Keeps a deeper result from this search. // Behält ein tieferes Ergebnis dieser Suche.
+            {
+                stats.rejected++;
+                return;
+            }
+            victim = i;
+            samePosition = true; // Overwrites the position in place. // Überschreibt die Stellung an Ort und Stelle.
+            break;
+        }
+        int score; // Replaceability of this entry. // Ersetzbarkeit dieses Eintrags.
+        if (entryGeneration == 0)
+        {
+            score = INT_MIN; // Below every occupied score (at least -256 * 254), so empty entries are taken before any eviction. // Unter jedem belegten Wert (mindestens -256 * 254), daher werden leere Einträge vor jeder Verdrängung genommen.
+        }
+        else
+        {
+            int age = (int)((generation + 255 - entryGeneration) % 255); // Searches since the entry was written (generations wrap 1-255). // Suchen seit dem Schreiben des Eintrags (Generationen laufen 1-255 um).
+            score = DataDepth(data) - 256 * age; // Older generations first, then the shallowest. // Ältere Generationen zuerst, dann die flachste.
+        }
+        if (score < victimScore)
+        {
+            victim = i;
+            victimScore = score;
+        }
+    }
+    unsigned long long old = bucket.data[victim].load(std::memory_order_relaxed); // Previous data of the chosen entry. // Vorherige Daten des gewählten Eintrags.
+    if (!samePosition && DataGeneration(old) != 0) // A different position is evicted. // Eine andere Stellung wird verdrängt.
+    {
+        stats.replacements++;
+    }
+    unsigned long long data = PackData(value, move, depth, generation, check); // New entry data. // Neue Eintragsdaten.
+    bucket.keys[victim].store(key ^ data, std::memory_order_relaxed); // Key is stored XOR data so a half-written entry fails the key test. // Schlüssel wird XOR Daten gespeichert, damit ein halb geschriebener Eintrag den Schlüsseltest nicht besteht.
+    bucket.data[victim].store(data, std::memory_order_relaxed);
+    stats.stores++; // Counts the store. // Zählt den Speichervorgang.
+}
+
+void TranspositionTable::NewSearch() // Starts a new generation. // Startet eine neue Generation.
+{
+    generation = generation % 255 + 1; // Cycles through 1-255 (0 stays reserved for empty entries). // Läuft durch 1-255 (0 bleibt für leere Einträge reserviert).
+}
+
+void TranspositionTable::Clear() // Empties the whole table. // Leert die gesamte Tabelle.
+{
+    for (unsigned long long i = 0; i <= mask; i++) // Resets every entry to empty. // Setzt jeden Eintrag auf leer zurück.
+    {
+        for (int j = 0; j < 4; j++)
+        {
+            buckets[i].keys[j].store(0, std::memory_order_relaxed);
+            buckets[i].data[j].store(0, std::memory_order_relaxed);
+        }
+    }
+}
+
+long long TranspositionTable::GetEntryCount() // Returns the capacity in entries. // Gibt die Kapazität in Einträgen zurück.
+{
+    return (long long)(mask + 1) * 4;
+}
+
+double TranspositionTable::GetFillRate() // Returns the share of sampled entries in use. // Gibt den Anteil belegter Stichprobeneinträge zurück.
+{
+    unsigned long long samples = mask + 1 < 1024 ? mask + 1 : 1024; // Samples the first buckets only, which is representative because keys are random. // Prüft nur die ersten Buckets, was repräsentativ ist, da Schlüssel zufällig sind.
+    long long used = 0; // Non-empty entries. // Nicht leere Einträge.
+    for (unsigned long long i = 0; i < samples; i++)
+    {
+        for (int j = 0; j < 4; j++)
+        {
+            if (DataGeneration(buckets[i].data[j].load(std::memory_order_relaxed)) != 0)
+            {
+                used++;
+            }
+        }
+    }
+    return (double)used / (double)(samples * 4);
+}
+
+void TranspositionTable::Merge(TranspositionStats &total, const TranspositionStats &part) // Adds per-thread counters into a total. // Addiert Zähler pro Thread zu einer Summe.
+{
+    total.probes += part.probes;
+    total.hits += part.hits;
+    total.collisions += part.collisions;
+    total.stores += part.stores;
+    total.replacements += part.replacements;
+    total.rejected += part.rejected;
+}
+
+void TranspositionTable::PrintStats(const TranspositionStats &stats) // Prints the statistics to the console. // Gibt die Statistiken auf der Konsole aus.
+{
+    double hitRate = stats.probes > 0 ? 100.0 * (double)stats.hits / (double)stats.probes : 0.0; // Hits per probe in percent. // Treffer pro Abfrage in Prozent.
+    std::cout << "TT probes: " << stats.probes << ", hits: " << stats.hits << " (" << hitRate << "%)"
+              << ", collisions: " << stats.collisions << ", stores: " << stats.stores
+              << ", replacements: " << stats.replacements << ", rejected: " << stats.rejected << std::endl;
+}
@@ -0,0 +1,69 @@
+/// Transposition Table Header
+/// 
+/// Header file declaring the TranspositionTable class, a fixed-size cache of evaluated Tetris positions. // Header-Datei, die die TranspositionTable-Klasse deklariert, einen Cache fester Größe für bewertete Tetris-Stellungen.
+/// Positions are keyed by their Zobrist hash; each 64-byte bucket holds four entries and fits exactly one cache line. // Stellungen werden über ihren Zobrist-Hash adressiert; jeder 64-Byte-Bucket enthält vier Einträge und füllt genau eine Cache-Line.
+/// 
+/// Usage:
+/// ```cpp
+/// #include "transposition.h"
+/// 
+/// TranspositionTable table(64);                         // 64 MB (not copyable, so constructed directly)
+/// TranspositionStats stats = {};
+/// TranspositionEntry entry;
+/// if (table.Probe(engine.GetHash(), engine.GetCheck(), entry, stats) && entry.depth >= depth) {
+///     return entry.value;                                // Already searched deep enough
+/// }
+/// table.Store(engine.GetHash(), engine.GetCheck(), value, depth, bestMove, stats);
+/// TranspositionTable::PrintStats(stats);
+/// ```
+/// 
+/// EN: Lookahead code revisits identical boards reached by different move orders; the table lets it evaluate each of them only once.
+/// DE: Vorausschau-Code besucht identische Spielfelder, die über verschiedene Zugfolgen erreicht werden, erneut; die Tabelle lässt jedes davon nur einmal bewerten.
+
+#pragma once // Ensures this header file is included only once during compilation. // Stellt sicher, dass diese Header-Datei nur einmal während der Kompilierung eingebunden wird.
+#include <atomic> // Includes atomics so several threads can share the table without locks. // Inkludiert Atomics, damit mehrere Threads die Tabelle ohne Sperren teilen können.
+
+struct TranspositionEntry // Data stored for one position. // Für eine Stellung gespeicherte Daten.
+{
+    float value; // Evaluation of the position. // Bewertung der Stellung.
+    int depth; // Search depth the value was computed with (0-255). // Suchtiefe, mit der der Wert berechnet wurde (0-255).
+    int move; // Best action found from this position (0-255). // Beste von dieser Stellung aus gefundene Aktion (0-255).
+};
+
+struct TranspositionStats // Counters kept per thread by the caller and merged afterwards (avoids shared counters). // Zähler, die der Aufrufer pro Thread führt und danach zusammenführt (vermeidet geteilte Zähler).
+{
+    long long probes; // Lookups performed. // Durchgeführte Abfragen.
+    long long hits; // Lookups that found the position. // Abfragen, die die Stellung gefunden haben.
+    long long collisions; // Lookups where the 64-bit key matched but the 8-bit check did not (a real hash collision). // Abfragen, bei denen der 64-Bit-Schlüssel passte, die 8-Bit-Prüfung aber nicht (eine echte Hash-Kollision).
+    long long stores; // Entries written. // Geschriebene Einträge.
+    long long replacements; // Stores that evicted a different position from a full bucket. // Speichervorgänge, die eine andere Stellung aus einem vollen Bucket verdrängt haben.
+    long long rejected; // Stores skipped because the existing entry of the same position was deeper. // Übersprungene Speichervorgänge, weil der vorhandene Eintrag derselben Stellung tiefer war.
+};
+
+class TranspositionTable // Declares the lock-free, cache-aligned transposition table. // Deklariert die sperrfreie, an Cache-Lines ausgerichtete Transpositionstabelle.
+{
+public: // Public interface accessible from outside the class. // Öffentliche Schnittstelle, die von außerhalb der Klasse zugänglich ist.
+    TranspositionTable(int megabytes); // Constructor that allocates the largest power-of-two bucket count fitting into the given size. // Konstruktor, der die größte Zweierpotenz an Buckets anlegt, die in die gegebene Größe passt.
+    ~TranspositionTable(); // Destructor that frees the bucket memory. // Destruktor, der den Bucket-Speicher freigibt.
+    TranspositionTable(const TranspositionTable &) = delete; // The table owns raw memory and is not copied. // Die Tabelle besitzt Rohspeicher und wird nicht kopiert.
+    TranspositionTable &operator=(const TranspositionTable &) = delete; // The table owns raw memory and is not copied. // Die Tabelle besitzt Rohspeicher und wird nicht kopiert.
+    bool Probe(unsigned long long key, unsigned char check, TranspositionEntry &entry, TranspositionStats &stats); // Looks a position up; returns true and fills entry on a hit. // Schlägt eine Stellung nach; gibt bei einem Treffer wahr zurück und füllt entry.
+    void Store(unsigned long long key, unsigned char check, float value, int depth, int move, TranspositionStats &stats); // Stores a position using the replacement policy. // Speichert eine Stellung nach der Ersetzungsstrategie.
+    void NewSearch(); // Starts a new generation so entries from older searches are replaced first. // Startet eine neue Generation, damit Einträge älterer Suchen zuerst ersetzt werden.
+    void Clear(); // Empties the whole table. // Leert die gesamte Tabelle.
+    long long GetEntryCount(); // Returns the capacity in entries. // Gibt die Kapazität in Einträgen zurück.
+    double GetFillRate(); // Returns the share of sampled entries in use (0-1). // Gibt den Anteil belegter Stichprobeneinträge zurück (0-1).
+    static void Merge(TranspositionStats &total, const TranspositionStats &part); // Adds per-thread counters into a total. // Addiert Zähler pro Thread zu einer Summe.
+    static void PrintStats(const TranspositionStats &stats); // Prints hit rate, collision and replacement statistics to the console. // Gibt Trefferquote, Kollisions- und Ersetzungsstatistiken auf der Konsole aus.
+
+private: // Private members accessible only within the class. // Private Mitglieder, die nur innerhalb der Klasse zugänglich sind.
+    struct alignas(64) Bucket // Four entries of two words each: key XOR data, and data (torn writes never match a key). // Vier Einträge zu je zwei Wörtern: Schlüssel XOR Daten, und Daten (zerrissene Schreibvorgänge passen nie zu einem Schlüssel).
+    {
+        std::atomic<unsigned long long> keys[4]; // Key XOR data of each entry. // Schlüssel XOR Daten jedes Eintrags.
+        std::atomic<unsigned long long> data[4]; // Packed value, move, depth, generation and check of each entry. // Gepackter Wert, Zug, Tiefe, Generation und Prüfung jedes Eintrags.
+    };
+    Bucket *buckets; // Cache-line aligned bucket array inside memory. // An Cache-Lines ausgerichtetes Bucket-Array innerhalb von memory.
+    unsigned char *memory; // Raw allocation (over-allocated by one cache line for alignment). // Rohe Speicheranlage (um eine Cache-Line für die Ausrichtung überdimensioniert).
+    unsigned long long mask; // Bucket count - 1, used to map a key to its bucket. // Bucket-Anzahl - 1, zum Abbilden eines Schlüssels auf seinen Bucket.
+    unsigned int generation; // Current search generation (1-255, 0 marks an empty entry). // Aktuelle Suchgeneration (1-255, 0 markiert einen leeren Eintrag).
+};
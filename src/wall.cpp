@@ -0,0 +1,285 @@
+/// Wall View Implementation
+///
+/// Implementation of the WallView class that draws dozens of boards from one atlas texture for the C++ Tetris game using raylib. // Implementierung der WallView-Klasse, die dutzende Spielfelder aus einer Atlas-Textur für das C++ Tetris-Spiel mit raylib zeichnet.
+/// SetBoard compares the 200 cells with the previous state; only changed boards are repacked and uploaded, everything else stays on the GPU. // SetBoard vergleicht die 200 Zellen mit dem vorherigen Zustand; nur geänderte Spielfelder werden neu gepackt und hochgeladen, alles andere bleibt auf der GPU.
+///
+/// Usage:
+/// ```cpp
+/// WallView wall(64);
+/// wall.Layout(0, 0, 1280, 720);
+/// wall.SetBoard(0, game.GetSnapshot());
+/// wall.Draw();
+/// ```
+///
+/// EN: The atlas is sampled with point filtering, so a cell stays a sharp square at any cell size; the 1-pixel gaps of Grid::Draw are drawn as thin quads once cells are big enough to show them.
+/// DE: Der Atlas wird mit Punktfilterung abgetastet, daher bleibt eine Zelle bei jeder Zellgröße ein scharfes Quadrat; die 1-Pixel-Fugen von Grid::Draw werden als dünne Vierecke gezeichnet, sobald Zellen groß genug dafür sind.
+
+#include "wall.h" // Includes the WallView class declaration. // Inkludiert die Deklaration der WallView-Klasse.
+#include "colors.h" // Includes GetCellColors and the background color for the gaps. // Inkludiert GetCellColors und die Hintergrundfarbe für die Fugen.
+#include "softrender.h" // Includes SoftRenderer::RenderCells, which merges the falling block into the cells. // Inkludiert SoftRenderer::RenderCells, das den fallenden Block in die Zellen einfügt.
+#include <rlgl.h> // Includes raylib's low-level batch API (rlBegin, rlTexCoord2f, rlVertex2f, rlSetTexture). // Inkludiert raylibs Low-Level-Stapel-API (rlBegin, rlTexCoord2f, rlVertex2f, rlSetTexture).
+#include <cmath> // Includes sqrt for the atlas shape. // Inkludiert sqrt für die Atlasform.
+#include <cstring> // Includes memcmp/memcpy for cell comparison and color packing. // Inkludiert memcmp/memcpy für Zellvergleich und Farbpackung.
+
+static const float boardMargin = 6.0f; // Pixels between boards and around the wall. // Pixel zwischen Spielfeldern und um die Wand.
+static const float labelHeight = 14.0f; // Pixels below each board reserved for its score. // Pixel unter jedem Spielfeld, reserviert für seine Punktzahl.
+static const float gapMinimumCell = 6.0f; // Smallest cell size that shows the gaps between cells. // Kleinste Zellgröße, die die Fugen zwischen Zellen zeigt.
+static const float labelMinimumCell = 3.0f; // Smallest cell size whose board is wide enough for a score label. // Kleinste Zellgröße, deren Spielfeld breit genug für eine Punktzahl-Beschriftung ist.
+static const int drawChunk = 1024; // Quads per rlBegin/rlEnd pass (4096 vertices, well below the default batch size). // Vierecke pro rlBegin/rlEnd-Durchgang (4096 Vertices, deutlich unter der Standard-Stapelgröße).
+static const int maxAtlasTexels = 4096; // Widest and tallest atlas; larger textures fail to load on many GPUs. // Breitester und höchster Atlas; größere Texturen lassen sich auf vielen GPUs nicht laden.
+static const int maxBoards = (maxAtlasTexels / 10) * (maxAtlasTexels / 20); // 409 x 204 boards of 10x20 texels. // 409 x 204 Spielfelder zu 10x20 Texeln.
+
+WallView::WallView(int boardCount) // Allocates all boards empty and creates the atlas once. // Legt alle Spielfelder leer an und erstellt den Atlas einmal.
+{
+    this->boardCount = boardCount < 1 ? 1 : (boardCount > maxBoards ? maxBoards : boardCount); // At least one board, at most what fits the atlas. // Mindestens ein Spielfeld, höchstens so viele, wie in den Atlas passen.
+    if (boardCount > maxBoards) // Tells the user why boards are missing instead of dropping them silently. // Sagt dem Benutzer, warum Spielfelder fehlen, statt sie stillschweigend wegzulassen.
+    {
+        TraceLog(LOG_WARNING, "WALL: %d boards exceed a %dx%d atlas, showing %d", boardCount, maxAtlasTexels, maxAtlasTexels, maxBoards); // Logs the requested count, the atlas limit and the boards that are shown. // Protokolliert die angeforderte Anzahl, die Atlasgrenze und die gezeigten Spielfelder.
+    }
+    atlasColumns = (int)std::ceil(std::sqrt(2.0 * this->boardCount)); // Boards are twice as tall as wide, so twice the columns give a square atlas (64 boards: 120x120 texels). // Spielfelder sind doppelt so hoch wie breit, daher ergeben doppelt so viele Spalten einen quadratischen Atlas (64 Spielfelder: 120x120 Texel).
+    if (atlasColumns > maxAtlasTexels / 10) // Keeps the atlas at most maxAtlasTexels wide. // Hält den Atlas höchstens maxAtlasTexels breit.
+    {
+        atlasColumns = maxAtlasTexels / 10; // 409 boards of 10 texels per atlas row. // 409 Spielfelder zu 10 Texeln pro Atlasreihe.
+    }
+    atlasRows = (this->boardCount + atlasColumns - 1) / atlasColumns; // Atlas rows needed for all boards (rounded up). // Für alle Spielfelder benötigte Atlasreihen (aufgerundet).
+    while (atlasRows * 20 > maxAtlasTexels) // Rounding can leave one row too many; a wider atlas still fits. // Rundung kann eine Reihe zu viel lassen; ein breiterer Atlas passt noch.
+    {
+        atlasColumns++; // One more column per try. // Eine Spalte mehr pro Versuch.
+        atlasRows = (this->boardCount + atlasColumns - 1) / atlasColumns; // Recomputes the rows for the wider atlas. // Berechnet die Reihen für den breiteren Atlas neu.
+    }
+    std::vector<Color> colors = GetCellColors(); // Same palette as Grid::Draw. // Gleiche Palette wie Grid::Draw.
+    for (int id = 0; id < 8; id++) // Packs the eight cell colors (0 = empty, 1-7 = block ids). // Packt die acht Zellfarben (0 = leer, 1-7 = Block-IDs).
+    {
+        memcpy(&rgbaColors[id], &colors[id], sizeof(unsigned int)); // Color is r, g, b, a in memory, the byte order of R8G8B8A8. // Color ist r, g, b, a im Speicher, die Byte-Reihenfolge von R8G8B8A8.
+    }
+    cells.assign((size_t)this->boardCount * 200, 0); // All cells empty, so the first SetBoard of a board with blocks repacks it. // Alle Zellen leer, daher packt das erste SetBoard eines Spielfelds mit Blöcken es neu.
+    texels.assign((size_t)this->boardCount * 200, rgbaColors[0]); // Empty boards (dark grey cells). // Leere Spielfelder (dunkelgraue Zellen).
+    atlasPixels.assign((size_t)atlasColumns * 10 * atlasRows * 20, rgbaColors[0]); // CPU copy of the whole atlas, starting empty. // CPU-Kopie des ganzen Atlas, anfangs leer.
+    scores.assign(this->boardCount, 0); // Every score starts at 0. // Jede Punktzahl beginnt bei 0.
+    gameOver.assign(this->boardCount, 0); // No board has ended yet. // Noch kein Spielfeld ist beendet.
+    dirty.assign(this->boardCount, 0); // Nothing to upload yet. // Noch nichts hochzuladen.
+    dirtyList.reserve(this->boardCount); // Never grows during play. // Wächst während des Spiels nie.
+    boardX.assign(this->boardCount, 0.0f); // Screen positions, set by Layout. // Bildschirmpositionen, von Layout gesetzt.
+    boardY.assign(this->boardCount, 0.0f); // Screen positions, set by Layout. // Bildschirmpositionen, von Layout gesetzt.
+    cellSize = 1.0f; // Placeholder until the first Layout. // Platzhalter bis zum ersten Layout.
+    uploadedBoards = 0; // No Draw has run yet. // Es lief noch kein Draw.
+    drawMs = 0; // No Draw has run yet. // Es lief noch kein Draw.
+    revision = 0; // First visible state. // Erster sichtbarer Zustand.
+    Image image; // Wraps the CPU copy; LoadTextureFromImage copies it to the GPU. // Umhüllt die CPU-Kopie; LoadTextureFromImage kopiert sie auf die GPU.
+    image.data = atlasPixels.data(); // Points at the atlas pixels, no copy. // Zeigt auf die Atlaspixel, keine Kopie.
+    image.width = atlasColumns * 10; // Atlas width in texels. // Atlasbreite in Texeln.
+    image.height = atlasRows * 20; // Atlas height in texels. // Atlashöhe in Texeln.
+    image.mipmaps = 1; // No mipmaps, cells are drawn with point filtering. // Keine Mipmaps, Zellen werden mit Punktfilterung gezeichnet.
+    image.format = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8; // Same byte order as rgbaColors. // Gleiche Byte-Reihenfolge wie rgbaColors.
+    atlas = LoadTextureFromImage(image); // Creates the GPU texture that every board is drawn from. // Erstellt die GPU-Textur, aus der jedes Spielfeld gezeichnet wird.
+    SetTextureFilter(atlas, TEXTURE_FILTER_POINT); // Sharp cells at any scale. // Scharfe Zellen in jeder Größe.
+}
+
+WallView::~WallView() // Frees the GPU texture. // Gibt die GPU-Textur frei.
+{
+    UnloadTexture(atlas); // Releases the atlas texture. // Gibt die Atlastextur frei.
+}
+
+void WallView::SetBoard(int board, const BoardSnapshot &snapshot) // Merges, compares and repacks one board. // Fügt ein Spielfeld zusammen, vergleicht und packt es neu.
+{
+    if (board < 0 || board >= boardCount) // Ignores boards outside the wall. // Ignoriert Spielfelder außerhalb der Wand.
+    {
+        return; // Nothing to update. // Nichts zu aktualisieren.
+    }
+    if (scores[board] != snapshot.score || gameOver[board] != (snapshot.gameOver ? 1 : 0)) // Label changed; drawn as text every frame, so nothing to upload. // Beschriftung geändert; wird jeden Frame als Text gezeichnet, daher nichts hochzuladen.
+    {
+        scores[board] = snapshot.score; // Stores the new score. // Speichert die neue Punktzahl.
+        gameOver[board] = snapshot.gameOver ? 1 : 0; // Stores the game-over flag (label turns red). // Speichert die Game-Over-Flagge (Beschriftung wird rot).
+        revision++; // The frame looks different. // Der Frame sieht anders aus.
+    }
+    unsigned char merged[200]; // Cells as the board shows them, falling block included. // Zellen, wie das Spielfeld sie zeigt, einschließlich fallendem Block.
+    SoftRenderer::RenderCells(snapshot, merged); // Merges the falling block into the locked cells. // Fügt den fallenden Block in die gesperrten Zellen ein.
+    unsigned char *stored = &cells[(size_t)board * 200]; // Cells of this board as last packed. // Zellen dieses Spielfelds wie zuletzt gepackt.
+    if (memcmp(merged, stored, 200) == 0) // Nothing visible changed: no repack, no upload. // Nichts Sichtbares geändert: kein Neupacken, kein Hochladen.
+    {
+        return; // Keeps the uploaded texels. // Behält die hochgeladenen Texel.
+    }
+    memcpy(stored, merged, 200); // Remembers the new cells for the next comparison. // Merkt sich die neuen Zellen für den nächsten Vergleich.
+    unsigned int *out = &texels[(size_t)board * 200]; // Texels of this board, row by row. // Texel dieses Spielfelds, Reihe für Reihe.
+    for (int i = 0; i < 200; i++) // Block id to texel color. // Block-ID zu Texelfarbe.
+    {
+        out[i] = rgbaColors[merged[i] & 7]; // Masks the id so a bad value cannot read past the palette. // Maskiert die ID, damit ein falscher Wert nicht hinter die Palette liest.
+    }
+    if (!dirty[board]) // Listed once, however often it changes before the next Draw. // Einmal gelistet, egal wie oft es sich vor dem nächsten Draw ändert.
+    {
+        dirty[board] = 1; // Marks the board for the next Upload. // Markiert das Spielfeld für den nächsten Upload.
+        dirtyList.push_back(board); // Queues the board for the next Upload. // Reiht das Spielfeld für den nächsten Upload ein.
+    }
+    revision++; // The frame looks different. // Der Frame sieht anders aus.
+}
+
+void WallView::Layout(float x, float y, float width, float height) // Tries every column count and keeps the one with the biggest cells. // Probiert jede Spaltenanzahl und behält die mit den größten Zellen.
+{
+    int bestColumns = 1; // Column count of the best layout so far. // Spaltenanzahl des bisher besten Layouts.
+    float bestCell = 0.0f; // Cell size of the best layout so far. // Zellgröße des bisher besten Layouts.
+    for (int columns = 1; columns <= boardCount; columns++) // Tries every column count from one row to one column. // Probiert jede Spaltenanzahl von einer Reihe bis zu einer Spalte.
+    {
+        int rows = (boardCount + columns - 1) / columns; // Board rows needed for this column count. // Für diese Spaltenanzahl benötigte Spielfeldreihen.
+        float cellWidth = (width - (columns + 1) * boardMargin) / (columns * 10); // Cell size limited by the width. // Durch die Breite begrenzte Zellgröße.
+        float cellHeight = (height - (rows + 1) * boardMargin - rows * labelHeight) / (rows * 20); // Cell size limited by the height. // Durch die Höhe begrenzte Zellgröße.
+        float cell = cellWidth < cellHeight ? cellWidth : cellHeight; // The tighter limit wins. // Die engere Grenze gewinnt.
+        if (cell > bestCell) // Keeps the layout with the biggest cells. // Behält das Layout mit den größten Zellen.
+        {
+            bestCell = cell; // New best cell size. // Neue beste Zellgröße.
+            bestColumns = columns; // New best column count. // Neue beste Spaltenanzahl.
+        }
+    }
+    cellSize = bestCell > 0.25f ? bestCell : 0.25f; // Tiny windows still get a (tiny) wall. // Winzige Fenster bekommen trotzdem eine (winzige) Wand.
+    int rows = (boardCount + bestColumns - 1) / bestColumns; // Board rows of the chosen layout. // Spielfeldreihen des gewählten Layouts.
+    float boardWidth = cellSize * 10; // Board size on screen. // Spielfeldgröße auf dem Bildschirm.
+    float boardHeight = cellSize * 20 + labelHeight; // Board plus its score label. // Spielfeld plus seine Punktzahl-Beschriftung.
+    float left = x + (width - (bestColumns * (boardWidth + boardMargin) + boardMargin)) / 2; // Centers the wall in the rectangle. // Zentriert die Wand im Rechteck.
+    float top = y + (height - (rows * (boardHeight + boardMargin) + boardMargin)) / 2; // Vertical centering. // Senkrechte Zentrierung.
+    for (int board = 0; board < boardCount; board++) // Places every board in reading order. // Platziert jedes Spielfeld in Leserichtung.
+    {
+        boardX[board] = left + boardMargin + (board % bestColumns) * (boardWidth + boardMargin); // Left edge from the board's column. // Linker Rand aus der Spalte des Spielfelds.
+        boardY[board] = top + boardMargin + (board / bestColumns) * (boardHeight + boardMargin); // Top edge from the board's row. // Oberer Rand aus der Reihe des Spielfelds.
+    }
+    revision++; // Every board moved. // Jedes Spielfeld hat sich bewegt.
+}
+
+void WallView::Upload() // Region uploads for a few boards, one full upload for many. // Regionen-Uploads für wenige Spielfelder, ein vollständiger Upload für viele.
+{
+    uploadedBoards = (int)dirtyList.size(); // Reported by GetUploadedBoards. // Von GetUploadedBoards gemeldet.
+    if (dirtyList.empty()) // Nothing changed since the last Draw. // Nichts hat sich seit dem letzten Draw geändert.
+    {
+        return; // No texture update this frame. // Kein Textur-Update in diesem Frame.
+    }
+    int atlasWidth = atlasColumns * 10; // Texels per atlas row. // Texel pro Atlasreihe.
+    for (int board : dirtyList) // Copies each changed board's 20 rows into its atlas rectangle, so the CPU atlas always matches the GPU one. // Kopiert die 20 Reihen jedes geänderten Spielfelds in sein Atlas-Rechteck, damit der CPU-Atlas immer dem GPU-Atlas entspricht.
+    {
+        const unsigned int *source = &texels[(size_t)board * 200]; // Packed texels of the board. // Gepackte Texel des Spielfelds.
+        unsigned int *target = &atlasPixels[(size_t)(board / atlasColumns) * 20 * atlasWidth + (board % atlasColumns) * 10]; // Top-left texel of the board in the atlas. // Oberes linkes Texel des Spielfelds im Atlas.
+        for (int row = 0; row < 20; row++) // One atlas row per board row. // Eine Atlasreihe pro Spielfeldreihe.
+        {
+            memcpy(target + (size_t)row * atlasWidth, source + row * 10, 10 * sizeof(unsigned int)); // Ten texels per row. // Zehn Texel pro Reihe.
+        }
+    }
+    if ((int)dirtyList.size() * 2 > boardCount) // Most boards changed: one transfer of the whole atlas beats many small ones. // Die meisten Spielfelder geändert: eine Übertragung des ganzen Atlas schlägt viele kleine.
+    {
+        UpdateTexture(atlas, atlasPixels.data()); // Uploads the whole atlas in one call. // Lädt den ganzen Atlas in einem Aufruf hoch.
+    }
+    else // Few boards changed. // Wenige Spielfelder geändert.
+    {
+        for (int board : dirtyList) // 10x20 texels, already contiguous in texels. // 10x20 Texel, in texels bereits zusammenhängend.
+        {
+            Rectangle region = {(float)((board % atlasColumns) * 10), (float)((board / atlasColumns) * 20), 10, 20}; // Board rectangle in texels. // Spielfeld-Rechteck in Texeln.
+            UpdateTextureRec(atlas, region, &texels[(size_t)board * 200]); // Uploads only this board. // Lädt nur dieses Spielfeld hoch.
+        }
+    }
+    for (int board : dirtyList) // Clears the marks for the next frame. // Löscht die Markierungen für den nächsten Frame.
+    {
+        dirty[board] = 0; // Board can be queued again. // Spielfeld kann wieder eingereiht werden.
+    }
+    dirtyList.clear(); // Empties the queue, keeping its capacity. // Leert die Warteschlange und behält ihre Kapazität.
+}
+
+void WallView::Draw() // Uploads, then submits boards, gaps and labels. // Lädt hoch und übergibt dann Spielfelder, Fugen und Beschriftungen.
+{
+    double start = GetTime(); // Starts the draw timer. // Startet den Draw-Timer.
+    Upload(); // Brings the GPU atlas up to date. // Bringt den GPU-Atlas auf den neuesten Stand.
+    float texelWidth = 1.0f / (atlasColumns * 10); // One texel in texture coordinates. // Ein Texel in Texturkoordinaten.
+    float texelHeight = 1.0f / (atlasRows * 20); // Texel height in texture coordinates. // Texelhöhe in Texturkoordinaten.
+    for (int begin = 0; begin < boardCount; begin += drawChunk) // One textured quad per board, all from the same texture, so raylib keeps them in one draw call. // Ein texturiertes Viereck pro Spielfeld, alle aus derselben Textur, daher behält raylib sie in einem Draw-Call.
+    {
+        int end = begin + drawChunk < boardCount ? begin + drawChunk : boardCount; // Last board of this chunk (exclusive). // Letztes Spielfeld dieses Blocks (exklusiv).
+        rlCheckRenderBatchLimit((end - begin) * 4); // Flushes first if the chunk would not fit. // Leert zuerst, wenn der Block nicht passen würde.
+        rlSetTexture(atlas.id); // Binds the atlas for the quads below. // Bindet den Atlas für die Vierecke unten.
+        rlBegin(RL_QUADS); // Starts a quad list. // Beginnt eine Viereckliste.
+        rlColor4ub(255, 255, 255, 255); // Texels are drawn unchanged. // Texel werden unverändert gezeichnet.
+        for (int board = begin; board < end; board++) // One quad per board. // Ein Viereck pro Spielfeld.
+        {
+            float u0 = (board % atlasColumns) * 10 * texelWidth; // Board rectangle in the atlas. // Spielfeld-Rechteck im Atlas.
+            float v0 = (board / atlasColumns) * 20 * texelHeight; // Top edge in the atlas. // Oberer Rand im Atlas.
+            float u1 = u0 + 10 * texelWidth; // Right edge in the atlas. // Rechter Rand im Atlas.
+            float v1 = v0 + 20 * texelHeight; // Bottom edge in the atlas. // Unterer Rand im Atlas.
+            float left = boardX[board]; // Board rectangle on screen. // Spielfeld-Rechteck auf dem Bildschirm.
+            float top = boardY[board]; // Top edge on screen. // Oberer Rand auf dem Bildschirm.
+            float right = left + cellSize * 10; // Right edge on screen. // Rechter Rand auf dem Bildschirm.
+            float bottom = top + cellSize * 20; // Bottom edge on screen. // Unterer Rand auf dem Bildschirm.
+            rlTexCoord2f(u0, v0); // Counter-clockwise, like DrawTexturePro. // Gegen den Uhrzeigersinn, wie DrawTexturePro.
+            rlVertex2f(left, top); // Top-left corner. // Obere linke Ecke.
+            rlTexCoord2f(u0, v1); // Bottom-left texel. // Unteres linkes Texel.
+            rlVertex2f(left, bottom); // Bottom-left corner. // Untere linke Ecke.
+            rlTexCoord2f(u1, v1); // Bottom-right texel. // Unteres rechtes Texel.
+            rlVertex2f(right, bottom); // Bottom-right corner. // Untere rechte Ecke.
+            rlTexCoord2f(u1, v0); // Top-right texel. // Oberes rechtes Texel.
+            rlVertex2f(right, top); // Top-right corner. // Obere rechte Ecke.
+        }
+        rlEnd(); // Ends the quad list. // Beendet die Viereckliste.
+        rlSetTexture(0); // Back to the default texture. // Zurück zur Standardtextur.
+    }
+    if (cellSize >= gapMinimumCell) // Background-colored gaps at the right and bottom edge of every cell, as Grid::Draw leaves them (1 px at 30-px cells). // Fugen in Hintergrundfarbe am rechten und unteren Rand jeder Zelle, wie Grid::Draw sie lässt (1 px bei 30-px-Zellen).
+    {
+        float gap = cellSize / 30.0f > 1.0f ? cellSize / 30.0f : 1.0f; // Gap width scales with the cells, at least one pixel. // Fugenbreite wächst mit den Zellen, mindestens ein Pixel.
+        for (int begin = 0; begin < boardCount; begin += drawChunk / 30) // 30 gap quads per board (10 columns, 20 rows). // 30 Fugen-Vierecke pro Spielfeld (10 Spalten, 20 Reihen).
+        {
+            int end = begin + drawChunk / 30 < boardCount ? begin + drawChunk / 30 : boardCount; // Last board of this chunk (exclusive). // Letztes Spielfeld dieses Blocks (exklusiv).
+            rlCheckRenderBatchLimit((end - begin) * 30 * 4); // Flushes first if the chunk would not fit. // Leert zuerst, wenn der Block nicht passen würde.
+            rlBegin(RL_QUADS); // Untextured quads. // Untexturierte Vierecke.
+            rlColor4ub(darkBlue.r, darkBlue.g, darkBlue.b, darkBlue.a); // Background color, like the window clear color. // Hintergrundfarbe, wie die Löschfarbe des Fensters.
+            for (int board = begin; board < end; board++) // Gaps of every board in the chunk. // Fugen jedes Spielfelds im Block.
+            {
+                float left = boardX[board]; // Left edge on screen. // Linker Rand auf dem Bildschirm.
+                float top = boardY[board]; // Top edge on screen. // Oberer Rand auf dem Bildschirm.
+                float right = left + cellSize * 10; // Right edge on screen. // Rechter Rand auf dem Bildschirm.
+                float bottom = top + cellSize * 20; // Bottom edge on screen. // Unterer Rand auf dem Bildschirm.
+                for (int column = 1; column <= 10; column++) // Vertical gap after each column. // Senkrechte Fuge nach jeder Spalte.
+                {
+                    float edge = left + column * cellSize; // Right edge of the column. // Rechter Rand der Spalte.
+                    rlVertex2f(edge - gap, top); // Top-left corner of the gap. // Obere linke Ecke der Fuge.
+                    rlVertex2f(edge - gap, bottom); // Bottom-left corner of the gap. // Untere linke Ecke der Fuge.
+                    rlVertex2f(edge, bottom); // Bottom-right corner of the gap. // Untere rechte Ecke der Fuge.
+                    rlVertex2f(edge, top); // Top-right corner of the gap. // Obere rechte Ecke der Fuge.
+                }
+                for (int row = 1; row <= 20; row++) // Horizontal gap after each row. // Waagerechte Fuge nach jeder Reihe.
+                {
+                    float edge = top + row * cellSize; // Bottom edge of the row. // Unterer Rand der Reihe.
+                    rlVertex2f(left, edge - gap); // Top-left corner of the gap. // Obere linke Ecke der Fuge.
+                    rlVertex2f(left, edge); // Bottom-left corner of the gap. // Untere linke Ecke der Fuge.
+                    rlVertex2f(right, edge); // Bottom-right corner of the gap. // Untere rechte Ecke der Fuge.
+                    rlVertex2f(right, edge - gap); // Top-right corner of the gap. // Obere rechte Ecke der Fuge.
+                }
+            }
+            rlEnd(); // Ends the quad list. // Beendet die Viereckliste.
+        }
+    }
+    if (cellSize >= labelMinimumCell) // Scores from the font texture, one more batch. // Punktzahlen aus der Schrifttextur, ein weiterer Stapel.
+    {
+        for (int board = 0; board < boardCount; board++) // One label per board. // Eine Beschriftung pro Spielfeld.
+        {
+            DrawText(TextFormat("%d", scores[board]), (int)boardX[board], (int)(boardY[board] + cellSize * 20 + 2), 10, gameOver[board] ? red : WHITE); // Score below the board, red once the game has ended. // Punktzahl unter dem Spielfeld, rot sobald das Spiel beendet ist.
+        }
+    }
+    drawMs = (GetTime() - start) * 1000.0; // Stores the draw time in milliseconds. // Speichert die Draw-Zeit in Millisekunden.
+}
+
+int WallView::GetBoardCount() // Returns the number of boards. // Gibt die Anzahl der Spielfelder zurück.
+{
+    return boardCount; // Returns the stored count. // Gibt die gespeicherte Anzahl zurück.
+}
+
+int WallView::GetUploadedBoards() // Returns the boards uploaded by the last Draw. // Gibt die vom letzten Draw hochgeladenen Spielfelder zurück.
+{
+    return uploadedBoards; // Returns the stored count. // Gibt die gespeicherte Anzahl zurück.
+}
+
+float WallView::GetCellSize() // Returns the cell size chosen by Layout. // Gibt die von Layout gewählte Zellgröße zurück.
+{
+    return cellSize; // Returns the stored size. // Gibt die gespeicherte Größe zurück.
+}
+
+double WallView::GetDrawMs() // Returns the last draw time. // Gibt die letzte Draw-Zeit zurück.
+{
+    return drawMs; // Returns the stored time. // Gibt die gespeicherte Zeit zurück.
+}
+
+unsigned int WallView::GetRevision() // Returns the visible state revision. // Gibt die sichtbare Zustandsrevision zurück.
+{
+    return revision; // Returns the stored revision. // Gibt die gespeicherte Revision zurück.
+}
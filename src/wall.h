@@ -0,0 +1,62 @@
+/// Wall View Header
+///
+/// Header file declaring the WallView class, which shows many live boards at once at any scale for the C++ Tetris game using raylib. // Header-Datei, die die WallView-Klasse deklariert, die viele laufende Spielfelder gleichzeitig in beliebiger Größe für das C++ Tetris-Spiel mit raylib anzeigt.
+/// Every board is 10x20 texels of one shared atlas texture, one texel per cell; a frame is one textured quad per board in a single rlgl batch. // Jedes Spielfeld sind 10x20 Texel einer gemeinsamen Atlas-Textur, ein Texel pro Zelle; ein Frame ist ein texturiertes Viereck pro Spielfeld in einem einzigen rlgl-Stapel.
+///
+/// Usage:
+/// ```cpp
+/// #include "wall.h"
+///
+/// WallView wall(64);                                          // After InitWindow: creates the atlas texture
+/// wall.Layout(0, 30, GetScreenWidth(), GetScreenHeight() - 30); // Picks columns and cell size to fill the area
+/// wall.SetBoard(i, engine.GetSnapshot());                     // Marks the board dirty only if a cell changed
+/// BeginDrawing();
+/// wall.Draw();                                                // Uploads dirty boards, then draws everything
+/// EndDrawing();
+/// ```
+///
+/// EN: Unchanged boards cost nothing but their quad; a changed board uploads 800 bytes instead of redrawing 200 rectangles.
+/// DE: Unveränderte Spielfelder kosten nur ihr Viereck; ein geändertes Spielfeld lädt 800 Bytes hoch, statt 200 Rechtecke neu zu zeichnen.
+
+#pragma once // Ensures this header file is included only once during compilation. // Stellt sicher, dass diese Header-Datei nur einmal während der Kompilierung eingebunden wird.
+#include <raylib.h> // Includes raylib Texture2D for the atlas. // Inkludiert raylib-Texture2D für den Atlas.
+#include <vector> // Includes vector for the per-board cells, texels and positions. // Inkludiert vector für Zellen, Texel und Positionen pro Spielfeld.
+#include "snapshot.h" // Includes the raylib-free BoardSnapshot each board is fed with. // Inkludiert den raylib-freien BoardSnapshot, mit dem jedes Spielfeld gefüttert wird.
+
+class WallView // Declares the multi-board monitor view. // Deklariert die Mehrfeld-Monitoransicht.
+{
+public: // Public interface accessible from outside the class. // Öffentliche Schnittstelle, die von außerhalb der Klasse zugänglich ist.
+    WallView(int boardCount); // Constructor that allocates every board and creates the atlas texture (needs an open window; clamped to the 4096x4096-texel atlas, 83436 boards). // Konstruktor, der jedes Spielfeld anlegt und die Atlas-Textur erstellt (braucht ein offenes Fenster; auf den Atlas mit 4096x4096 Texeln begrenzt, 83436 Spielfelder).
+    ~WallView(); // Destructor that unloads the atlas texture. // Destruktor, der die Atlas-Textur entlädt.
+    WallView(const WallView &) = delete; // Owns a GPU texture and is not copied. // Besitzt eine GPU-Textur und wird nicht kopiert.
+    WallView &operator=(const WallView &) = delete; // Owns a GPU texture and is not copied. // Besitzt eine GPU-Textur und wird nicht kopiert.
+    void SetBoard(int board, const BoardSnapshot &snapshot); // Takes a board's state; only a change in its cells marks it for upload. // Übernimmt den Zustand eines Spielfelds; nur eine Änderung seiner Zellen markiert es zum Hochladen.
+    void Layout(float x, float y, float width, float height); // Arranges all boards in the rectangle with the largest cell size that fits. // Ordnet alle Spielfelder im Rechteck mit der größten passenden Zellgröße an.
+    void Draw(); // Uploads the dirty boards and draws boards, cell gaps and scores in three batches. // Lädt die geänderten Spielfelder hoch und zeichnet Spielfelder, Zellfugen und Punktzahlen in drei Stapeln.
+    int GetBoardCount(); // Returns the number of boards after clamping. // Gibt die Anzahl der Spielfelder nach der Begrenzung zurück.
+    int GetUploadedBoards(); // Returns the boards uploaded by the last Draw. // Gibt die vom letzten Draw hochgeladenen Spielfelder zurück.
+    float GetCellSize(); // Returns the cell size in pixels chosen by Layout. // Gibt die von Layout gewählte Zellgröße in Pixeln zurück.
+    double GetDrawMs(); // Returns the CPU duration of the last Draw in milliseconds (upload plus batch building). // Gibt die CPU-Dauer des letzten Draw in Millisekunden zurück (Hochladen plus Stapelaufbau).
+    unsigned int GetRevision(); // Returns a counter that changes whenever a board's cells or score change (used to skip redundant redraws). // Gibt einen Zähler zurück, der sich bei jeder Änderung der Zellen oder Punktzahl eines Spielfelds ändert (zum Überspringen überflüssiger Neuzeichnungen).
+
+private: // Private members accessible only within the class. // Private Mitglieder, die nur innerhalb der Klasse zugänglich sind.
+    void Upload(); // Sends the texels of dirty boards to the atlas, one region each or the whole atlas if most changed. // Sendet die Texel geänderter Spielfelder an den Atlas, je eine Region oder den ganzen Atlas, wenn sich die meisten geändert haben.
+    int boardCount; // Number of boards. // Anzahl der Spielfelder.
+    int atlasColumns; // Boards per atlas row. // Spielfelder pro Atlasreihe.
+    int atlasRows; // Atlas rows of boards. // Atlasreihen von Spielfeldern.
+    Texture2D atlas; // GPU texture with every board (10 * atlasColumns x 20 * atlasRows texels). // GPU-Textur mit jedem Spielfeld (10 * atlasColumns x 20 * atlasRows Texel).
+    std::vector<unsigned char> cells; // 200 block ids per board, falling block merged in (compared on every SetBoard). // 200 Block-IDs pro Spielfeld, fallender Block eingefügt (bei jedem SetBoard verglichen).
+    std::vector<unsigned int> texels; // 200 RGBA texels per board, contiguous for one UpdateTextureRec each. // 200 RGBA-Texel pro Spielfeld, zusammenhängend für je ein UpdateTextureRec.
+    std::vector<unsigned int> atlasPixels; // Whole atlas in texture layout, used when most boards changed at once. // Ganzer Atlas im Texturlayout, verwendet, wenn sich die meisten Spielfelder auf einmal geändert haben.
+    std::vector<int> scores; // Score label per board. // Punktzahl-Beschriftung pro Spielfeld.
+    std::vector<unsigned char> gameOver; // 1 if a board's game has ended (label drawn in red). // 1, wenn das Spiel eines Spielfelds beendet ist (Beschriftung in Rot gezeichnet).
+    std::vector<unsigned char> dirty; // 1 if a board waits for upload. // 1, wenn ein Spielfeld auf das Hochladen wartet.
+    std::vector<int> dirtyList; // Boards waiting for upload, each listed once. // Auf das Hochladen wartende Spielfelder, jedes einmal gelistet.
+    std::vector<float> boardX; // Left edge of each board on screen. // Linker Rand jedes Spielfelds auf dem Bildschirm.
+    std::vector<float> boardY; // Top edge of each board on screen. // Oberer Rand jedes Spielfelds auf dem Bildschirm.
+    float cellSize; // Cell size in pixels (any positive value, not limited to whole pixels). // Zellgröße in Pixeln (jeder positive Wert, nicht auf ganze Pixel beschränkt).
+    unsigned int rgbaColors[8]; // GetCellColors() packed into 32-bit words in memory byte order. // GetCellColors() gepackt in 32-Bit-Wörter in Speicher-Byte-Reihenfolge.
+    int uploadedBoards; // Boards uploaded by the last Draw. // Vom letzten Draw hochgeladene Spielfelder.
+    double drawMs; // CPU time of the last Draw. // CPU-Zeit des letzten Draw.
+    unsigned int revision; // Incremented whenever a board's cells or score change or Layout moves the boards. // Wird bei jeder Änderung der Zellen oder Punktzahl eines Spielfelds erhöht oder wenn Layout die Spielfelder verschiebt.
+};
@@ -0,0 +1,136 @@
+/// Worker Pool Implementation
+/// 
+/// Persistent thread pool used by the headless environment, planner and server of the C++ Tetris game. // Persistenter Thread-Pool, der von der headless Umgebung, dem Planer und dem Server des C++ Tetris-Spiels verwendet wird.
+/// Chunks are handed out through an atomic counter, so fast threads automatically take more of the work. // Blöcke werden über einen atomaren Zähler verteilt, sodass schnelle Threads automatisch mehr Arbeit übernehmen.
+/// 
+/// Usage:
+/// ```cpp
+/// WorkerPool pool = WorkerPool(4);
+/// pool.RunOnAll([&](int thread) { results[thread] = Simulate(thread); });
+/// ```
+/// 
+/// EN: The calling thread always takes part in the work, so a pool of one thread runs everything inline without any locking.
+/// DE: Der aufrufende Thread nimmt immer an der Arbeit teil, daher führt ein Pool mit einem Thread alles direkt ohne Sperren aus.
+
+#include "workers.h" // Includes the WorkerPool class header file with declarations. // Inkludiert die WorkerPool-Klassen-Header-Datei mit Deklarationen.
+
+WorkerPool::WorkerPool(int threads) // Constructor that starts threads - 1 worker threads. // Konstruktor, der threads - 1 Worker-Threads startet.
+{
+    if (threads <= 0) // Uses all hardware threads when no count was given. // Verwendet alle Hardware-Threads, wenn keine Anzahl angegeben wurde.
+    {
+        threads = (int)std::thread::hardware_concurrency(); // Number of hardware threads (may be 0 if unknown). // Anzahl der Hardware-Threads (kann 0 sein, wenn unbekannt).
+        if (threads <= 0)
+        {
+            threads = 1; // Falls back to running inline. // Fällt auf direkte Ausführung zurück.
+        }
+    }
+    batchFunction = nullptr; // No batch yet. // Noch kein Stapel.
+    batchContext = nullptr; // No batch yet. // Noch kein Stapel.
+    chunkCount = 0; // No chunks yet. // Noch keine Blöcke.
+    nextChunk = 0; // Nothing handed out yet. // Noch nichts ausgegeben.
+    busyWorkers = 0; // No worker is busy. // Kein Worker ist beschäftigt.
+    generation = 0; // First batch will be generation 1. // Erster Stapel wird Generation 1.
+    stopping = false; // Workers keep running until destruction. // Worker laufen bis zur Zerstörung.
+    try // A failed thread start must not leave joinable threads behind (their destructor would terminate). // Ein fehlgeschlagener Thread-Start darf keine zusammenführbaren Threads hinterlassen (ihr Destruktor würde abbrechen).
+    {
+        for (int i = 1; i < threads; i++) // Starts the worker threads (index 0 is the caller). // Startet die Worker-Threads (Index 0 ist der Aufrufer).
+        {
+            this->threads.emplace_back(&WorkerPool::WorkerLoop, this, i); // Each worker knows its thread index. // Jeder Worker kennt seinen Thread-Index.
+        }
+    }
+    catch (...)
+    {
+        Stop(); // Joins the workers that did start. // Führt die Worker zusammen, die gestartet sind.
+        throw; // The caller sees the original error. // Der Aufrufer sieht den ursprünglichen Fehler.
+    }
+}
+
+WorkerPool::~WorkerPool() // Destructor that wakes and joins all workers. // Destruktor, der alle Worker aufweckt und zusammenführt.
+{
+    Stop(); // Leaves no thread running. // Lässt keinen Thread laufen.
+}
+
+void WorkerPool::Stop() // Wakes and joins all workers started so far. // Weckt alle bisher gestarteten Worker auf und führt sie zusammen.
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex); // Protects the stop flag. // Schützt die Stopp-Flagge.
+        stopping = true; // Tells workers to leave their loop. // Sagt den Workern, ihre Schleife zu verlassen.
+    }
+    wake.notify_all(); // Wakes every parked worker. // Weckt jeden geparkten Worker.
+    for (std::thread &thread : threads) // Waits for every worker to exit. // Wartet, bis jeder Worker beendet ist.
+    {
+        thread.join();
+    }
+    threads.clear(); // Joined threads are no longer workers. // Zusammengeführte Threads sind keine Worker mehr.
+}
+
+int WorkerPool::GetThreadCount() // Returns workers plus the calling thread. // Gibt Worker plus den aufrufenden Thread zurück.
+{
+    return (int)threads.size() + 1; // The caller always participates. // Der Aufrufer nimmt immer teil.
+}
+
+std::vector<int> WorkerPool::GetThreadSweep() // Lists the counts up front, so any core count (3, 5, 6, ...) ends the sweep. // Listet die Anzahlen vorab auf, damit jede Kernzahl (3, 5, 6, ...) den Durchlauf beendet.
+{
+    int maxThreads = (int)std::thread::hardware_concurrency(); // Upper end of the sweep (may be 0 if unknown). // Oberes Ende des Durchlaufs (kann 0 sein, wenn unbekannt).
+    if (maxThreads < 1)
+    {
+        maxThreads = 1; // Falls back to a single measurement. // Fällt auf eine einzige Messung zurück.
+    }
+    std::vector<int> counts; // Thread counts in measuring order. // Thread-Anzahlen in Messreihenfolge.
+    for (int threads = 1; threads < maxThreads; threads *= 2) // Powers of two below the hardware thread count. // Zweierpotenzen unter der Hardware-Thread-Anzahl.
+    {
+        counts.push_back(threads);
+    }
+    counts.push_back(maxThreads); // Always ends with every hardware thread. // Endet immer mit allen Hardware-Threads.
+    return counts;
+}
+
+void WorkerPool::Dispatch(int chunks, ChunkFunction function, const void *context) // Publishes a batch, helps with it and waits until it is finished. // Veröffentlicht einen Stapel, hilft dabei und wartet, bis er fertig ist.
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex); // Protects the batch description. // Schützt die Stapelbeschreibung.
+        batchFunction = function; // Publishes the callback. // Veröffentlicht den Callback.
+        batchContext = context; // Publishes its context. // Veröffentlicht seinen Kontext.
+        chunkCount = chunks; // Publishes the chunk count. // Veröffentlicht die Blockanzahl.
+        nextChunk = 0; // Restarts chunk distribution. // Startet die Blockverteilung neu.
+        busyWorkers = (int)threads.size(); // Every worker takes part in (or at least checks in for) every batch. // Jeder Worker nimmt an jedem Stapel teil (oder meldet sich zumindest).
+        generation++; // Marks a new batch. // Markiert einen neuen Stapel.
+    }
+    wake.notify_all(); // Wakes the workers. // Weckt die Worker.
+    RunChunks(0); // The caller works as thread 0. // Der Aufrufer arbeitet als Thread 0.
+    std::unique_lock<std::mutex> lock(mutex); // Waits until every worker left the batch, so no worker can touch it after returning. // Wartet, bis jeder Worker den Stapel verlassen hat, damit kein Worker ihn nach der Rückkehr berührt.
+    done.wait(lock, [&] { return busyWorkers == 0; });
+    batchFunction = nullptr; // The context goes out of scope after returning. // Der Kontext verlässt nach der Rückkehr den Gültigkeitsbereich.
+    batchContext = nullptr;
+}
+
+void WorkerPool::RunChunks(int threadIndex) // Takes chunks from the shared counter until the batch is exhausted. // Nimmt Blöcke vom gemeinsamen Zähler, bis der Stapel erschöpft ist.
+{
+    for (int chunk = nextChunk.fetch_add(1); chunk < chunkCount; chunk = nextChunk.fetch_add(1)) // Claims the next free chunk. // Beansprucht den nächsten freien Block.
+    {
+        batchFunction(batchContext, chunk, threadIndex); // Runs the chunk. // Führt den Block aus.
+    }
+}
+
+void WorkerPool::WorkerLoop(int index) // Parks until a new batch appears, then helps with it. // Parkt, bis ein neuer Stapel erscheint, und hilft dann dabei.
+{
+    unsigned long long seen = 0; // Last generation this worker processed. // Letzte von diesem Worker bearbeitete Generation.
+    while (true) // Runs until the pool is destroyed. // Läuft, bis der Pool zerstört wird.
+    {
+        {
+            std::unique_lock<std::mutex> lock(mutex); // Waits for a new generation or stop. // Wartet auf eine neue Generation oder Stopp.
+            wake.wait(lock, [&] { return stopping || generation != seen; });
+            if (stopping) // The pool is shutting down. // Der Pool wird heruntergefahren.
+            {
+                return;
+            }
+            seen = generation; // Processes this batch once. // Bearbeitet diesen Stapel einmal.
+        }
+        RunChunks(index); // Helps with the current batch. // Hilft beim aktuellen Stapel.
+        std::lock_guard<std::mutex> lock(mutex); // Protects the busy counter. // Schützt den Beschäftigt-Zähler.
+        if (--busyWorkers == 0) // The last worker to leave signals the caller. // Der letzte Worker, der geht, signalisiert dem Aufrufer.
+        {
+            done.notify_one();
+        }
+    }
+}
@@ -0,0 +1,107 @@
+/// Worker Pool Header
+/// 
+/// Header file declaring the WorkerPool class, a small persistent thread pool for the C++ Tetris game's headless tools. // Header-Datei, die die WorkerPool-Klasse deklariert, einen kleinen persistenten Thread-Pool für die headless Werkzeuge des C++ Tetris-Spiels.
+/// Splits an index range into chunks and runs them on parked worker threads plus the calling thread. // Teilt einen Indexbereich in Blöcke und führt sie auf geparkten Worker-Threads plus dem aufrufenden Thread aus.
+/// 
+/// Usage:
+/// ```cpp
+/// #include "workers.h"
+/// 
+/// WorkerPool pool = WorkerPool(0); // 0 = one thread per hardware thread
+/// pool.ParallelFor(numGames, 64, [&](int begin, int end) {
+///     for (int i = begin; i < end; i++) games[i].MoveBlockDown();
+/// });
+/// ```
+/// 
+/// EN: Threads are created once and reused, so dispatching a batch costs a wake-up instead of a thread start.
+/// DE: Threads werden einmal erzeugt und wiederverwendet, daher kostet das Verteilen eines Stapels ein Aufwecken statt eines Thread-Starts.
+
+#pragma once // Ensures this header file is included only once during compilation. // Stellt sicher, dass diese Header-Datei nur einmal während der Kompilierung eingebunden wird.
+#include <atomic> // Includes atomics for lock-free chunk distribution. // Inkludiert Atomics für sperrfreie Blockverteilung.
+#include <condition_variable> // Includes condition variables for parking idle workers. // Inkludiert Bedingungsvariablen zum Parken untätiger Worker.
+#include <mutex> // Includes mutexes guarding the dispatch state. // Inkludiert Mutexe, die den Verteilungszustand schützen.
+#include <thread> // Includes std::thread for the worker threads. // Inkludiert std::thread für die Worker-Threads.
+#include <vector> // Includes vector for the thread list. // Inkludiert vector für die Thread-Liste.
+
+class WorkerPool // Declares the WorkerPool class that runs index ranges in parallel. // Deklariert die WorkerPool-Klasse, die Indexbereiche parallel ausführt.
+{
+public: // Public interface accessible from outside the class. // Öffentliche Schnittstelle, die von außerhalb der Klasse zugänglich ist.
+    WorkerPool(int threads); // Constructor taking the total thread count including the caller (0 = hardware concurrency). // Konstruktor mit der Gesamtzahl der Threads einschließlich des Aufrufers (0 = Hardware-Parallelität).
+    ~WorkerPool(); // Destructor that stops and joins all worker threads. // Destruktor, der alle Worker-Threads stoppt und zusammenführt.
+    WorkerPool(const WorkerPool &) = delete; // Threads cannot be copied. // Threads können nicht kopiert werden.
+    WorkerPool &operator=(const WorkerPool &) = delete; // Threads cannot be copied. // Threads können nicht kopiert werden.
+    int GetThreadCount(); // Returns the total number of threads that execute chunks. // Gibt die Gesamtzahl der Threads zurück, die Blöcke ausführen.
+    static std::vector<int> GetThreadSweep(); // Returns the thread counts a benchmark measures: 1, 2, 4, ... below the hardware thread count, then that count itself. // Gibt die Thread-Anzahlen zurück, die ein Benchmark misst: 1, 2, 4, ... unter der Hardware-Thread-Anzahl, dann diese Anzahl selbst.
+    template <typename Body> void ParallelFor(int count, int grain, const Body &body); // Runs body(begin, end) over [0, count) in chunks of at least grain items and waits for completion. // Führt body(begin, end) über [0, count) in Blöcken von mindestens grain Elementen aus und wartet auf Abschluss.
+    template <typename Body> void RunOnAll(const Body &body); // Runs body(threadIndex) once on every thread and waits for completion. // Führt body(threadIndex) einmal auf jedem Thread aus und wartet auf Abschluss.
+
+private: // Private members accessible only within the class. // Private Mitglieder, die nur innerhalb der Klasse zugänglich sind.
+    typedef void (*ChunkFunction)(const void *context, int chunk, int threadIndex); // Type-erased chunk callback (no std::function, so dispatching never allocates). // Typgelöschter Block-Callback (keine std::function, daher legt das Verteilen nie Speicher an).
+    void Stop(); // Wakes and joins every started worker (used by the destructor and a failed constructor). // Weckt jeden gestarteten Worker auf und führt ihn zusammen (vom Destruktor und einem fehlgeschlagenen Konstruktor verwendet).
+    void WorkerLoop(int index); // Main loop of a worker thread: waits for a batch, takes chunks, reports completion. // Hauptschleife eines Worker-Threads: wartet auf einen Stapel, nimmt Blöcke, meldet Abschluss.
+    void Dispatch(int chunks, ChunkFunction function, const void *context); // Publishes a batch of chunks and helps until all are done. // Veröffentlicht einen Stapel von Blöcken und hilft, bis alle erledigt sind.
+    void RunChunks(int threadIndex); // Takes and runs chunks of the current batch until none are left. // Nimmt und führt Blöcke des aktuellen Stapels aus, bis keine mehr übrig sind.
+    std::vector<std::thread> threads; // Worker threads (the caller is thread 0 and not stored here). // Worker-Threads (der Aufrufer ist Thread 0 und wird hier nicht gespeichert).
+    std::mutex mutex; // Guards generation, stopping and the batch callback. // Schützt Generation, Stopp-Flagge und den Stapel-Callback.
+    std::condition_variable wake; // Signals workers that a new batch is available. // Signalisiert Workern, dass ein neuer Stapel verfügbar ist.
+    std::condition_variable done; // Signals the caller that all workers left the batch. // Signalisiert dem Aufrufer, dass alle Worker den Stapel verlassen haben.
+    ChunkFunction batchFunction; // Current batch callback. // Aktueller Stapel-Callback.
+    const void *batchContext; // Context pointer passed to the batch callback. // An den Stapel-Callback übergebener Kontextzeiger.
+    int chunkCount; // Number of chunks in the current batch. // Anzahl der Blöcke im aktuellen Stapel.
+    std::atomic<int> nextChunk; // Next chunk index to hand out. // Nächster auszugebender Blockindex.
+    int busyWorkers; // Workers that have not finished the current batch yet (guarded by mutex). // Worker, die den aktuellen Stapel noch nicht beendet haben (durch mutex geschützt).
+    unsigned long long generation; // Incremented for every batch so workers see each batch exactly once. // Wird für jeden Stapel erhöht, damit Worker jeden Stapel genau einmal sehen.
+    bool stopping; // Set by the destructor to end the worker loops. // Wird vom Destruktor gesetzt, um die Worker-Schleifen zu beenden.
+};
+
+template <typename Body>
+void WorkerPool::ParallelFor(int count, int grain, const Body &body) // Splits [0, count) into chunks and runs them in parallel. // Teilt [0, count) in Blöcke und führt sie parallel aus.
+{
+    if (count <= 0) // Nothing to do. // Nichts zu tun.
+    {
+        return;
+    }
+    if (grain < 1) // A chunk holds at least one item. // Ein Block enthält mindestens ein Element.
+    {
+        grain = 1;
+    }
+    int chunks = (count + grain - 1) / grain; // Number of chunks of grain items (the last one may be shorter). // Anzahl der Blöcke mit grain Elementen (der letzte kann kürzer sein).
+    if (chunks == 1 || threads.empty()) // Too little work or no workers: runs inline without synchronization. // Zu wenig Arbeit oder keine Worker: führt direkt ohne Synchronisation aus.
+    {
+        body(0, count);
+        return;
+    }
+    struct Range // Everything a chunk needs to compute its item range. // Alles, was ein Block zur Berechnung seines Elementbereichs braucht.
+    {
+        const Body *body;
+        int count;
+        int grain;
+        static void Run(const void *context, int chunk, int) // Converts a chunk index into its item range. // Wandelt einen Blockindex in seinen Elementbereich um.
+        {
+            const Range *range = static_cast<const Range *>(context);
+            int begin = chunk * range->grain;
+            int end = begin + range->grain < range->count ? begin + range->grain : range->count;
+            (*range->body)(begin, end);
+        }
+    };
+    Range range = {&body, count, grain}; // Lives on the caller's stack for the duration of the batch. // Lebt für die Dauer des Stapels auf dem Stack des Aufrufers.
+    Dispatch(chunks, &Range::Run, &range); // Runs all chunks and waits. // Führt alle Blöcke aus und wartet.
+}
+
+template <typename Body>
+void WorkerPool::RunOnAll(const Body &body) // Runs one chunk per thread, passing the thread slot index. // Führt einen Block pro Thread aus und übergibt den Thread-Platz-Index.
+{
+    if (threads.empty()) // Single-threaded pool. // Einzelthread-Pool.
+    {
+        body(0);
+        return;
+    }
+    struct Slot // Adapter from chunk index to thread slot. // Adapter von Blockindex zu Thread-Platz.
+    {
+        static void Run(const void *context, int chunk, int) // Chunk i is simply "thread slot i". // Block i ist einfach "Thread-Platz i".
+        {
+            (*static_cast<const Body *>(context))(chunk);
+        }
+    };
+    Dispatch(GetThreadCount(), &Slot::Run, &body); // Runs one slot per thread and waits. // Führt einen Platz pro Thread aus und wartet.
+}
@@ -0,0 +1,61 @@
+/// Zobrist Keys Implementation
+/// 
+/// Generates the Zobrist key tables for the C++ Tetris game from a fixed SplitMix64 sequence at program start. // Erzeugt die Zobrist-Schlüsseltabellen für das C++ Tetris-Spiel beim Programmstart aus einer festen SplitMix64-Folge.
+/// The falling block is hashed by the cells it covers, so rotation states with identical cells share one hash. // Der fallende Block wird über die von ihm bedeckten Zellen gehasht, daher teilen Rotationszustände mit identischen Zellen einen Hash.
+/// 
+/// Usage:
+/// ```cpp
+/// unsigned long long key = grid.hash ^ HashFallingBlock(id, rows, columns) ^ zobrist.nextId[nextId] ^ zobrist.bag[bag];
+/// ```
+/// 
+/// EN: Game and Engine use the same keys, so the same position hashes identically in the window and in headless code.
+/// DE: Game und Engine verwenden dieselben Schlüssel, daher hasht dieselbe Stellung im Fenster und im headless Code identisch.
+
+#include "zobrist.h" // Includes the key table declarations. // Inkludiert die Deklarationen der Schlüsseltabellen.
+#include "engine.h" // Includes the shared SplitMix64 generator. // Inkludiert den gemeinsamen SplitMix64-Generator.
+
+static ZobristKeys MakeZobristKeys() // Fills every table from one deterministic random sequence. // Füllt jede Tabelle aus einer deterministischen Zufallsfolge.
+{
+    ZobristKeys keys; // Tables being filled. // Zu füllende Tabellen.
+    unsigned long long state = 0x5445545249535A42ULL; // Fixed seed ("TETRISZB") so hashes never change between runs. // Fester Seed ("TETRISZB"), damit sich Hashes zwischen Läufen nie ändern.
+    auto next = [&state]() { // SplitMix64 step (same generator as Engine). // SplitMix64-Schritt (derselbe Generator wie Engine).
+        return SplitMix64(state);
+    };
+    for (int row = 0; row < 20; row++) // Keys for every grid cell. // Schlüssel für jede Rasterzelle.
+    {
+        for (int column = 0; column < 10; column++)
+        {
+            keys.cells[row][column][0] = 0; // Empty cells do not contribute, so a cleared grid hashes to 0. // Leere Zellen tragen nichts bei, daher hasht ein geräumtes Raster zu 0.
+            for (int id = 1; id < 8; id++) // One key per block id. // Ein Schlüssel pro Block-ID.
+            {
+                keys.cells[row][column][id] = next();
+            }
+            keys.falling[row][column] = next(); // Key for a falling-block cell here. // Schlüssel für eine Zelle des fallenden Blocks hier.
+        }
+    }
+    for (int id = 0; id < 8; id++) // Keys for block ids. // Schlüssel für Block-IDs.
+    {
+        keys.currentId[id] = next();
+        keys.nextId[id] = next();
+    }
+    for (int mask = 0; mask < 128; mask++) // Keys for all bag states. // Schlüssel für alle Beutelzustände.
+    {
+        keys.bag[mask] = next();
+    }
+    return keys; // Returns the filled tables. // Gibt die gefüllten Tabellen zurück.
+}
+
+const ZobristKeys zobrist = MakeZobristKeys(); // Built once during static initialization. // Einmalig während der statischen Initialisierung gebaut.
+
+unsigned long long HashFallingBlock(int id, const int *rows, const int *columns) // XORs the id key and the keys of the four covered cells. // Verknüpft den ID-Schlüssel und die Schlüssel der vier bedeckten Zellen per XOR.
+{
+    unsigned long long hash = zobrist.currentId[id]; // Starts with the block id. // Beginnt mit der Block-ID.
+    for (int i = 0; i < 4; i++) // Adds every covered cell. // Fügt jede bedeckte Zelle hinzu.
+    {
+        if (rows[i] >= 0 && rows[i] < 20 && columns[i] >= 0 && columns[i] < 10) // Valid positions are always inside; this only guards the table index. // Gültige Positionen sind immer innerhalb; dies schützt nur den Tabellenindex.
+        {
+            hash ^= zobrist.falling[rows[i]][columns[i]];
+        }
+    }
+    return hash; // Returns the falling block hash. // Gibt den Hash des fallenden Blocks zurück.
+}
@@ -0,0 +1,30 @@
+/// Zobrist Keys Header
+/// 
+/// Header file declaring the Zobrist key tables used to hash Tetris positions in the C++ Tetris game. // Header-Datei, die die Zobrist-Schlüsseltabellen zum Hashen von Tetris-Stellungen im C++ Tetris-Spiel deklariert.
+/// A position hash is the XOR of one random 64-bit key per occupied cell, falling-block cell, block id and bag state. // Ein Stellungs-Hash ist das XOR je eines zufälligen 64-Bit-Schlüssels pro belegter Zelle, Zelle des fallenden Blocks, Block-ID und Beutelzustand.
+/// 
+/// Usage:
+/// ```cpp
+/// #include "zobrist.h"
+/// 
+/// hash ^= zobrist.cells[row][column][id];   // Cell (row, column) becomes block id
+/// hash ^= zobrist.cells[row][column][id];   // ... and is emptied again (XOR undoes itself)
+/// ```
+/// 
+/// EN: Because XOR is its own inverse, Grid and Engine update the hash cell by cell instead of rehashing the whole board.
+/// DE: Da XOR sein eigenes Inverses ist, aktualisieren Grid und Engine den Hash Zelle für Zelle, statt das ganze Spielfeld neu zu hashen.
+
+#pragma once // Ensures this header file is included only once during compilation. // Stellt sicher, dass diese Header-Datei nur einmal während der Kompilierung eingebunden wird.
+
+struct ZobristKeys // All random keys, generated once from a fixed seed so hashes are stable across runs. // Alle Zufallsschlüssel, einmalig aus einem festen Seed erzeugt, damit Hashes über Läufe hinweg stabil sind.
+{
+    unsigned long long cells[20][10][8]; // Locked cell keys per [row][column][block id] (id 0 = empty is all zero). // Schlüssel gesperrter Zellen pro [Reihe][Spalte][Block-ID] (ID 0 = leer ist komplett null).
+    unsigned long long falling[20][10]; // Keys of the cells covered by the falling block. // Schlüssel der vom fallenden Block bedeckten Zellen.
+    unsigned long long currentId[8]; // Key of the falling block's id. // Schlüssel der ID des fallenden Blocks.
+    unsigned long long nextId[8]; // Key of the preview block's id. // Schlüssel der ID des Vorschaublocks.
+    unsigned long long bag[128]; // Key per bag bit mask (remaining block ids). // Schlüssel pro Beutel-Bitmaske (verbleibende Block-IDs).
+};
+
+extern const ZobristKeys zobrist; // The shared, immutable key tables. // Die geteilten, unveränderlichen Schlüsseltabellen.
+
+unsigned long long HashFallingBlock(int id, const int *rows, const int *columns); // Hashes a falling block by its id and four covered cells (cells outside the grid are ignored). // Hasht einen fallenden Block über seine ID und vier bedeckte Zellen (Zellen außerhalb des Rasters werden ignoriert).
@@ -0,0 +1,74 @@
+/// Environment Throughput Benchmark
+/// 
+/// Command-line tool that measures steps per second of the vectorized Tetris environment (tetrisenv.h). // Kommandozeilenwerkzeug, das Schritte pro Sekunde der vektorisierten Tetris-Umgebung (tetrisenv.h) misst.
+/// Steps a batch of games with random actions for a fixed time, once per thread count from 1 up to all hardware threads. // Führt einen Stapel von Spielen mit zufälligen Aktionen für eine feste Zeit aus, einmal pro Thread-Anzahl von 1 bis zu allen Hardware-Threads.
+/// 
+/// Usage:
+/// ```cpp
+/// // Build and run (no raylib needed)
+/// g++ -O2 -std=c++14 -Isrc -o env_bench tools/env_bench.cpp src/tetrisenv.cpp src/engine.cpp src/shapes.cpp src/zobrist.cpp src/workers.cpp -lpthread
+/// ./env_bench 4096 2.0   // 4096 games, 2 seconds per measurement
+/// ```
+/// 
+/// EN: Uses only the C interface, exactly like an external training process would.
+/// DE: Verwendet nur die C-Schnittstelle, genau wie ein externer Trainingsprozess.
+
+#include "tetrisenv.h" // Includes the C interface under test. // Inkludiert die getestete C-Schnittstelle.
+#include "workers.h" // Includes WorkerPool::GetThreadSweep for the thread counts. // Inkludiert WorkerPool::GetThreadSweep für die Thread-Anzahlen.
+#include <chrono> // Includes steady_clock for timing. // Inkludiert steady_clock für die Zeitmessung.
+#include <cstdio> // Includes printf for the report. // Inkludiert printf für den Bericht.
+#include <cstdlib> // Includes atoi/atof for arguments. // Inkludiert atoi/atof für Argumente.
+#include <vector> // Includes vector for the caller-owned buffers. // Inkludiert vector für die Puffer des Aufrufers.
+
+int main(int argc, char **argv) // Entry point: argv[1] = number of games, argv[2] = seconds per measurement. // Einstiegspunkt: argv[1] = Anzahl Spiele, argv[2] = Sekunden pro Messung.
+{
+    int games = argc > 1 ? atoi(argv[1]) : 4096; // Batch size. // Stapelgröße.
+    double seconds = argc > 2 ? atof(argv[2]) : 2.0; // Duration of each measurement. // Dauer jeder Messung.
+
+    TetrisEnv *env = tetris_env_create(games, 12345); // Creates the batch. // Erzeugt den Stapel.
+    if (env == nullptr)
+    {
+        printf("tetris_env_create failed\n");
+        return 1;
+    }
+    std::vector<unsigned char> observations((size_t)games * TETRIS_ENV_OBS_SIZE); // Caller-owned observation buffer. // Beobachtungspuffer des Aufrufers.
+    std::vector<float> rewards(games); // Caller-owned reward buffer. // Belohnungspuffer des Aufrufers.
+    std::vector<unsigned char> dones(games); // Caller-owned done buffer. // Ende-Puffer des Aufrufers.
+    std::vector<int> actions(games); // Caller-owned action buffer. // Aktionspuffer des Aufrufers.
+    unsigned int random = 2463534242u; // Xorshift state for random actions. // Xorshift-Zustand für zufällige Aktionen.
+    tetris_env_reset(env, observations.data()); // Starts all episodes. // Startet alle Episoden.
+
+    printf("%d games, %d bytes per observation\n", games, TETRIS_ENV_OBS_SIZE);
+    for (int threads : WorkerPool::GetThreadSweep()) // Sweeps 1, 2, 4, ... threads and all hardware threads. // Durchläuft 1, 2, 4, ... Threads und alle Hardware-Threads.
+    {
+        if (tetris_env_set_threads(env, threads) != 0) // Resizes the worker pool. // Ändert die Größe des Worker-Pools.
+        {
+            printf("threads %2d: could not start the threads\n", threads);
+            continue;
+        }
+        long long steps = 0; // Game steps performed. // Durchgeführte Spielschritte.
+        long long episodes = 0; // Finished games. // Beendete Spiele.
+        auto start = std::chrono::steady_clock::now(); // Start timestamp. // Start-Zeitstempel.
+        double elapsed = 0.0; // Seconds elapsed so far. // Bisher verstrichene Sekunden.
+        while (elapsed < seconds) // Steps until the time budget is used. // Führt Schritte aus, bis das Zeitbudget verbraucht ist.
+        {
+            for (int i = 0; i < games; i++) // Picks a random action per game. // Wählt eine zufällige Aktion pro Spiel.
+            {
+                random ^= random << 13;
+                random ^= random >> 17;
+                random ^= random << 5;
+                actions[i] = (int)(random % 5);
+            }
+            tetris_env_step(env, actions.data(), observations.data(), rewards.data(), dones.data()); // One step of every game. // Ein Schritt jedes Spiels.
+            steps += games;
+            for (int i = 0; i < games; i++) // Counts finished episodes. // Zählt beendete Episoden.
+            {
+                episodes += dones[i];
+            }
+            elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        }
+        printf("threads %2d: %12.0f steps/s  (%lld episodes finished)\n", threads, steps / elapsed, episodes); // Reports throughput. // Meldet den Durchsatz.
+    }
+    tetris_env_destroy(env); // Frees the batch. // Gibt den Stapel frei.
+    return 0;
+}
@@ -0,0 +1,205 @@
+/// Server Load Generator
+/// 
+/// Linux command-line client that opens many connections to tetris_server and sends random key presses at a fixed rate per connection. // Linux-Kommandozeilen-Client, der viele Verbindungen zu tetris_server öffnet und zufällige Tastendrücke mit fester Rate pro Verbindung sendet.
+/// Measures the input-to-confirmation latency (send of an input until a StateMessage acknowledges it) and reports p50/p99/max. // Misst die Latenz von Eingabe bis Bestätigung (Senden einer Eingabe bis eine StateMessage sie bestätigt) und meldet p50/p99/max.
+/// 
+/// Usage:
+/// ```cpp
+/// // Build and run (Linux only, no raylib needed)
+/// g++ -O2 -std=c++14 -Isrc -o load_client tools/load_client.cpp
+/// ./load_client 127.0.0.1 7777 1000 10 5   // host, port, connections, seconds, inputs per second per connection
+/// ```
+/// 
+/// EN: The latency includes waiting for the next tick, so at 60 ticks/s about 8 ms on average is the tick schedule itself, not server load.
+/// DE: Die Latenz enthält das Warten auf den nächsten Tick, daher sind bei 60 Ticks/s durchschnittlich etwa 8 ms der Tick-Takt selbst, nicht die Serverlast.
+
+#include "protocol.h" // Includes the wire messages. // Inkludiert die Übertragungsnachrichten.
+#include <algorithm> // Includes sort for the percentiles. // Inkludiert sort für die Perzentile.
+#include <arpa/inet.h> // Includes inet_pton for the server address. // Inkludiert inet_pton für die Serveradresse.
+#include <cerrno> // Includes errno for non-blocking I/O. // Inkludiert errno für nicht blockierende Ein-/Ausgabe.
+#include <chrono> // Includes steady_clock for send times. // Inkludiert steady_clock für Sendezeiten.
+#include <csignal> // Includes signal to ignore SIGPIPE. // Inkludiert signal, um SIGPIPE zu ignorieren.
+#include <cstdio> // Includes printf for the report. // Inkludiert printf für den Bericht.
+#include <cstdlib> // Includes atoi/atof for arguments. // Inkludiert atoi/atof für Argumente.
+#include <cstring> // Includes memcpy for message parsing. // Inkludiert memcpy für das Nachrichtenparsen.
+#include <fcntl.h> // Includes fcntl to make sockets non-blocking. // Inkludiert fcntl, um Sockets nicht blockierend zu machen.
+#include <netinet/in.h> // Includes sockaddr_in. // Inkludiert sockaddr_in.
+#include <netinet/tcp.h> // Includes TCP_NODELAY. // Inkludiert TCP_NODELAY.
+#include <sys/epoll.h> // Includes epoll for the receive loop. // Inkludiert epoll für die Empfangsschleife.
+#include <sys/socket.h> // Includes the socket calls. // Inkludiert die Socket-Aufrufe.
+#include <unistd.h> // Includes read/close. // Inkludiert read/close.
+#include <vector> // Includes vector for clients and samples. // Inkludiert vector für Clients und Messwerte.
+
+struct Client // One simulated player. // Ein simulierter Spieler.
+{
+    int fd; // Non-blocking socket. // Nicht blockierender Socket.
+    uint32_t sequence; // Last input sequence sent. // Zuletzt gesendete Eingabesequenz.
+    uint32_t acked; // Last sequence confirmed by the server. // Letzte vom Server bestätigte Sequenz.
+    double sendTimes[256]; // Send time of each sequence (by sequence % 256). // Sendezeit jeder Sequenz (nach Sequenz % 256).
+    double nextSend; // Time of the next input. // Zeitpunkt der nächsten Eingabe.
+    unsigned char buffer[64]; // Partial message carried over between reads. // Teilnachricht, die zwischen Lesevorgängen übertragen wird.
+    int length; // Bytes in buffer. // Bytes in buffer.
+    bool gameOver; // Last state reported game over. // Letzter Zustand meldete Game Over.
+    bool restartPending; // A PROTOCOL_RESTART still has to be sent (the socket was full). // Ein PROTOCOL_RESTART muss noch gesendet werden (der Socket war voll).
+    bool closed; // Server closed the connection. // Server hat die Verbindung geschlossen.
+};
+
+static double Now() // Seconds on the steady clock. // Sekunden auf der monotonen Uhr.
+{
+    return std::chrono::duration<double>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+static unsigned int randomState = 2463534242u; // Xorshift state for actions and start offsets. // Xorshift-Zustand für Aktionen und Startversätze.
+
+static unsigned int NextRandom() // Xorshift32 step. // Xorshift32-Schritt.
+{
+    randomState ^= randomState << 13;
+    randomState ^= randomState >> 17;
+    randomState ^= randomState << 5;
+    return randomState;
+}
+
+static bool SendInput(Client &client, int action) // Sends one InputMessage and remembers its send time; returns false if it was not sent. // Sendet eine InputMessage und merkt sich ihre Sendezeit; gibt falsch zurück, wenn sie nicht gesendet wurde.
+{
+    InputMessage input = {MessageInput, (uint8_t)action, 0, client.sequence + 1};
+    if (send(client.fd, &input, sizeof(input), MSG_NOSIGNAL | MSG_DONTWAIT) != (ssize_t)sizeof(input)) // 8 bytes either fit or the socket is badly backed up (then the input is skipped). // 8 Bytes passen entweder oder der Socket ist stark gestaut (dann wird die Eingabe übersprungen).
+    {
+        return false;
+    }
+    client.sequence++;
+    client.sendTimes[client.sequence % 256] = Now();
+    return true;
+}
+
+int main(int argc, char **argv) // Entry point: host, port, connections, seconds, inputs per second per connection. // Einstiegspunkt: Host, Port, Verbindungen, Sekunden, Eingaben pro Sekunde pro Verbindung.
+{
+    const char *host = argc > 1 ? argv[1] : "127.0.0.1"; // Server address. // Serveradresse.
+    int port = argc > 2 ? atoi(argv[2]) : PROTOCOL_DEFAULT_PORT; // Server port. // Server-Port.
+    int count = argc > 3 ? atoi(argv[3]) : 1000; // Connections. // Verbindungen.
+    double seconds = argc > 4 ? atof(argv[4]) : 10.0; // Test duration. // Testdauer.
+    double rate = argc > 5 ? atof(argv[5]) : 5.0; // Inputs per second per connection. // Eingaben pro Sekunde pro Verbindung.
+    signal(SIGPIPE, SIG_IGN);
+
+    sockaddr_in address = {}; // Server address. // Serveradresse.
+    address.sin_family = AF_INET;
+    address.sin_port = htons((uint16_t)port);
+    if (inet_pton(AF_INET, host, &address.sin_addr) != 1)
+    {
+        printf("invalid address %s\n", host);
+        return 1;
+    }
+    int loop = epoll_create1(0); // Receive loop. // Empfangsschleife.
+    std::vector<Client> clients(count); // All simulated players. // Alle simulierten Spieler.
+    double start = Now(); // Start of the test. // Beginn des Tests.
+    for (int i = 0; i < count; i++) // Connects every client (blocking connect, then non-blocking I/O). // Verbindet jeden Client (blockierendes Verbinden, dann nicht blockierende Ein-/Ausgabe).
+    {
+        Client &client = clients[i];
+        memset(&client, 0, sizeof(client));
+        client.fd = socket(AF_INET, SOCK_STREAM, 0);
+        if (client.fd < 0 || connect(client.fd, (sockaddr *)&address, sizeof(address)) < 0)
+        {
+            perror("connect (raise the open file limit with ulimit -n for many connections)");
+            return 1;
+        }
+        int enable = 1;
+        setsockopt(client.fd, IPPROTO_TCP, TCP_NODELAY, &enable, sizeof(enable));
+        fcntl(client.fd, F_SETFL, fcntl(client.fd, F_GETFL) | O_NONBLOCK);
+        client.nextSend = start + (NextRandom() % 1000) / 1000.0 / rate; // Spreads the clients over one input interval. // Verteilt die Clients über ein Eingabeintervall.
+        epoll_event event = {};
+        event.events = EPOLLIN;
+        event.data.u32 = (uint32_t)i;
+        epoll_ctl(loop, EPOLL_CTL_ADD, client.fd, &event);
+    }
+    printf("%d connections to %s:%d, %.1f inputs/s each, %.0f s\n", count, host, port, rate, seconds);
+
+    std::vector<double> latencies; // Input-to-confirmation times in milliseconds. // Zeiten von Eingabe bis Bestätigung in Millisekunden.
+    latencies.reserve((size_t)(count * rate * seconds) + 1024);
+    long long states = 0; // StateMessages received. // Empfangene StateMessages.
+    long long finished = 0; // Games that ended. // Beendete Spiele.
+    int bestScore = 0; // Best server-confirmed score. // Beste vom Server bestätigte Punktzahl.
+    epoll_event events[256]; // Events of one epoll_wait call. // Ereignisse eines epoll_wait-Aufrufs.
+    double end = Now() + seconds; // End of the test. // Ende des Tests.
+    while (Now() < end)
+    {
+        int ready = epoll_wait(loop, events, 256, 1); // Wakes at least every millisecond to send inputs. // Wacht mindestens jede Millisekunde auf, um Eingaben zu senden.
+        for (int e = 0; e < ready; e++)
+        {
+            Client &client = clients[events[e].data.u32];
+            unsigned char bytes[8192]; // Raw bytes of one read. // Rohe Bytes eines Lesevorgangs.
+            ssize_t received = read(client.fd, bytes, sizeof(bytes));
+            if (received <= 0)
+            {
+                if (received == 0 || (errno != EAGAIN && errno != EINTR))
+                {
+                    client.closed = true;
+                    epoll_ctl(loop, EPOLL_CTL_DEL, client.fd, nullptr);
+                }
+                continue;
+            }
+            double now = Now(); // Receive time for every message of this read. // Empfangszeit für jede Nachricht dieses Lesevorgangs.
+            for (ssize_t i = 0; i < received; i++) // Reassembles messages of 16 or 32 bytes. // Setzt Nachrichten von 16 oder 32 Bytes zusammen.
+            {
+                client.buffer[client.length++] = bytes[i];
+                int size = client.buffer[0] == MessageWelcome ? (int)sizeof(WelcomeMessage) : (int)sizeof(StateMessage); // Size from the type byte. // Größe aus dem Typ-Byte.
+                if (client.length < size)
+                {
+                    continue;
+                }
+                client.length = 0;
+                if (client.buffer[0] != MessageState)
+                {
+                    continue; // WelcomeMessage: nothing to measure. // WelcomeMessage: nichts zu messen.
+                }
+                StateMessage state; // Confirmed state. // Bestätigter Zustand.
+                memcpy(&state, client.buffer, sizeof(state));
+                states++;
+                for (uint32_t sequence = client.acked + 1; sequence <= state.ackSequence && sequence <= client.sequence; sequence++) // Every newly confirmed input. // Jede neu bestätigte Eingabe.
+                {
+                    if (client.sequence - sequence < 256) // Still in the send-time ring. // Noch im Sendezeit-Ring.
+                    {
+                        latencies.push_back((now - client.sendTimes[sequence % 256]) * 1000.0);
+                    }
+                }
+                if (state.ackSequence > client.acked)
+                {
+                    client.acked = state.ackSequence;
+                }
+                if (state.gameOver && !client.gameOver) // Game ended: records the score and asks for a new game. // Spiel beendet: erfasst die Punktzahl und fordert ein neues Spiel an.
+                {
+                    finished++;
+                    bestScore = state.score > bestScore ? state.score : bestScore;
+                    client.restartPending = true; // Sent by the input loop below, retried until the socket takes it. // Von der Eingabeschleife unten gesendet, wiederholt, bis der Socket sie annimmt.
+                }
+                client.gameOver = state.gameOver != 0;
+            }
+        }
+        double now = Now();
+        for (Client &client : clients) // Sends due inputs. // Sendet fällige Eingaben.
+        {
+            if (!client.closed && client.restartPending && SendInput(client, PROTOCOL_RESTART)) // Without the restart the client would stay silent for the rest of the run. // Ohne den Neustart bliebe der Client für den Rest des Laufs still.
+            {
+                client.restartPending = false;
+            }
+            if (!client.closed && !client.gameOver && now >= client.nextSend)
+            {
+                SendInput(client, 1 + (int)(NextRandom() % 4)); // Left, right, rotate or down. // Links, rechts, rotieren oder runter.
+                client.nextSend += 1.0 / rate;
+            }
+        }
+    }
+
+    int open = 0; // Connections still open at the end. // Am Ende noch offene Verbindungen.
+    for (Client &client : clients)
+    {
+        open += client.closed ? 0 : 1;
+        close(client.fd);
+    }
+    std::sort(latencies.begin(), latencies.end());
+    size_t samples = latencies.size();
+    double p50 = samples ? latencies[samples / 2] : 0.0;
+    double p99 = samples ? latencies[(size_t)(0.99 * (double)(samples - 1))] : 0.0;
+    double worst = samples ? latencies.back() : 0.0;
+    printf("%zu inputs confirmed (%.0f/s), %.0f states/s, %d/%d connections open, %lld games finished (best score %d)\n", samples, samples / seconds, states / seconds, open, count, finished, bestScore);
+    printf("input-to-confirmation latency: p50 %.2f ms, p99 %.2f ms, max %.2f ms\n", p50, p99, worst);
+    return 0;
+}
@@ -0,0 +1,56 @@
+/// Planner Benchmark
+/// 
+/// Command-line tool that plays seeded games with the Monte Carlo planner (planner.h) for increasing thread counts. // Kommandozeilenwerkzeug, das geseedete Spiele mit dem Monte-Carlo-Planer (planner.h) für steigende Thread-Anzahlen spielt.
+/// Reports average score and survived pieces as decision quality, plus rollouts/sec and nodes/sec as throughput. // Meldet durchschnittliche Punktzahl und überlebte Blöcke als Entscheidungsqualität sowie Rollouts/s und Knoten/s als Durchsatz.
+/// 
+/// Usage:
+/// ```cpp
+/// // Build and run (no raylib needed)
+/// g++ -O2 -std=c++14 -Isrc -o planner_bench tools/planner_bench.cpp src/planner.cpp src/engine.cpp src/shapes.cpp src/zobrist.cpp src/workers.cpp -lpthread
+/// ./planner_bench 4 200 0.01 3   // 4 games, up to 200 pieces, 10 ms per move, rollouts 3 pieces deep
+/// ```
+/// 
+/// EN: The same seeds are used for every thread count, so score differences come from the extra rollouts only.
+/// DE: Für jede Thread-Anzahl werden dieselben Seeds verwendet, daher stammen Punktunterschiede nur von den zusätzlichen Rollouts.
+
+#include "planner.h" // Includes the planner under test. // Inkludiert den getesteten Planer.
+#include <cstdio> // Includes printf for the report. // Inkludiert printf für den Bericht.
+#include <cstdlib> // Includes atoi/atof for arguments. // Inkludiert atoi/atof für Argumente.
+
+int main(int argc, char **argv) // Entry point: argv[1] = games, argv[2] = pieces per game, argv[3] = seconds per move, argv[4] = rollout pieces. // Einstiegspunkt: argv[1] = Spiele, argv[2] = Blöcke pro Spiel, argv[3] = Sekunden pro Zug, argv[4] = Rollout-Blöcke.
+{
+    int games = argc > 1 ? atoi(argv[1]) : 4; // Games per thread count. // Spiele pro Thread-Anzahl.
+    int pieces = argc > 2 ? atoi(argv[2]) : 200; // Piece limit per game. // Blocklimit pro Spiel.
+    double budget = argc > 3 ? atof(argv[3]) : 0.01; // Planning time per piece. // Planungszeit pro Block.
+    int depth = argc > 4 ? atoi(argv[4]) : 3; // Rollout length in pieces. // Rollout-Länge in Blöcken.
+
+    printf("%d games, up to %d pieces, %g s per move, rollouts %d pieces deep\n", games, pieces, budget, depth);
+    for (int threads : WorkerPool::GetThreadSweep()) // Sweeps 1, 2, 4, ... threads and all hardware threads. // Durchläuft 1, 2, 4, ... Threads und alle Hardware-Threads.
+    {
+        WorkerPool pool(threads); // Pool for this measurement. // Pool für diese Messung.
+        Planner planner = Planner(pool, depth);
+        long long totalScore = 0; // Sum of final scores. // Summe der Endpunktzahlen.
+        long long placed = 0; // Pieces placed before game over or the limit. // Vor Game Over oder dem Limit platzierte Blöcke.
+        long long rollouts = 0; // Rollouts over all moves. // Rollouts über alle Züge.
+        long long nodes = 0; // Nodes over all moves. // Knoten über alle Züge.
+        double seconds = 0.0; // Planning time over all moves. // Planungszeit über alle Züge.
+        for (int game = 0; game < games; game++)
+        {
+            Engine engine; // Seeded game, identical for every thread count. // Geseedetes Spiel, identisch für jede Thread-Anzahl.
+            engine.Reset(1000 + game);
+            for (int piece = 0; piece < pieces && !engine.gameOver; piece++)
+            {
+                PlannerMove move = planner.Plan(engine, budget); // Picks the placement. // Wählt die Platzierung.
+                PlannerStats stats = planner.GetStats();
+                rollouts += stats.rollouts;
+                nodes += stats.nodes;
+                seconds += stats.seconds;
+                Planner::ApplyMove(engine, move); // Plays it. // Spielt sie.
+                placed++;
+            }
+            totalScore += engine.score;
+        }
+        printf("threads %2d: avg score %8.1f, avg pieces %6.1f, %10.0f rollouts/s, %12.0f nodes/s\n", threads, (double)totalScore / games, (double)placed / games, rollouts / seconds, nodes / seconds);
+    }
+    return 0;
+}
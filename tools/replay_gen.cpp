@@ -0,0 +1,123 @@
+/// Replay Corpus Generator
+///
+/// Command-line tool that plays seeded bot games on all cores and records every lock into columnar replay files (replay.h). // Kommandozeilenwerkzeug, das geseedete Bot-Spiele auf allen Kernen spielt und jede Sperrung in spaltenorientierte Replay-Dateien (replay.h) aufzeichnet.
+/// The bot places each piece greedily with Planner::Evaluate, or at a random reachable placement with the given noise probability. // Der Bot platziert jeden Block gierig mit Planner::Evaluate oder mit der angegebenen Rausch-Wahrscheinlichkeit an einer zufälligen erreichbaren Platzierung.
+///
+/// Usage:
+/// ```cpp
+/// // Build and run (no raylib needed)
+/// g++ -O2 -std=c++14 -Isrc -o replay_gen tools/replay_gen.cpp src/replay.cpp src/planner.cpp src/engine.cpp src/shapes.cpp src/zobrist.cpp src/workers.cpp -lpthread
+/// ./replay_gen corpus 1000000 0.2 500   // corpus-0.tlr, corpus-1.tlr, ... one per thread (appended to on re-runs); 20% random moves, at most 500 pieces per game
+/// ```
+///
+/// EN: Records come from Engine::LockBlock (lastLock, lastRowsCleared) and the score after UpdateScore, the same fields Game records with --record.
+/// DE: Datensätze stammen aus Engine::LockBlock (lastLock, lastRowsCleared) und der Punktzahl nach UpdateScore, dieselben Felder, die Game mit --record aufzeichnet.
+
+#include "replay.h" // Includes the ReplayWriter. // Inkludiert den ReplayWriter.
+#include "planner.h" // Includes ApplyMove and Evaluate for the bot (and MixSeed through engine.h). // Inkludiert ApplyMove und Evaluate für den Bot (und MixSeed über engine.h).
+#include "workers.h" // Includes the worker pool that plays games in parallel. // Inkludiert den Worker-Pool, der Spiele parallel spielt.
+#include <atomic> // Includes the shared game counter. // Inkludiert den geteilten Spielzähler.
+#include <chrono> // Includes steady_clock for timing. // Inkludiert steady_clock für die Zeitmessung.
+#include <cstdio> // Includes printf and snprintf. // Inkludiert printf und snprintf.
+#include <cstdlib> // Includes atoi/atof/atoll for arguments. // Inkludiert atoi/atof/atoll für Argumente.
+#include <vector> // Includes vector for per-thread results. // Inkludiert vector für Ergebnisse pro Thread.
+
+static bool PlayPiece(Engine &engine, unsigned long long &random, double noise) // Chooses and plays one placement; returns false if none is reachable. // Wählt und spielt eine Platzierung; gibt falsch zurück, wenn keine erreichbar ist.
+{
+    Engine results[64]; // Outcome of every tried placement. // Ergebnis jeder probierten Platzierung.
+    int count = 0; // Reachable placements. // Erreichbare Platzierungen.
+    int best = 0; // Index of the greedy choice. // Index der gierigen Wahl.
+    float bestValue = -1e30f;
+    for (int rotations = 0; rotations < blockRotations[engine.currentBlock.id]; rotations++)
+    {
+        for (int column = -3; column < 13; column++) // Same offset range as Planner::FindPlacements. // Gleicher Offset-Bereich wie Planner::FindPlacements.
+        {
+            results[count] = engine;
+            PlannerMove move = {rotations, column};
+            if (!Planner::ApplyMove(results[count], move))
+            {
+                continue;
+            }
+            float value = (float)(results[count].score - engine.score) + Planner::Evaluate(results[count]); // Points now plus board quality. // Punkte jetzt plus Spielfeldqualität.
+            if (value > bestValue)
+            {
+                bestValue = value;
+                best = count;
+            }
+            count++;
+        }
+    }
+    if (count == 0)
+    {
+        return false;
+    }
+    random ^= random << 13; // Xorshift64 step for the noise decision. // Xorshift64-Schritt für die Rausch-Entscheidung.
+    random ^= random >> 7;
+    random ^= random << 17;
+    if ((double)(random >> 11) * (1.0 / 9007199254740992.0) < noise) // Random reachable placement instead of the greedy one. // Zufällige erreichbare Platzierung statt der gierigen.
+    {
+        best = (int)((random >> 32) % (unsigned long long)count);
+    }
+    engine = results[best];
+    return true;
+}
+
+int main(int argc, char **argv) // Entry point: argv[1] = file prefix, argv[2] = games, argv[3] = noise, argv[4] = piece limit, argv[5] = threads. // Einstiegspunkt: argv[1] = Dateipräfix, argv[2] = Spiele, argv[3] = Rauschen, argv[4] = Blocklimit, argv[5] = Threads.
+{
+    const char *prefix = argc > 1 ? argv[1] : "corpus"; // Output files are <prefix>-<thread>.tlr. // Ausgabedateien sind <prefix>-<thread>.tlr.
+    long long games = argc > 2 ? atoll(argv[2]) : 100000; // Total games. // Spiele insgesamt.
+    double noise = argc > 3 ? atof(argv[3]) : 0.2; // Probability of a random placement. // Wahrscheinlichkeit einer zufälligen Platzierung.
+    int pieceLimit = argc > 4 ? atoi(argv[4]) : 500; // Longer games end without a top-out. // Längere Spiele enden ohne Überlauf.
+    int threads = argc > 5 ? atoi(argv[5]) : 0; // 0 = all hardware threads. // 0 = alle Hardware-Threads.
+
+    WorkerPool pool(threads); // One writer per thread, so recording needs no locks. // Ein Writer pro Thread, daher braucht das Aufzeichnen keine Sperren.
+    int threadCount = pool.GetThreadCount();
+    std::atomic<long long> nextGame(0); // Shared game index, also the seed source. // Geteilter Spielindex, auch die Seed-Quelle.
+    std::vector<long long> events((size_t)threadCount * 8, 0); // Per-thread event counts, one cache line apart. // Ereigniszahlen pro Thread, eine Cache-Line voneinander entfernt.
+    std::vector<long long> bytes((size_t)threadCount * 8, 0); // Per-thread bytes appended. // Angehängte Bytes pro Thread.
+    std::vector<int> failures((size_t)threadCount * 16, 0); // Per-thread write failures. // Schreibfehler pro Thread.
+    auto start = std::chrono::steady_clock::now();
+    pool.RunOnAll([&](int thread) {
+        char path[512];
+        snprintf(path, sizeof(path), "%s-%d.tlr", prefix, thread);
+        ReplayWriter writer(path, 1 << 20); // About 7 MB of event columns per block. // Etwa 7 MB Ereignisspalten pro Block.
+        unsigned long long random = MixSeed(0xC0FFEEULL + (unsigned long long)thread) | 1; // Noise generator of this thread. // Rauschgenerator dieses Threads.
+        for (long long game = nextGame.fetch_add(1, std::memory_order_relaxed); game < games; game = nextGame.fetch_add(1, std::memory_order_relaxed))
+        {
+            unsigned long long seed = MixSeed((unsigned long long)game);
+            Engine engine;
+            engine.Reset(seed);
+            writer.BeginGame(seed);
+            for (int piece = 0; piece < pieceLimit && !engine.gameOver; piece++)
+            {
+                if (!PlayPiece(engine, random, noise)) // Cannot happen at spawn, but ends the game cleanly. // Kann beim Erscheinen nicht passieren, beendet das Spiel aber sauber.
+                {
+                    break;
+                }
+                writer.RecordLock(engine.lastLock.id, engine.lastLock.rotation, engine.lastLock.row, engine.lastLock.column, engine.lastRowsCleared, engine.score);
+            }
+            writer.EndGame(engine.score, engine.gameOver ? engine.currentBlock.id : 0); // The block that failed to spawn is the top-out piece. // Der Block, der nicht erscheinen konnte, ist der Überlauf-Block.
+        }
+        events[(size_t)thread * 8] = writer.GetEventCount();
+        failures[(size_t)thread * 16] = writer.Close() ? 0 : 1;
+        bytes[(size_t)thread * 8] = writer.GetBytesWritten();
+    });
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    long long totalEvents = 0, totalBytes = 0;
+    int totalFailures = 0;
+    for (int thread = 0; thread < threadCount; thread++)
+    {
+        totalEvents += events[(size_t)thread * 8];
+        totalBytes += bytes[(size_t)thread * 8];
+        totalFailures += failures[(size_t)thread * 16];
+    }
+    printf("%lld games, %lld locks in %d files (%s-*.tlr), %.1f MB\n", games, totalEvents, threadCount, prefix, totalBytes / 1e6);
+    printf("%.2f s, %.0f games/s, %.0f locks/s, %.1f bytes per lock\n", seconds, games / seconds, totalEvents / seconds, totalEvents > 0 ? (double)totalBytes / totalEvents : 0.0);
+    if (totalFailures > 0)
+    {
+        printf("write failed for %d files\n", totalFailures);
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,386 @@
+/// Replay Corpus Scanner
+///
+/// Linux command-line tool that memory-maps replay files (replay.h) and aggregates them with parallel passes that each read only the columns they need. // Linux-Kommandozeilenwerkzeug, das Replay-Dateien (replay.h) in den Speicher abbildet und sie mit parallelen Durchgängen aggregiert, die jeweils nur die benötigten Spalten lesen.
+/// Reports score distribution, lines by type, the placement heatmap over the 20x10 board and top-out causes, plus the scan rate of every pass. // Meldet Punkteverteilung, Linien nach Typ, die Platzierungs-Heatmap über das 20x10-Spielfeld und Überlauf-Ursachen sowie die Scan-Rate jedes Durchgangs.
+///
+/// Usage:
+/// ```cpp
+/// // Build and run (Linux, no raylib needed); -O3 lets GCC vectorize the column loops
+/// g++ -O3 -march=native -std=c++14 -Isrc -o replay_scan tools/replay_scan.cpp src/replay.cpp src/shapes.cpp src/workers.cpp -lpthread
+/// ./replay_scan corpus-*.tlr
+/// ./replay_scan --threads 4 --repeat 3 corpus-*.tlr   // Later repeats show the rate with the files in the page cache
+/// ```
+///
+/// EN: Work is split into block slices of up to 256K events; every thread sums into its own totals, which are merged once at the end of a pass.
+/// DE: Die Arbeit wird in Blockabschnitte von bis zu 256K Ereignissen geteilt; jeder Thread summiert in eigene Summen, die am Ende eines Durchgangs einmal zusammengeführt werden.
+
+#include "replay.h" // Includes the on-disk format. // Inkludiert das Dateiformat.
+#include "shapes.h" // Includes the block shapes for the placement heatmap. // Inkludiert die Blockformen für die Platzierungs-Heatmap.
+#include "workers.h" // Includes the worker pool for the parallel passes. // Inkludiert den Worker-Pool für die parallelen Durchgänge.
+#include <atomic> // Includes the shared task counter. // Inkludiert den geteilten Aufgabenzähler.
+#include <chrono> // Includes steady_clock for pass timing. // Inkludiert steady_clock für die Zeitmessung der Durchgänge.
+#include <cstdio> // Includes printf for the report. // Inkludiert printf für den Bericht.
+#include <cstdlib> // Includes atoi for arguments. // Inkludiert atoi für Argumente.
+#include <cstring> // Includes memcmp/memset/strcmp. // Inkludiert memcmp/memset/strcmp.
+#include <fcntl.h> // Includes open. // Inkludiert open.
+#include <sys/mman.h> // Includes mmap/madvise. // Inkludiert mmap/madvise.
+#include <sys/stat.h> // Includes fstat for the file size. // Inkludiert fstat für die Dateigröße.
+#include <unistd.h> // Includes close. // Inkludiert close.
+#include <vector> // Includes vector for blocks, tasks and totals. // Inkludiert vector für Blöcke, Aufgaben und Summen.
+
+static const int scoreBuckets = 32; // Score histogram buckets; the last one is open-ended. // Eimer des Punkte-Histogramms; der letzte ist nach oben offen.
+static const int scoreBucketWidth = 1000; // Points per bucket. // Punkte pro Eimer.
+static const unsigned int sliceEvents = 1u << 18; // Events per task. // Ereignisse pro Aufgabe.
+
+struct BlockView // One validated block inside a mapped file. // Ein geprüfter Block in einer abgebildeten Datei.
+{
+    const unsigned char *base; // Block start. // Blockbeginn.
+    unsigned int games; // Games in the block. // Spiele im Block.
+    unsigned int events; // Events in the block. // Ereignisse im Block.
+    const void *Column(int column) const // Start of a column. // Beginn einer Spalte.
+    {
+        return base + ((const ReplayBlockHeader *)base)->columnOffsets[column]; // Offset from the block header. // Offset aus dem Blockkopf.
+    }
+};
+
+struct Task // A slice of one block. // Ein Abschnitt eines Blocks.
+{
+    int block; // Index into the block list. // Index in die Blockliste.
+    unsigned int begin; // First event of the slice. // Erstes Ereignis des Abschnitts.
+    unsigned int end; // One past the last event. // Eins nach dem letzten Ereignis.
+};
+
+struct ScanTotals // Aggregates of one thread (merged after the pass). // Aggregate eines Threads (nach dem Durchgang zusammengeführt).
+{
+    long long games; // Games seen. // Gesehene Spiele.
+    long long scoreSum; // Sum of final scores. // Summe der Endpunktzahlen.
+    long long scoreHistogram[scoreBuckets]; // Games per score bucket. // Spiele pro Punkte-Eimer.
+    long long topOutPiece[8]; // Topped-out games per block id that failed to spawn (0 = did not top out). // Übergelaufene Spiele pro Block-ID, die nicht erscheinen konnte (0 = nicht übergelaufen).
+    long long topOutColumns[10]; // Cells of the final lock of topped-out games per column. // Zellen der letzten Sperrung übergelaufener Spiele pro Spalte.
+    long long events; // Lock events seen. // Gesehene Sperr-Ereignisse.
+    long long linesByType[5]; // Locks clearing 0, 1, 2, 3 and 4 rows. // Sperrungen, die 0, 1, 2, 3 und 4 Reihen räumen.
+    long long scoreDeltaSum; // Sum of per-lock score deltas (equals scoreSum for an intact corpus). // Summe der Punktdifferenzen pro Sperrung (gleich scoreSum für einen intakten Korpus).
+    long long pieces[8]; // Locks per block id. // Sperrungen pro Block-ID.
+    long long heat[200]; // Locked cells per board cell (row * 10 + column). // Gesperrte Zellen pro Spielfeldzelle (Reihe * 10 + Spalte).
+    long long invalid; // Cells of placements that fall outside the board (corrupt data). // Zellen von Platzierungen, die außerhalb des Spielfelds liegen (beschädigte Daten).
+    long long padding[8]; // One cache line between neighbouring threads (alignas would need C++17 aligned new for the vector). // Eine Cache-Line zwischen benachbarten Threads (alignas bräuchte C++17-ausgerichtetes new für den vector).
+};
+
+static const unsigned int placementKeys = 1u << 15; // 3 bits piece, 2 bits rotation, 5 bits each for the row and column offsets. // 3 Bit Block, 2 Bit Rotation, je 5 Bit für Reihen- und Spalten-Offset.
+static const int placementBias = 8; // Offsets are stored plus 8, so -8..23 fit into 5 bits (rows reach 19, columns -3 to 12). // Offsets werden plus 8 gespeichert, damit -8..23 in 5 Bit passen (Reihen reichen bis 19, Spalten von -3 bis 12).
+
+static bool MapFile(const char *path, std::vector<BlockView> &blocks, size_t &mappedBytes) // Maps a file and appends its valid blocks. // Bildet eine Datei ab und hängt ihre gültigen Blöcke an.
+{
+    int fd = open(path, O_RDONLY); // Read-only descriptor for mmap. // Nur-Lese-Deskriptor für mmap.
+    if (fd < 0) // Missing or unreadable file. // Fehlende oder unlesbare Datei.
+    {
+        perror(path); // Prints the system error. // Gibt den Systemfehler aus.
+        return false; // Skips this file. // Überspringt diese Datei.
+    }
+    struct stat info; // File size and type. // Dateigröße und -typ.
+    if (fstat(fd, &info) != 0 || info.st_size < (off_t)sizeof(ReplayFileHeader)) // Too small for a file header. // Zu klein für einen Dateikopf.
+    {
+        fprintf(stderr, "%s: not a replay file\n", path); // Reports the bad file. // Meldet die fehlerhafte Datei.
+        close(fd); // Releases the descriptor. // Gibt den Deskriptor frei.
+        return false; // Skips this file. // Überspringt diese Datei.
+    }
+    size_t size = (size_t)info.st_size; // Bytes to map. // Abzubildende Bytes.
+    void *map = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0); // Read-only view; pages are loaded on first touch. // Nur-Lese-Ansicht; Seiten werden bei der ersten Berührung geladen.
+    close(fd); // The mapping keeps the file alive. // Die Abbildung hält die Datei am Leben.
+    if (map == MAP_FAILED) // Address space or file type did not allow mapping. // Adressraum oder Dateityp erlaubten keine Abbildung.
+    {
+        perror(path); // Prints the system error. // Gibt den Systemfehler aus.
+        return false; // Skips this file. // Überspringt diese Datei.
+    }
+    madvise(map, size, MADV_WILLNEED); // Starts read-ahead for the whole file. // Startet das Vorauslesen für die ganze Datei.
+    const unsigned char *bytes = (const unsigned char *)map; // Byte view of the mapping. // Byte-Ansicht der Abbildung.
+    const ReplayFileHeader *header = (const ReplayFileHeader *)bytes; // File header at offset 0. // Dateikopf an Offset 0.
+    if (memcmp(header->magic, "TLREPLAY", 8) != 0 || header->version != REPLAY_VERSION) // Wrong magic or version. // Falsche Kennung oder Version.
+    {
+        fprintf(stderr, "%s: not a replay file (or another version)\n", path); // Reports the foreign file. // Meldet die fremde Datei.
+        munmap(map, size); // Releases the mapping. // Gibt die Abbildung frei.
+        return false; // Skips this file. // Überspringt diese Datei.
+    }
+    size_t position = sizeof(ReplayFileHeader); // Walks the block chain. // Folgt der Blockkette.
+    while (position + sizeof(ReplayBlockHeader) <= size) // Stops when no full block header is left. // Hält an, wenn kein vollständiger Blockkopf mehr übrig ist.
+    {
+        const ReplayBlockHeader *block = (const ReplayBlockHeader *)(bytes + position); // Header of the block at position. // Kopf des Blocks an position.
+        bool valid = memcmp(block->magic, "TLBLOCK1", 8) == 0 && block->blockBytes >= sizeof(ReplayBlockHeader) && block->blockBytes <= size - position; // Magic and size must fit the rest of the file. // Kennung und Größe müssen zum Rest der Datei passen.
+        for (int column = 0; column < ReplayColumnCount && valid; column++) // Every column must lie inside the block. // Jede Spalte muss innerhalb des Blocks liegen.
+        {
+            unsigned long long count = column < ReplayGameSeed ? block->eventCount : block->gameCount; // Event columns hold eventCount elements, game columns gameCount. // Ereignisspalten haben eventCount Elemente, Spielspalten gameCount.
+            valid = block->columnOffsets[column] % REPLAY_ALIGNMENT == 0 && block->columnOffsets[column] + count * replayColumnBytes[column] <= block->blockBytes; // Aligned start and end inside the block. // Ausgerichteter Beginn und Ende innerhalb des Blocks.
+        }
+        if (!valid) // A crash while appending leaves a truncated last block; everything before it is intact. // Ein Absturz beim Anhängen hinterlässt einen abgeschnittenen letzten Block; alles davor ist intakt.
+        {
+            fprintf(stderr, "%s: stopping at damaged block at byte %zu\n", path, position); // Reports where the intact part ends. // Meldet, wo der intakte Teil endet.
+            break; // Keeps the blocks before it. // Behält die Blöcke davor.
+        }
+        BlockView view = {bytes + position, block->gameCount, block->eventCount}; // Start, games and events of the block. // Beginn, Spiele und Ereignisse des Blocks.
+        blocks.push_back(view); // Adds it to the corpus. // Fügt ihn dem Korpus hinzu.
+        position += (size_t)block->blockBytes; // Next block header. // Nächster Blockkopf.
+    }
+    mappedBytes += size; // Counts the mapped bytes for the report. // Zählt die abgebildeten Bytes für den Bericht.
+    return true; // The mapping stays until the process exits. // Die Abbildung bleibt bis zum Prozessende bestehen.
+}
+
+static void ScanGames(const BlockView &block, ScanTotals &totals) // Pass 1: game columns, plus the last lock of topped-out games. // Durchgang 1: Spielspalten plus die letzte Sperrung übergelaufener Spiele.
+{
+    const int *scores = (const int *)block.Column(ReplayGameScore); // Final score per game. // Endpunktzahl pro Spiel.
+    const unsigned int *counts = (const unsigned int *)block.Column(ReplayGameEvents); // Locks per game. // Sperrungen pro Spiel.
+    const unsigned char *topOuts = (const unsigned char *)block.Column(ReplayGameTopOut); // Piece that could not spawn per game. // Stück, das pro Spiel nicht erscheinen konnte.
+    const unsigned char *pieces = (const unsigned char *)block.Column(ReplayEventPiece); // Needed for the final lock only. // Nur für die letzte Sperrung benötigt.
+    const unsigned char *rotations = (const unsigned char *)block.Column(ReplayEventRotation); // Needed for the final lock only. // Nur für die letzte Sperrung benötigt.
+    const signed char *columns = (const signed char *)block.Column(ReplayEventColumn); // Needed for the final lock only. // Nur für die letzte Sperrung benötigt.
+    unsigned long long firstEvent = 0; // Events of game g start after those of games 0..g-1. // Ereignisse von Spiel g beginnen nach denen der Spiele 0..g-1.
+    for (unsigned int game = 0; game < block.games; game++) // Every game of the block. // Jedes Spiel des Blocks.
+    {
+        int score = scores[game]; // Final score of the game. // Endpunktzahl des Spiels.
+        totals.scoreSum += score; // Sum for the average. // Summe für den Durchschnitt.
+        int bucket = score / scoreBucketWidth; // Histogram bucket of the score. // Histogramm-Eimer der Punktzahl.
+        totals.scoreHistogram[bucket < 0 ? 0 : (bucket >= scoreBuckets ? scoreBuckets - 1 : bucket)]++; // Clamped to the first and the open last bucket. // Auf den ersten und den offenen letzten Eimer begrenzt.
+        unsigned char topOut = topOuts[game] & 7; // Masked so corrupt data stays inside the array. // Maskiert, damit beschädigte Daten im Array bleiben.
+        totals.topOutPiece[topOut]++; // Counts the cause (0 = piece limit). // Zählt die Ursache (0 = Stücklimit).
+        unsigned long long lastEvent = firstEvent + counts[game] - 1; // The lock that blocked the spawn. // Die Sperrung, die das Erscheinen blockierte.
+        firstEvent += counts[game]; // First event of the next game. // Erstes Ereignis des nächsten Spiels.
+        if (topOut != 0 && counts[game] > 0 && firstEvent <= block.events) // Topped out, has locks and its events lie inside the block. // Übergelaufen, hat Sperrungen und seine Ereignisse liegen im Block.
+        {
+            unsigned char piece = pieces[lastEvent] & 7; // Piece of the final lock. // Stück der letzten Sperrung.
+            unsigned char rotation = rotations[lastEvent] & 3; // Rotation of the final lock. // Rotation der letzten Sperrung.
+            for (int cell = 0; cell < 4; cell++) // Four cells per piece. // Vier Zellen pro Stück.
+            {
+                int column = blockShapes[piece][rotation][cell].column + columns[lastEvent]; // Board column of this cell. // Spielfeldspalte dieser Zelle.
+                if (column >= 0 && column < 10) // Ignores cells off the board. // Ignoriert Zellen außerhalb des Spielfelds.
+                {
+                    totals.topOutColumns[column]++; // Counts the column. // Zählt die Spalte.
+                }
+            }
+        }
+    }
+    totals.games += block.games; // Counts the games of this block. // Zählt die Spiele dieses Blocks.
+}
+
+static void ScanLines(const BlockView &block, unsigned int begin, unsigned int end, ScanTotals &totals) // Pass 2: rows cleared and score deltas (two narrow columns). // Durchgang 2: geräumte Reihen und Punktdifferenzen (zwei schmale Spalten).
+{
+    const unsigned char *cleared = (const unsigned char *)block.Column(ReplayEventRowsCleared); // One byte per event. // Ein Byte pro Ereignis.
+    const unsigned short *deltas = (const unsigned short *)block.Column(ReplayEventScoreDelta); // Two bytes per event. // Zwei Bytes pro Ereignis.
+    unsigned int ones = 0, twos = 0, threes = 0, fours = 0; // Branch-free compare-and-add counters (a slice has at most 256K events). // Verzweigungsfreie Vergleichs-und-Addier-Zähler (ein Abschnitt hat höchstens 256K Ereignisse).
+    for (unsigned int i = begin; i < end; i++) // One pass over the rows-cleared column. // Ein Durchgang über die Spalte geräumter Reihen.
+    {
+        unsigned char rows = cleared[i]; // Rows cleared by this lock. // Durch diese Sperrung geräumte Reihen.
+        ones += rows == 1; // Single. // Single.
+        twos += rows == 2; // Double. // Double.
+        threes += rows == 3; // Triple. // Triple.
+        fours += rows == 4; // Tetris. // Tetris.
+    }
+    unsigned long long deltaSum = 0; // Fits any slice: 256K events of at most 65535 points. // Passt für jeden Abschnitt: 256K Ereignisse zu höchstens 65535 Punkten.
+    for (unsigned int i = begin; i < end; i++) // One pass over the score-delta column. // Ein Durchgang über die Punktdifferenz-Spalte.
+    {
+        deltaSum += deltas[i]; // Adds the points of this lock. // Addiert die Punkte dieser Sperrung.
+    }
+    unsigned int count = end - begin; // Events in this slice. // Ereignisse in diesem Abschnitt.
+    totals.linesByType[0] += count - ones - twos - threes - fours; // Locks without a clear. // Sperrungen ohne Räumung.
+    totals.linesByType[1] += ones; // Adds the singles. // Addiert die Singles.
+    totals.linesByType[2] += twos; // Adds the doubles. // Addiert die Doubles.
+    totals.linesByType[3] += threes; // Adds the triples. // Addiert die Triples.
+    totals.linesByType[4] += fours; // Adds the tetrises. // Addiert die Tetrisse.
+    totals.scoreDeltaSum += (long long)deltaSum; // Adds the points. // Addiert die Punkte.
+    totals.events += count; // Counts the events. // Zählt die Ereignisse.
+}
+
+static void ScanHeat(const BlockView &block, unsigned int begin, unsigned int end, unsigned int *placements) // Pass 3: counts placements by (piece, rotation, row, column) key; ExpandPlacements turns them into cells. // Durchgang 3: zählt Platzierungen nach Schlüssel (Block, Rotation, Reihe, Spalte); ExpandPlacements macht daraus Zellen.
+{
+    const unsigned char *pieces = (const unsigned char *)block.Column(ReplayEventPiece); // Block id per event. // Block-ID pro Ereignis.
+    const unsigned char *rotations = (const unsigned char *)block.Column(ReplayEventRotation); // Rotation per event. // Rotation pro Ereignis.
+    const signed char *rows = (const signed char *)block.Column(ReplayEventRow); // Row offset per event. // Reihen-Offset pro Ereignis.
+    const signed char *columns = (const signed char *)block.Column(ReplayEventColumn); // Column offset per event. // Spalten-Offset pro Ereignis.
+    for (unsigned int i = begin; i < end; i++) // One increment per event instead of four cell lookups. // Ein Inkrement pro Ereignis statt vier Zellnachschlägen.
+    {
+        unsigned int key = (unsigned int)(pieces[i] & 7) << 12 | (unsigned int)(rotations[i] & 3) << 10 | (unsigned int)((rows[i] + placementBias) & 31) << 5 | (unsigned int)((columns[i] + placementBias) & 31); // Packs piece, rotation and both offsets into 15 bits. // Packt Stück, Rotation und beide Offsets in 15 Bit.
+        placements[key]++; // Counts the placement. // Zählt die Platzierung.
+    }
+}
+
+static void ExpandPlacements(unsigned int *placements, ScanTotals &totals) // Adds the four cells of every counted placement to the heatmap and clears the counts. // Addiert die vier Zellen jeder gezählten Platzierung zur Heatmap und löscht die Zähler.
+{
+    for (unsigned int key = 0; key < placementKeys; key++) // Every possible key. // Jeder mögliche Schlüssel.
+    {
+        unsigned int count = placements[key]; // Placements with this key. // Platzierungen mit diesem Schlüssel.
+        if (count == 0) // Most keys never occur. // Die meisten Schlüssel kommen nie vor.
+        {
+            continue; // Next key. // Nächster Schlüssel.
+        }
+        placements[key] = 0; // Ready for the next scan. // Bereit für den nächsten Scan.
+        int piece = key >> 12; // Block id of the placement. // Block-ID der Platzierung.
+        int rotation = (key >> 10) & 3; // Rotation of the placement. // Rotation der Platzierung.
+        int row = (int)((key >> 5) & 31) - placementBias; // Row offset of the placement. // Reihen-Offset der Platzierung.
+        int column = (int)(key & 31) - placementBias; // Column offset of the placement. // Spalten-Offset der Platzierung.
+        totals.pieces[piece] += count; // Locks per block id. // Sperrungen pro Block-ID.
+        for (int cell = 0; cell < 4; cell++) // Four cells per piece. // Vier Zellen pro Stück.
+        {
+            int cellRow = blockShapes[piece][rotation][cell].row + row; // Board row of this cell. // Spielfeldreihe dieser Zelle.
+            int cellColumn = blockShapes[piece][rotation][cell].column + column; // Board column of this cell. // Spielfeldspalte dieser Zelle.
+            if (cellRow >= 0 && cellRow < 20 && cellColumn >= 0 && cellColumn < 10) // Cell lies on the board. // Zelle liegt auf dem Spielfeld.
+            {
+                totals.heat[cellRow * 10 + cellColumn] += count; // Heats the cell. // Erwärmt die Zelle.
+            }
+            else // Cell lies off the board. // Zelle liegt außerhalb des Spielfelds.
+            {
+                totals.invalid += count; // Counted as corrupt. // Als beschädigt gezählt.
+            }
+        }
+    }
+}
+
+template <typename Body> // Lets each pass inline its own body. // Lässt jeden Durchgang seinen eigenen Rumpf einbetten.
+static double RunPass(WorkerPool &pool, const std::vector<Task> &tasks, const Body &body) // Runs body(task, thread) over all tasks; returns seconds. // Führt body(task, thread) über alle Aufgaben aus; gibt Sekunden zurück.
+{
+    std::atomic<size_t> next(0); // Shared task index (slices differ in cost, so threads take them one by one). // Geteilter Aufgabenindex (Abschnitte kosten unterschiedlich viel, daher nehmen Threads sie einzeln).
+    auto start = std::chrono::steady_clock::now(); // Starts the pass timer. // Startet den Durchgangs-Timer.
+    pool.RunOnAll([&](int thread) { // Every thread takes tasks until none are left. // Jeder Thread nimmt Aufgaben, bis keine übrig sind.
+        for (size_t task = next.fetch_add(1, std::memory_order_relaxed); task < tasks.size(); task = next.fetch_add(1, std::memory_order_relaxed)) // Claims the next task. // Beansprucht die nächste Aufgabe.
+        {
+            body(tasks[task], thread); // Scans the task into this thread's totals. // Scannt die Aufgabe in die Summen dieses Threads.
+        }
+    });
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count(); // Seconds since the start. // Sekunden seit dem Start.
+}
+
+static void Report(const char *name, double seconds, double bytes) // Prints one pass line. // Gibt eine Durchgangszeile aus.
+{
+    printf("  %-8s %8.2f ms  %9.1f MB  %6.2f GB/s\n", name, seconds * 1000.0, bytes / 1e6, seconds > 0 ? bytes / seconds / 1e9 : 0.0); // Name, time, bytes read and rate. // Name, Zeit, gelesene Bytes und Rate.
+}
+
+int main(int argc, char **argv) // Entry point: [--threads N] [--repeat N] files... // Einstiegspunkt: [--threads N] [--repeat N] Dateien...
+{
+    int threads = 0; // 0 = all hardware threads. // 0 = alle Hardware-Threads.
+    int repeat = 1; // Scans of the whole corpus. // Scans des ganzen Korpus.
+    std::vector<BlockView> blocks; // All blocks of all files. // Alle Blöcke aller Dateien.
+    size_t mappedBytes = 0; // Bytes of all mappings. // Bytes aller Abbildungen.
+    int files = 0; // Files with at least a valid header. // Dateien mit mindestens einem gültigen Kopf.
+    for (int i = 1; i < argc; i++) // Options and file names. // Optionen und Dateinamen.
+    {
+        if (strcmp(argv[i], "--threads") == 0 && i + 1 < argc) // Thread count option. // Option für die Thread-Anzahl.
+        {
+            threads = atoi(argv[++i]); // Reads the count and skips it. // Liest die Anzahl und überspringt sie.
+        }
+        else if (strcmp(argv[i], "--repeat") == 0 && i + 1 < argc) // Repeat option. // Option für Wiederholungen.
+        {
+            repeat = atoi(argv[++i]); // Reads the count and skips it. // Liest die Anzahl und überspringt sie.
+        }
+        else if (MapFile(argv[i], blocks, mappedBytes)) // Anything else is a file. // Alles andere ist eine Datei.
+        {
+            files++; // Counts the mapped file. // Zählt die abgebildete Datei.
+        }
+    }
+    if (blocks.empty()) // No data to scan. // Keine Daten zu scannen.
+    {
+        fprintf(stderr, "usage: replay_scan [--threads N] [--repeat N] file.tlr...\n"); // Prints the usage. // Gibt die Verwendung aus.
+        return 1; // Error exit. // Fehler-Exit.
+    }
+    std::vector<Task> gameTasks; // One task per block. // Eine Aufgabe pro Block.
+    std::vector<Task> eventTasks; // Slices of at most sliceEvents. // Abschnitte von höchstens sliceEvents.
+    double gameBytes = 0, lineBytes = 0, heatBytes = 0; // Column bytes each pass reads. // Spaltenbytes, die jeder Durchgang liest.
+    for (int b = 0; b < (int)blocks.size(); b++) // Splits every block into tasks. // Teilt jeden Block in Aufgaben.
+    {
+        Task task = {b, 0, blocks[b].games}; // All games of the block. // Alle Spiele des Blocks.
+        gameTasks.push_back(task); // Queues the game task. // Reiht die Spielaufgabe ein.
+        for (unsigned int begin = 0; begin < blocks[b].events; begin += sliceEvents) // Event slices of the block. // Ereignisabschnitte des Blocks.
+        {
+            Task slice = {b, begin, blocks[b].events - begin < sliceEvents ? blocks[b].events : begin + sliceEvents}; // The last slice ends at the block's last event. // Der letzte Abschnitt endet am letzten Ereignis des Blocks.
+            eventTasks.push_back(slice); // Queues the slice. // Reiht den Abschnitt ein.
+        }
+        gameBytes += blocks[b].games * 9.0; // Score, event count and top-out columns. // Spalten Punktzahl, Ereigniszahl und Überlauf.
+        lineBytes += blocks[b].events * 3.0; // Rows-cleared and score-delta columns. // Spalten geräumte Reihen und Punktdifferenz.
+        heatBytes += blocks[b].events * 4.0; // Piece, rotation, row and column columns. // Spalten Block, Rotation, Reihe und Spalte.
+    }
+
+    WorkerPool pool(threads); // Starts the scan threads. // Startet die Scan-Threads.
+    int threadCount = pool.GetThreadCount(); // Threads actually started. // Tatsächlich gestartete Threads.
+    std::vector<ScanTotals> totals(threadCount); // Per-thread aggregates. // Aggregate pro Thread.
+    std::vector<unsigned int> placements((size_t)threadCount * placementKeys, 0); // Per-thread placement counts of the heatmap pass. // Platzierungszähler pro Thread für den Heatmap-Durchgang.
+    ScanTotals sum; // Merged aggregates of the last scan. // Zusammengeführte Aggregate des letzten Scans.
+    printf("%d files, %zu blocks, %.1f MB mapped, %d threads\n", files, blocks.size(), mappedBytes / 1e6, threadCount); // Prints the corpus summary. // Gibt die Korpus-Zusammenfassung aus.
+    for (int run = 0; run < repeat; run++) // Scans the whole corpus repeat times. // Scannt das ganze Korpus repeat-mal.
+    {
+        memset(&totals[0], 0, sizeof(ScanTotals) * totals.size()); // Clears the totals of the previous scan. // Löscht die Summen des vorherigen Scans.
+        printf("scan %d:\n", run + 1); // Header of this scan. // Kopf dieses Scans.
+        double games = RunPass(pool, gameTasks, [&](const Task &task, int thread) { ScanGames(blocks[task.block], totals[thread]); }); // Pass 1 over the game columns. // Durchgang 1 über die Spielspalten.
+        double lines = RunPass(pool, eventTasks, [&](const Task &task, int thread) { ScanLines(blocks[task.block], task.begin, task.end, totals[thread]); }); // Pass 2 over the line columns. // Durchgang 2 über die Linienspalten.
+        double heat = RunPass(pool, eventTasks, [&](const Task &task, int thread) { ScanHeat(blocks[task.block], task.begin, task.end, &placements[(size_t)thread * placementKeys]); }); // Pass 3 over the placement columns. // Durchgang 3 über die Platzierungsspalten.
+        for (int thread = 0; thread < threadCount; thread++) // Placement counts to cells (32K keys per thread, independent of corpus size). // Platzierungszähler zu Zellen (32K Schlüssel pro Thread, unabhängig von der Korpusgröße).
+        {
+            ExpandPlacements(&placements[(size_t)thread * placementKeys], totals[thread]); // Adds the cells to this thread's heatmap. // Addiert die Zellen zur Heatmap dieses Threads.
+        }
+        Report("games", games, gameBytes); // Rate of pass 1. // Rate von Durchgang 1.
+        Report("lines", lines, lineBytes); // Rate of pass 2. // Rate von Durchgang 2.
+        Report("heatmap", heat, heatBytes); // Rate of pass 3. // Rate von Durchgang 3.
+        Report("total", games + lines + heat, gameBytes + lineBytes + heatBytes); // Rate of the whole scan. // Rate des ganzen Scans.
+        memset(&sum, 0, sizeof(sum)); // Clears the merged totals. // Löscht die zusammengeführten Summen.
+        for (int thread = 0; thread < threadCount; thread++) // Merges the per-thread totals field by field. // Führt die Summen pro Thread Feld für Feld zusammen.
+        {
+            const long long *from = (const long long *)&totals[thread]; // Fields of this thread. // Felder dieses Threads.
+            long long *to = (long long *)&sum; // Fields of the merged totals. // Felder der zusammengeführten Summen.
+            for (size_t field = 0; field < sizeof(ScanTotals) / sizeof(long long); field++) // ScanTotals holds only long longs. // ScanTotals enthält nur long longs.
+            {
+                to[field] += from[field]; // Adds one field. // Addiert ein Feld.
+            }
+        }
+    }
+
+    printf("\n%lld games, %lld locks, average score %.1f, average locks %.1f\n", sum.games, sum.events, sum.games > 0 ? (double)sum.scoreSum / sum.games : 0.0, sum.games > 0 ? (double)sum.events / sum.games : 0.0); // Corpus totals and averages. // Korpus-Summen und Durchschnitte.
+    if (sum.scoreDeltaSum != sum.scoreSum || sum.invalid != 0) // Cross-checks the event columns against the game columns. // Prüft die Ereignisspalten gegen die Spielspalten.
+    {
+        printf("warning: score deltas sum to %lld (games: %lld), %lld cells off the board\n", sum.scoreDeltaSum, sum.scoreSum, sum.invalid); // Reports the mismatch. // Meldet die Abweichung.
+    }
+    printf("\nscore distribution (%d points per bucket):\n", scoreBucketWidth); // Histogram title. // Histogramm-Titel.
+    for (int bucket = 0; bucket < scoreBuckets; bucket++) // Every bucket. // Jeder Eimer.
+    {
+        if (sum.scoreHistogram[bucket] > 0) // Skips empty buckets. // Überspringt leere Eimer.
+        {
+            printf("  %6d%s %10lld  %5.1f%%\n", bucket * scoreBucketWidth, bucket == scoreBuckets - 1 ? "+" : " ", sum.scoreHistogram[bucket], 100.0 * sum.scoreHistogram[bucket] / sum.games); // Bucket start, count and share of games. // Eimerbeginn, Anzahl und Anteil der Spiele.
+        }
+    }
+    long long clears = sum.linesByType[1] + sum.linesByType[2] + sum.linesByType[3] + sum.linesByType[4]; // Locks that cleared at least one row. // Sperrungen, die mindestens eine Reihe räumten.
+    printf("\nlines by type (%.1f%% of locks clear rows):\n", sum.events > 0 ? 100.0 * clears / sum.events : 0.0); // Share of locks that clear rows. // Anteil der Sperrungen, die Reihen räumen.
+    const char *names[5] = {"none", "single", "double", "triple", "tetris"}; // Labels by rows cleared. // Bezeichnungen nach geräumten Reihen.
+    for (int type = 1; type <= 4; type++) // Single to tetris. // Single bis Tetris.
+    {
+        printf("  %-7s %12lld  %5.1f%%\n", names[type], sum.linesByType[type], clears > 0 ? 100.0 * sum.linesByType[type] / clears : 0.0); // Count and share of all clears. // Anzahl und Anteil aller Räumungen.
+    }
+    long long maxHeat = 1; // At least 1, so an empty corpus does not divide by zero. // Mindestens 1, damit ein leeres Korpus nicht durch null teilt.
+    for (int cell = 0; cell < 200; cell++) // Finds the busiest cell. // Findet die meistbelegte Zelle.
+    {
+        maxHeat = sum.heat[cell] > maxHeat ? sum.heat[cell] : maxHeat; // Keeps the maximum. // Behält das Maximum.
+    }
+    printf("\nplacement heatmap (locked cells, 0-99 relative to the busiest cell):\n"); // Heatmap title. // Heatmap-Titel.
+    for (int row = 0; row < 20; row++) // One line per board row. // Eine Zeile pro Spielfeldreihe.
+    {
+        printf("  %2d |", row); // Row label. // Reihenbeschriftung.
+        for (int column = 0; column < 10; column++) // One value per column. // Ein Wert pro Spalte.
+        {
+            printf(" %2lld", sum.heat[row * 10 + column] * 99 / maxHeat); // Scaled to 0-99. // Auf 0-99 skaliert.
+        }
+        printf("\n"); // Ends the row. // Beendet die Reihe.
+    }
+    long long toppedOut = sum.games - sum.topOutPiece[0]; // Games that ended by a blocked spawn. // Spiele, die durch ein blockiertes Erscheinen endeten.
+    printf("\ntop-outs: %lld games (%.1f%%), %lld ended by the piece limit\n", toppedOut, sum.games > 0 ? 100.0 * toppedOut / sum.games : 0.0, sum.topOutPiece[0]); // Top-out count and share. // Überlauf-Anzahl und Anteil.
+    const char *pieceNames[8] = {"-", "L", "J", "I", "O", "S", "T", "Z"}; // Block ids as in blocks.cpp. // Block-IDs wie in blocks.cpp.
+    printf("  piece that could not spawn:"); // Label of the per-piece line. // Beschriftung der Zeile pro Stück.
+    for (int id = 1; id < 8; id++) // Every block id. // Jede Block-ID.
+    {
+        printf(" %s %.1f%%", pieceNames[id], toppedOut > 0 ? 100.0 * sum.topOutPiece[id] / toppedOut : 0.0); // Share of top-outs caused by this piece. // Anteil der Überläufe durch dieses Stück.
+    }
+    long long finalCells = 0; // Cells of all final locks. // Zellen aller letzten Sperrungen.
+    for (int column = 0; column < 10; column++) // Sums the columns. // Summiert die Spalten.
+    {
+        finalCells += sum.topOutColumns[column]; // Adds one column. // Addiert eine Spalte.
+    }
+    printf("\n  columns of the final lock:  "); // Label of the per-column line. // Beschriftung der Zeile pro Spalte.
+    for (int column = 0; column < 10; column++) // Every column. // Jede Spalte.
+    {
+        printf(" %4.1f%%", finalCells > 0 ? 100.0 * sum.topOutColumns[column] / finalCells : 0.0); // Share of final-lock cells in this column. // Anteil der Zellen letzter Sperrungen in dieser Spalte.
+    }
+    printf("\n"); // Ends the report. // Beendet den Bericht.
+    return 0; // Success. // Erfolg.
+}
@@ -0,0 +1,247 @@
+/// High-Score Store Benchmark
+///
+/// Command-line tool that fills a ScoreStore (scores.h) with millions of games and measures submit latency, insert rate, startup time, queries and compaction. // Kommandozeilenwerkzeug, das einen ScoreStore (scores.h) mit Millionen Spielen füllt und Einreich-Latenz, Einfügerate, Startzeit, Abfragen und Verdichtung misst.
+/// It also damages the files the way a crash would and checks that the store recovers with the same leaderboards. // Es beschädigt die Dateien außerdem wie ein Absturz und prüft, dass sich der Store mit denselben Bestenlisten erholt.
+///
+/// Usage:
+/// ```cpp
+/// // Build and run (no raylib needed)
+/// g++ -O2 -std=c++14 -Isrc -o score_bench tools/score_bench.cpp src/scores.cpp -lpthread
+/// ./score_bench /tmp/bench 2000000 500 365   // 2M games by 500 players over the last 365 days
+/// ```
+///
+/// EN: Deletes <prefix>.log and <prefix>.idx before it starts.
+/// DE: Löscht <prefix>.log und <prefix>.idx vor dem Start.
+
+#include "scores.h" // Includes the ScoreStore under test. // Inkludiert den zu testenden ScoreStore.
+#include <chrono> // Includes steady_clock for timing. // Inkludiert steady_clock für die Zeitmessung.
+#include <cstdio> // Includes printf/snprintf/fopen. // Inkludiert printf/snprintf/fopen.
+#include <cstdlib> // Includes atoi/atoll for arguments. // Inkludiert atoi/atoll für Argumente.
+#include <cstring> // Includes memcmp for result comparison. // Inkludiert memcmp für den Ergebnisvergleich.
+#include <ctime> // Includes time for the current period. // Inkludiert time für den aktuellen Zeitraum.
+#include <string> // Includes string for file names. // Inkludiert string für Dateinamen.
+#include <thread> // Includes sleep_for while waiting for the writer. // Inkludiert sleep_for beim Warten auf den Writer.
+
+static double Milliseconds(std::chrono::steady_clock::time_point start) // Elapsed time since start. // Verstrichene Zeit seit start.
+{
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+static void WaitReady(ScoreStore &store) // Waits until the writer thread has opened the files. // Wartet, bis der Writer-Thread die Dateien geöffnet hat.
+{
+    while (!store.IsReady())
+    {
+        std::this_thread::sleep_for(std::chrono::microseconds(200));
+    }
+}
+
+static bool SameEntries(const ScoreEntry *a, int countA, const ScoreEntry *b, int countB) // Compares two result lists by score, time, tag and sequence. // Vergleicht zwei Ergebnislisten nach Punktzahl, Zeit, Kennung und Sequenz.
+{
+    if (countA != countB)
+    {
+        return false;
+    }
+    for (int i = 0; i < countA; i++)
+    {
+        if (a[i].score != b[i].score || a[i].time != b[i].time || a[i].sequence != b[i].sequence || memcmp(a[i].tag, b[i].tag, SCORE_TAG_LENGTH) != 0)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+struct Snapshot // Every board plus one player's queries, to compare across reopen, compaction and recovery. // Jede Liste plus die Abfragen eines Spielers, zum Vergleich über Wiederöffnen, Verdichtung und Wiederherstellung.
+{
+    ScoreEntry boards[ScorePeriodCount][SCORE_BOARD_SIZE];
+    int boardCounts[ScorePeriodCount];
+    ScoreEntry player[ScorePeriodCount][SCORE_BOARD_SIZE];
+    int playerCounts[ScorePeriodCount];
+};
+
+static void TakeSnapshot(ScoreStore &store, long long now, const char *tag, Snapshot &snapshot) // Reads all boards from the index and all periods of one player from the log. // Liest alle Listen aus dem Index und alle Zeiträume eines Spielers aus dem Log.
+{
+    for (int period = 0; period < ScorePeriodCount; period++)
+    {
+        snapshot.boardCounts[period] = store.GetTop((ScorePeriod)period, now, snapshot.boards[period], SCORE_BOARD_SIZE);
+        snapshot.playerCounts[period] = store.Query((ScorePeriod)period, tag, now, snapshot.player[period], SCORE_BOARD_SIZE);
+    }
+}
+
+static bool SameSnapshot(const Snapshot &a, const Snapshot &b) // True if every board and query matches. // Wahr, wenn jede Liste und Abfrage übereinstimmt.
+{
+    for (int period = 0; period < ScorePeriodCount; period++)
+    {
+        if (!SameEntries(a.boards[period], a.boardCounts[period], b.boards[period], b.boardCounts[period]) || !SameEntries(a.player[period], a.playerCounts[period], b.player[period], b.playerCounts[period]))
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+int main(int argc, char **argv) // Entry point: argv[1] = file prefix, argv[2] = games, argv[3] = players, argv[4] = days. // Einstiegspunkt: argv[1] = Dateipräfix, argv[2] = Spiele, argv[3] = Spieler, argv[4] = Tage.
+{
+    const char *prefix = argc > 1 ? argv[1] : "score_bench"; // Files are <prefix>.log and <prefix>.idx. // Dateien sind <prefix>.log und <prefix>.idx.
+    long long games = argc > 2 ? atoll(argv[2]) : 2000000; // Games to insert. // Einzufügende Spiele.
+    int players = argc > 3 ? atoi(argv[3]) : 500; // Distinct player tags. // Verschiedene Spielerkennungen.
+    int days = argc > 4 ? atoi(argv[4]) : 365; // History length ending now. // Länge der Historie bis jetzt.
+    games = games > 0 ? games : 1;
+    players = players > 0 ? players : 1;
+    days = days > 0 ? days : 1;
+    std::string logPath = std::string(prefix) + ".log";
+    std::string indexPath = std::string(prefix) + ".idx";
+    remove(logPath.c_str());
+    remove(indexPath.c_str());
+    long long now = (long long)time(nullptr);
+    const char *probe = "P7"; // Player whose queries are compared. // Spieler, dessen Abfragen verglichen werden.
+    bool ok = true;
+    Snapshot reference; // State after loading. // Zustand nach dem Laden.
+    Snapshot check; // State after each step. // Zustand nach jedem Schritt.
+
+    {
+        ScoreStore store(prefix, 1 << 30); // No automatic compaction while loading. // Keine automatische Verdichtung während des Ladens.
+        WaitReady(store);
+        unsigned long long random = 0x9E3779B97F4A7C15ULL; // Xorshift64 state for scores and tags. // Xorshift64-Zustand für Punktzahlen und Kennungen.
+        double worstSubmitUs = 0; // Slowest accepted Submit call. // Langsamster angenommener Submit-Aufruf.
+        long long retries = 0; // Submits refused by a full queue (the loader retries; the game would drop). // Von einer vollen Warteschlange abgelehnte Submits (der Lader wiederholt; das Spiel würde verwerfen).
+        auto start = std::chrono::steady_clock::now();
+        for (long long game = 0; game < games; game++)
+        {
+            random ^= random << 13;
+            random ^= random >> 7;
+            random ^= random << 17;
+            char tag[SCORE_TAG_LENGTH];
+            snprintf(tag, sizeof(tag), "P%d", (int)(random % (unsigned long long)players));
+            int score = (int)((random >> 20) % 2000) + (int)((random >> 40) % 8) * (int)((random >> 44) % 3000); // Mostly short games, a long tail of good ones. // Meist kurze Spiele, ein langer Schwanz guter.
+            long long when = now - (long long)days * 86400 + (long long)((double)(game + 1) / games * days * 86400); // Chronological, the last game now. // Chronologisch, das letzte Spiel jetzt.
+            while (true)
+            {
+                auto submitStart = std::chrono::steady_clock::now();
+                bool accepted = store.Submit(tag, score, when);
+                double us = Milliseconds(submitStart) * 1000.0;
+                if (accepted)
+                {
+                    worstSubmitUs = us > worstSubmitUs ? us : worstSubmitUs;
+                    break;
+                }
+                retries++;
+                std::this_thread::yield();
+            }
+        }
+        double submitMs = Milliseconds(start);
+        while (store.GetStoredCount() < games)
+        {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+        double storeMs = Milliseconds(start);
+        printf("load: %lld games, %d players, %d days\n", games, players, days);
+        printf("  submit: %.0f ns avg, %.1f us worst, %lld retries on a full queue\n", submitMs * 1e6 / games, worstSubmitUs, retries);
+        printf("  stored: %.0f games/s (log written and synced in batches)\n", games / (storeMs / 1000.0));
+
+        auto topStart = std::chrono::steady_clock::now();
+        ScoreEntry top[SCORE_BOARD_SIZE];
+        int topCount = 0;
+        for (int repeat = 0; repeat < 10000; repeat++)
+        {
+            topCount = store.GetTop(ScoreAllTime, now, top, 10);
+        }
+        printf("  GetTop(10): %.2f us\n", Milliseconds(topStart) * 1000.0 / 10000);
+        auto queryStart = std::chrono::steady_clock::now();
+        TakeSnapshot(store, now, probe, reference);
+        printf("  4 boards + 4 player queries: %.1f ms (queries scan %.1f MB)\n", Milliseconds(queryStart), store.GetLogCount() * sizeof(ScoreEntry) / 1e6);
+        ScoreEntry scanned[SCORE_BOARD_SIZE]; // Boards from the index must equal a full log scan. // Listen aus dem Index müssen einem vollen Log-Scan entsprechen.
+        for (int period = 0; period < ScorePeriodCount; period++)
+        {
+            int count = store.Query((ScorePeriod)period, nullptr, now, scanned, SCORE_BOARD_SIZE);
+            if (!SameEntries(reference.boards[period], reference.boardCounts[period], scanned, count))
+            {
+                printf("  MISMATCH: board %d differs from a log scan\n", period);
+                ok = false;
+            }
+        }
+        if (topCount > 0)
+        {
+            printf("  best: %.11s %d\n", top[0].tag, top[0].score);
+        }
+    }
+
+    {
+        auto start = std::chrono::steady_clock::now();
+        ScoreStore store(prefix, 1 << 30);
+        WaitReady(store);
+        printf("reopen with %lld games: ready after %.2f ms (writer open %.2f ms, rebuilt %s)\n", store.GetLogCount(), Milliseconds(start), store.GetOpenMs(), store.WasRebuilt() ? "yes" : "no");
+        TakeSnapshot(store, now, probe, check);
+        if (!SameSnapshot(reference, check))
+        {
+            printf("  MISMATCH after reopen\n");
+            ok = false;
+        }
+        long long before = store.GetLogCount();
+        store.RequestCompaction();
+        while (store.GetCompactions() == 0)
+        {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+        printf("compaction: %lld -> %lld games in %.0f ms (best %d per player and day kept)\n", before, store.GetLogCount(), store.GetCompactionMs(), SCORE_BOARD_SIZE);
+        TakeSnapshot(store, now, probe, check);
+        if (!SameSnapshot(reference, check))
+        {
+            printf("  MISMATCH after compaction\n");
+            ok = false;
+        }
+    }
+
+    FILE *file = fopen(logPath.c_str(), "ab"); // Crash in the middle of a write: half a record at the end. // Absturz mitten in einem Schreibvorgang: ein halber Datensatz am Ende.
+    if (file != nullptr)
+    {
+        fwrite("torn record", 1, 11, file);
+        fclose(file);
+    }
+    {
+        auto start = std::chrono::steady_clock::now();
+        ScoreStore store(prefix, 1 << 30);
+        WaitReady(store);
+        printf("reopen after torn write: ready after %.2f ms (rebuilt %s)\n", Milliseconds(start), store.WasRebuilt() ? "yes" : "no");
+        TakeSnapshot(store, now, probe, check);
+        if (!SameSnapshot(reference, check))
+        {
+            printf("  MISMATCH after torn write\n");
+            ok = false;
+        }
+    }
+
+    file = fopen(indexPath.c_str(), "rb+"); // Crash while the boards were being changed: the dirty flag is still set. // Absturz, während die Listen geändert wurden: die Unsauber-Flagge ist noch gesetzt.
+    if (file != nullptr)
+    {
+        unsigned int dirty = 1;
+        fseek(file, 12, SEEK_SET); // ScoreIndex::dirty. // ScoreIndex::dirty.
+        fwrite(&dirty, sizeof(dirty), 1, file);
+        fclose(file);
+    }
+    {
+        auto start = std::chrono::steady_clock::now();
+        ScoreStore store(prefix, 1 << 30);
+        WaitReady(store);
+        printf("reopen after crash during an index update: ready after %.2f ms (rebuilt %s from %lld games)\n", Milliseconds(start), store.WasRebuilt() ? "yes" : "no", store.GetLogCount());
+        TakeSnapshot(store, now, probe, check);
+        if (!SameSnapshot(reference, check))
+        {
+            printf("  MISMATCH after rebuild\n");
+            ok = false;
+        }
+        store.Submit(probe, 1 << 30, now); // New record, visible once the writer wakes up. // Neuer Rekord, sichtbar, sobald der Writer aufwacht.
+        while (store.GetStoredCount() < 1)
+        {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+        ScoreEntry top[1];
+        if (store.GetTop(ScoreToday, now, top, 1) != 1 || top[0].score != 1 << 30)
+        {
+            printf("  MISMATCH: new record not on today's board\n");
+            ok = false;
+        }
+    }
+    printf(ok ? "all leaderboards matched\n" : "leaderboards differ\n");
+    return ok ? 0 : 1;
+}
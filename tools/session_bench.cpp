@@ -0,0 +1,102 @@
+/// Session Pool Benchmark
+/// 
+/// Command-line tool that fills a SessionPool (sessions.h), steps every session with random input and churns sessions. // Kommandozeilenwerkzeug, das einen SessionPool (sessions.h) füllt, jede Sitzung mit zufälliger Eingabe ausführt und Sitzungen austauscht.
+/// Reports bytes per session, sessions stepped per second for increasing thread counts, and create/destroy operations per second. // Meldet Bytes pro Sitzung, ausgeführte Sitzungen pro Sekunde für steigende Thread-Anzahlen und Erzeugen/Zerstören-Operationen pro Sekunde.
+/// 
+/// Usage:
+/// ```cpp
+/// // Build and run (no raylib needed)
+/// g++ -O2 -std=c++14 -Isrc -o session_bench tools/session_bench.cpp src/sessions.cpp src/engine.cpp src/shapes.cpp src/zobrist.cpp src/workers.cpp -lpthread
+/// ./session_bench 1000000 2.0   // one million sessions, 2 seconds per measurement
+/// ```
+/// 
+/// EN: Games that end are destroyed and replaced, as a server would do, so the live count stays constant.
+/// DE: Beendete Spiele werden zerstört und ersetzt, wie es ein Server tun würde, daher bleibt die Anzahl aktiver Sitzungen konstant.
+
+#include "sessions.h" // Includes the pool under test. // Inkludiert den getesteten Pool.
+#include <chrono> // Includes steady_clock for timing. // Inkludiert steady_clock für die Zeitmessung.
+#include <cstdio> // Includes printf for the report. // Inkludiert printf für den Bericht.
+#include <cstdlib> // Includes atoi/atof for arguments. // Inkludiert atoi/atof für Argumente.
+
+static unsigned int randomState = 2463534242u; // Xorshift state for input and churn. // Xorshift-Zustand für Eingabe und Austausch.
+
+static unsigned int NextRandom() // Xorshift32 step. // Xorshift32-Schritt.
+{
+    randomState ^= randomState << 13;
+    randomState ^= randomState >> 17;
+    randomState ^= randomState << 5;
+    return randomState;
+}
+
+static double SecondsSince(std::chrono::steady_clock::time_point start) // Elapsed seconds. // Verstrichene Sekunden.
+{
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+int main(int argc, char **argv) // Entry point: argv[1] = sessions, argv[2] = seconds per measurement. // Einstiegspunkt: argv[1] = Sitzungen, argv[2] = Sekunden pro Messung.
+{
+    int count = argc > 1 ? atoi(argv[1]) : 100000; // Live sessions. // Aktive Sitzungen.
+    double seconds = argc > 2 ? atof(argv[2]) : 2.0; // Duration of each measurement. // Dauer jeder Messung.
+
+    SessionPool sessions(4096, 4); // 4096 sessions per slab, gravity every 4 ticks. // 4096 Sitzungen pro Slab, Schwerkraft alle 4 Ticks.
+    auto start = std::chrono::steady_clock::now(); // Start timestamp. // Start-Zeitstempel.
+    for (int i = 0; i < count; i++) // Mix of bots, practice and ranked games. // Mischung aus Bots, Übungs- und gewerteten Spielen.
+    {
+        sessions.Create((unsigned long long)i, i % 3);
+    }
+    double createSeconds = SecondsSince(start);
+    printf("%d sessions: %zu bytes per Session record, %.1f bytes per session reserved, %.1f MB total, %.0f creates/s\n", count, sizeof(Session), sessions.GetBytesPerSession(), sessions.GetReservedBytes() / 1048576.0, count / createSeconds);
+
+    for (int threads : WorkerPool::GetThreadSweep()) // Sweeps 1, 2, 4, ... threads and all hardware threads. // Durchläuft 1, 2, 4, ... Threads und alle Hardware-Threads.
+    {
+        WorkerPool pool(threads); // Pool for this measurement. // Pool für diese Messung.
+        long long stepped = 0; // Session ticks performed. // Ausgeführte Sitzungs-Ticks.
+        long long replaced = 0; // Finished sessions replaced. // Ersetzte beendete Sitzungen.
+        double stepSeconds = 0.0; // Time spent in Step only. // Nur in Step verbrachte Zeit.
+        start = std::chrono::steady_clock::now();
+        while (SecondsSince(start) < seconds)
+        {
+            for (int i = 0; i < sessions.GetLiveCount(); i++) // Random input for about half of the sessions. // Zufällige Eingabe für etwa die Hälfte der Sitzungen.
+            {
+                unsigned int value = NextRandom();
+                if (value & 1)
+                {
+                    sessions.Get(sessions.GetId(i))->action = (unsigned char)((value >> 1) % 5);
+                }
+            }
+            auto stepStart = std::chrono::steady_clock::now();
+            sessions.Step(pool); // One tick of every session. // Ein Tick jeder Sitzung.
+            stepSeconds += SecondsSince(stepStart);
+            stepped += sessions.GetLiveCount();
+            for (int i = sessions.GetLiveCount() - 1; i >= 0; i--) // Replaces finished games (backwards, since Destroy swaps the last entry in). // Ersetzt beendete Spiele (rückwärts, da Destroy den letzten Eintrag hineintauscht).
+            {
+                unsigned long long id = sessions.GetId(i);
+                Session *session = sessions.Get(id);
+                if (session->engine.gameOver)
+                {
+                    int kind = session->kind;
+                    sessions.Destroy(id);
+                    sessions.Create(NextRandom(), kind);
+                    replaced++;
+                }
+            }
+        }
+        printf("threads %2d: %12.0f sessions stepped/s  (%lld finished games replaced)\n", threads, stepped / stepSeconds, replaced);
+    }
+
+    long long operations = 0; // Destroy/create pairs performed. // Durchgeführte Zerstören/Erzeugen-Paare.
+    start = std::chrono::steady_clock::now();
+    while (SecondsSince(start) < seconds / 4) // Churn: random destroy followed by a create that reuses the slot. // Austausch: zufälliges Zerstören gefolgt von einem Erzeugen, das den Platz wiederverwendet.
+    {
+        for (int i = 0; i < 1000; i++)
+        {
+            unsigned long long id = sessions.GetId((int)(NextRandom() % (unsigned int)sessions.GetLiveCount()));
+            int kind = sessions.Get(id)->kind;
+            sessions.Destroy(id);
+            sessions.Create(NextRandom(), kind);
+        }
+        operations += 1000;
+    }
+    printf("churn: %.0f destroy+create pairs/s, %d bots, %d practice, %d ranked, %.1f MB reserved\n", operations / SecondsSince(start), sessions.GetKindCount(SessionBot), sessions.GetKindCount(SessionPractice), sessions.GetKindCount(SessionRanked), sessions.GetReservedBytes() / 1048576.0);
+    return 0;
+}
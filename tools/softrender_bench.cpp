@@ -0,0 +1,95 @@
+/// Software Renderer Benchmark
+/// 
+/// Command-line tool that measures SoftRenderer throughput on one core without a window or GPU. // Kommandozeilenwerkzeug, das den SoftRenderer-Durchsatz auf einem Kern ohne Fenster oder GPU misst.
+/// Optionally writes one frame as a PPM image for comparison with a raylib screenshot (TakeScreenshot). // Schreibt optional einen Frame als PPM-Bild zum Vergleich mit einem raylib-Screenshot (TakeScreenshot).
+/// 
+/// Usage:
+/// ```cpp
+/// // Build and run (no raylib needed)
+/// g++ -O2 -std=c++14 -Isrc -o softrender_bench tools/softrender_bench.cpp src/softrender.cpp
+/// ./softrender_bench 20000 frame.ppm
+/// ```
+/// 
+/// EN: Reports frames per second for full-size RGBA, full-size indexed, downscaled RGBA and one-byte-per-cell output.
+/// DE: Meldet Frames pro Sekunde für RGBA in voller Größe, indiziert in voller Größe, verkleinertes RGBA und ein Byte pro Zelle.
+
+#include "softrender.h" // Includes the SoftRenderer class that is benchmarked. // Inkludiert die SoftRenderer-Klasse, die gemessen wird.
+#include <chrono> // Includes steady_clock for timing. // Inkludiert steady_clock für die Zeitmessung.
+#include <cstdio> // Includes printf and file output for the PPM image. // Inkludiert printf und Dateiausgabe für das PPM-Bild.
+#include <cstdlib> // Includes atoi and rand for arguments and random boards. // Inkludiert atoi und rand für Argumente und zufällige Spielfelder.
+#include <vector> // Includes vector for frame buffers. // Inkludiert vector für Frame-Puffer.
+
+static BoardSnapshot MakeBoard(int seed) // Builds a plausible board: random stack in the lower half, a T-block falling and an I-block next. // Baut ein plausibles Spielfeld: zufälliger Stapel in der unteren Hälfte, fallender T-Block und I-Block als nächster.
+{
+    srand(seed); // Seeds the C random generator so every run is reproducible. // Initialisiert den C-Zufallsgenerator, damit jeder Lauf reproduzierbar ist.
+    BoardSnapshot board = {}; // Starts from an empty board. // Beginnt mit einem leeren Spielfeld.
+    for (int row = 10; row < 20; row++) // Fills the lower half. // Füllt die untere Hälfte.
+    {
+        for (int column = 0; column < 10; column++) // Visits every column of the row. // Besucht jede Spalte der Reihe.
+        {
+            board.cells[row][column] = (rand() % 3 == 0) ? 0 : (unsigned char)(1 + rand() % 7); // About two thirds of the cells are occupied. // Etwa zwei Drittel der Zellen sind belegt.
+        }
+    }
+    int tRows[4] = {2, 3, 3, 3}, tColumns[4] = {4, 3, 4, 5}; // T-block (id 6) cells in rotation 0, moved down two rows. // Zellen des T-Blocks (ID 6) in Rotation 0, zwei Reihen nach unten bewegt.
+    int iRows[4] = {0, 0, 0, 0}, iColumns[4] = {3, 4, 5, 6}; // I-block (id 3) cells at its spawn position. // Zellen des I-Blocks (ID 3) an seiner Spawn-Position.
+    for (int i = 0; i < 4; i++) // Copies both blocks into the snapshot. // Kopiert beide Blöcke in den Schnappschuss.
+    {
+        board.currentRows[i] = tRows[i];
+        board.currentColumns[i] = tColumns[i];
+        board.nextRows[i] = iRows[i];
+        board.nextColumns[i] = iColumns[i];
+    }
+    board.currentId = 6; // Falling T-block. // Fallender T-Block.
+    board.nextId = 3; // I-block in the preview. // I-Block in der Vorschau.
+    return board; // Returns the test board. // Gibt das Testspielfeld zurück.
+}
+
+template <typename RenderFunction>
+static void Measure(const char *name, int frames, RenderFunction render) // Runs a render function repeatedly and prints frames per second. // Führt eine Renderfunktion wiederholt aus und gibt Frames pro Sekunde aus.
+{
+    auto start = std::chrono::steady_clock::now(); // Start timestamp. // Start-Zeitstempel.
+    for (int i = 0; i < frames; i++) // Renders the requested number of frames. // Rendert die angeforderte Anzahl Frames.
+    {
+        render(i); // Renders one frame (the index varies the board slightly). // Rendert einen Frame (der Index variiert das Spielfeld leicht).
+    }
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count(); // Elapsed wall time. // Verstrichene Wanduhrzeit.
+    printf("%-22s %10.0f frames/s  (%.2f us/frame)\n", name, frames / seconds, seconds * 1e6 / frames); // Prints throughput and latency. // Gibt Durchsatz und Latenz aus.
+}
+
+int main(int argc, char **argv) // Entry point: argv[1] = frame count, argv[2] = optional PPM output path. // Einstiegspunkt: argv[1] = Frame-Anzahl, argv[2] = optionaler PPM-Ausgabepfad.
+{
+    int frames = argc > 1 ? atoi(argv[1]) : 20000; // Number of frames per measurement. // Anzahl Frames pro Messung.
+    BoardSnapshot board = MakeBoard(1); // Test board shared by all measurements. // Von allen Messungen geteiltes Testspielfeld.
+
+    SoftRenderer full = SoftRenderer(1); // Full 500x620 renderer. // Renderer in voller Größe 500x620.
+    SoftRenderer small = SoftRenderer(5); // 100x124 downscaled renderer. // Verkleinerter Renderer 100x124.
+    std::vector<unsigned char> rgba((size_t)full.GetWidth() * full.GetHeight() * 4); // Full RGBA frame. // RGBA-Frame in voller Größe.
+    std::vector<unsigned char> indexed((size_t)full.GetWidth() * full.GetHeight()); // Full indexed frame. // Indizierter Frame in voller Größe.
+    std::vector<unsigned char> smallRgba((size_t)small.GetWidth() * small.GetHeight() * 4); // Downscaled RGBA frame. // Verkleinerter RGBA-Frame.
+    unsigned char cells[200]; // One byte per grid cell. // Ein Byte pro Rasterzelle.
+
+    Measure("rgba 500x620", frames, [&](int i) { board.currentColumns[0] = 4 + (i & 1); full.Render(board, rgba.data()); }); // Full-size RGBA. // RGBA in voller Größe.
+    Measure("indexed 500x620", frames, [&](int i) { board.currentColumns[0] = 4 + (i & 1); full.RenderIndexed(board, indexed.data()); }); // Full-size indexed. // Indiziert in voller Größe.
+    Measure("rgba 100x124 (1/5)", frames, [&](int i) { board.currentColumns[0] = 4 + (i & 1); small.Render(board, smallRgba.data()); }); // Downscaled RGBA. // Verkleinertes RGBA.
+    Measure("cells 20x10", frames * 10, [&](int i) { board.currentColumns[0] = 4 + (i & 1); SoftRenderer::RenderCells(board, cells); }); // One byte per cell. // Ein Byte pro Zelle.
+
+    if (argc > 2) // Writes a reference frame if a path was given. // Schreibt einen Referenz-Frame, falls ein Pfad angegeben wurde.
+    {
+        board.currentColumns[0] = 4; // Restores the unmodified T-block. // Stellt den unveränderten T-Block wieder her.
+        full.Render(board, rgba.data()); // Renders the frame to save. // Rendert den zu speichernden Frame.
+        FILE *file = fopen(argv[2], "wb"); // Opens the output file. // Öffnet die Ausgabedatei.
+        if (file == nullptr) // Reports a failed open. // Meldet ein fehlgeschlagenes Öffnen.
+        {
+            printf("cannot open %s\n", argv[2]);
+            return 1;
+        }
+        fprintf(file, "P6\n%d %d\n255\n", full.GetWidth(), full.GetHeight()); // Binary PPM header. // Binärer PPM-Header.
+        for (size_t i = 0; i < rgba.size(); i += 4) // Writes RGB and drops alpha. // Schreibt RGB und verwirft Alpha.
+        {
+            fwrite(&rgba[i], 1, 3, file);
+        }
+        fclose(file); // Closes the image file. // Schließt die Bilddatei.
+        printf("wrote %s\n", argv[2]);
+    }
+    return 0; // Successful exit. // Erfolgreiches Ende.
+}
@@ -0,0 +1,511 @@
+/// Authoritative Game Server
+/// 
+/// Headless Linux server that runs one authoritative game per TCP connection on an epoll event loop (protocol.h). // Headless Linux-Server, der ein autoritatives Spiel pro TCP-Verbindung auf einer epoll-Ereignisschleife ausführt (protocol.h).
+/// Every tick takes one queued input per connection, steps all sessions in one batch on the worker pool and sends back the confirmed state. // Jeder Tick nimmt eine wartende Eingabe pro Verbindung, führt alle Sitzungen in einem Stapel auf dem Worker-Pool aus und sendet den bestätigten Zustand zurück.
+/// 
+/// Usage:
+/// ```cpp
+/// // Build and run (Linux only, no raylib needed)
+/// g++ -O2 -std=c++14 -Isrc -o tetris_server tools/tetris_server.cpp src/sessions.cpp src/engine.cpp src/shapes.cpp src/zobrist.cpp src/workers.cpp -lpthread
+/// ./tetris_server 7777 60 12 0   // port, ticks per second, ticks per gravity step (12 at 60 Hz = 0.2 s), threads (0 = all)
+/// ```
+/// 
+/// EN: Clients never send scores, only key presses, so every score the server reports was produced by its own simulation.
+/// DE: Clients senden nie Punktzahlen, nur Tastendrücke, daher wurde jede vom Server gemeldete Punktzahl von seiner eigenen Simulation erzeugt.
+
+#include "protocol.h" // Includes the wire messages. // Inkludiert die Übertragungsnachrichten.
+#include "sessions.h" // Includes the session pool that holds every game. // Inkludiert den Sitzungspool, der jedes Spiel enthält.
+#include <algorithm> // Includes sort for the latency percentiles. // Inkludiert sort für die Latenz-Perzentile.
+#include <arpa/inet.h> // Includes htons/htonl for the listen address. // Inkludiert htons/htonl für die Lauschadresse.
+#include <cerrno> // Includes errno for non-blocking I/O. // Inkludiert errno für nicht blockierende Ein-/Ausgabe.
+#include <chrono> // Includes steady_clock for tick timing. // Inkludiert steady_clock für die Tick-Zeitmessung.
+#include <csignal> // Includes signal to ignore SIGPIPE. // Inkludiert signal, um SIGPIPE zu ignorieren.
+#include <fcntl.h> // Includes open for the spare descriptor. // Inkludiert open für den Reserve-Deskriptor.
+#include <cstdio> // Includes printf for the reports. // Inkludiert printf für die Berichte.
+#include <cstdlib> // Includes atoi for arguments. // Inkludiert atoi für Argumente.
+#include <cstring> // Includes memcpy for message framing. // Inkludiert memcpy für die Nachrichtenrahmung.
+#include <ctime> // Includes clock for process CPU time. // Inkludiert clock für die Prozess-CPU-Zeit.
+#include <netinet/in.h> // Includes sockaddr_in. // Inkludiert sockaddr_in.
+#include <netinet/tcp.h> // Includes TCP_NODELAY. // Inkludiert TCP_NODELAY.
+#include <sys/epoll.h> // Includes the epoll event loop. // Inkludiert die epoll-Ereignisschleife.
+#include <sys/socket.h> // Includes the socket calls. // Inkludiert die Socket-Aufrufe.
+#include <sys/timerfd.h> // Includes timerfd for the tick clock. // Inkludiert timerfd für den Tick-Takt.
+#include <unistd.h> // Includes read/close. // Inkludiert read/close.
+#include <vector> // Includes vector for the connection list. // Inkludiert vector für die Verbindungsliste.
+
+static const int stallSeconds = 5; // A client whose write buffer stays full this long is closed. // Ein Client, dessen Schreibpuffer so lange voll bleibt, wird geschlossen.
+
+struct Connection // One client and its session. // Ein Client und seine Sitzung.
+{
+    int fd; // Non-blocking socket. // Nicht blockierender Socket.
+    unsigned long long session; // SessionPool id. // SessionPool-ID.
+    unsigned int games; // Games started on this connection. // Auf dieser Verbindung gestartete Spiele.
+    unsigned char queueActions[16]; // Received inputs waiting for a tick (one is applied per tick, like one key press per frame). // Empfangene Eingaben, die auf einen Tick warten (eine pro Tick, wie ein Tastendruck pro Frame).
+    uint32_t queueSequences[16]; // Sequence numbers of the queued inputs. // Sequenznummern der wartenden Eingaben.
+    int queueHead; // Oldest queued input. // Älteste wartende Eingabe.
+    int queueCount; // Number of queued inputs. // Anzahl wartender Eingaben.
+    uint32_t ackSequence; // Sequence of the last applied input. // Sequenz der zuletzt angewendeten Eingabe.
+    unsigned char readBuffer[sizeof(InputMessage)]; // Partial message carried over between reads. // Teilnachricht, die zwischen Lesevorgängen übertragen wird.
+    int readLength; // Bytes in readBuffer. // Bytes in readBuffer.
+    unsigned char writeBuffer[4096]; // Messages not yet accepted by the socket. // Noch nicht vom Socket angenommene Nachrichten.
+    int writeLength; // Bytes in writeBuffer. // Bytes in writeBuffer.
+    bool welcomePending; // A WelcomeMessage must be sent for a new game. // Eine WelcomeMessage muss für ein neues Spiel gesendet werden.
+    bool stateSent; // At least one state was sent for the current game. // Mindestens ein Zustand wurde für das aktuelle Spiel gesendet.
+    uint64_t sentHash; // Hash of the last sent state. // Hash des zuletzt gesendeten Zustands.
+    int32_t sentScore; // Score of the last sent state. // Punktzahl des zuletzt gesendeten Zustands.
+    uint32_t sentAck; // Ack of the last sent state. // Bestätigung des zuletzt gesendeten Zustands.
+    bool sentGameOver; // Game-over flag of the last sent state. // Game-Over-Flagge des zuletzt gesendeten Zustands.
+    bool broken; // Set on socket errors; the main loop closes it after the current batch. // Bei Socket-Fehlern gesetzt; die Hauptschleife schließt sie nach dem aktuellen Stapel.
+    int stalledTicks; // Consecutive ticks whose message did not fit the write buffer. // Aufeinanderfolgende Ticks, deren Nachricht nicht in den Schreibpuffer passte.
+    bool stalled; // Closed because the client stopped reading. // Geschlossen, weil der Client nicht mehr liest.
+    long long inputs; // Inputs applied (for the report). // Angewendete Eingaben (für den Bericht).
+    long long dropped; // Inputs dropped because the queue was full. // Verworfene Eingaben, weil die Warteschlange voll war.
+    long long bytesSent; // Bytes written to the socket. // In den Socket geschriebene Bytes.
+    long long finished; // Games that reached game over. // Spiele, die Game Over erreicht haben.
+    int bestScore; // Best final score on this connection. // Beste Endpunktzahl auf dieser Verbindung.
+};
+
+static void Flush(Connection &connection) // Writes as much of the buffer as the socket accepts (edge-triggered EPOLLOUT calls this again). // Schreibt so viel vom Puffer, wie der Socket annimmt (flankengesteuertes EPOLLOUT ruft dies erneut auf).
+{
+    int offset = 0; // Bytes written in this call. // In diesem Aufruf geschriebene Bytes.
+    while (offset < connection.writeLength) // Until the buffer is empty or the socket is full. // Bis der Puffer leer oder der Socket voll ist.
+    {
+        ssize_t written = send(connection.fd, connection.writeBuffer + offset, connection.writeLength - offset, MSG_NOSIGNAL | MSG_DONTWAIT); // Non-blocking send without SIGPIPE. // Nicht blockierendes Senden ohne SIGPIPE.
+        if (written > 0) // Some bytes were accepted. // Einige Bytes wurden angenommen.
+        {
+            offset += (int)written; // Advances past them. // Rückt hinter sie vor.
+        }
+        else if (written < 0 && errno == EINTR) // Interrupted by a signal. // Von einem Signal unterbrochen.
+        {
+            continue; // Retries at once. // Versucht es sofort erneut.
+        }
+        else if (written < 0 && (errno == EAGAIN || errno == EWOULDBLOCK)) // Socket buffer full; the rest waits for EPOLLOUT. // Socket-Puffer voll; der Rest wartet auf EPOLLOUT.
+        {
+            break; // Stops writing for now. // Hört vorerst auf zu schreiben.
+        }
+        else // Any other error: the peer is gone. // Jeder andere Fehler: die Gegenstelle ist weg.
+        {
+            connection.broken = true; // Closed by the main loop. // Von der Hauptschleife geschlossen.
+            break; // Stops writing. // Hört auf zu schreiben.
+        }
+    }
+    if (offset > 0) // Moves the unsent rest to the front. // Verschiebt den ungesendeten Rest nach vorne.
+    {
+        memmove(connection.writeBuffer, connection.writeBuffer + offset, connection.writeLength - offset); // Keeps the unsent bytes in order. // Behält die ungesendeten Bytes in Reihenfolge.
+        connection.writeLength -= offset; // Bytes still waiting. // Noch wartende Bytes.
+        connection.bytesSent += offset; // Counted for the report. // Für den Bericht gezählt.
+    }
+}
+
+static bool Append(Connection &connection, const void *message, int size) // Queues a message; returns false if the buffer is full (the caller retries next tick). // Stellt eine Nachricht ein; gibt falsch zurück, wenn der Puffer voll ist (der Aufrufer versucht es im nächsten Tick erneut).
+{
+    if (connection.writeLength + size > (int)sizeof(connection.writeBuffer)) // The message does not fit behind the waiting bytes. // Die Nachricht passt nicht hinter die wartenden Bytes.
+    {
+        return false; // Not queued. // Nicht eingestellt.
+    }
+    memcpy(connection.writeBuffer + connection.writeLength, message, size); // Copies the message behind the waiting bytes. // Kopiert die Nachricht hinter die wartenden Bytes.
+    connection.writeLength += size; // Bytes now waiting. // Jetzt wartende Bytes.
+    return true; // Queued. // Eingestellt.
+}
+
+static void Stall(Connection &connection, int limit) // Counts a tick whose message did not fit; a client that stays full is closed instead of getting partial traffic. // Zählt einen Tick, dessen Nachricht nicht passte; ein Client, der voll bleibt, wird geschlossen, statt lückenhaften Verkehr zu erhalten.
+{
+    connection.stalledTicks++; // One more tick without room. // Ein weiterer Tick ohne Platz.
+    if (connection.stalledTicks >= limit) // Full for limit ticks in a row. // limit Ticks hintereinander voll.
+    {
+        connection.stalled = true; // Counted as stalled in the report. // Im Bericht als blockiert gezählt.
+        connection.broken = true; // The main loop closes it after the batch. // Die Hauptschleife schließt sie nach dem Stapel.
+    }
+}
+
+static void Receive(Connection &connection) // Reads until EAGAIN and queues every complete InputMessage. // Liest bis EAGAIN und stellt jede vollständige InputMessage ein.
+{
+    unsigned char buffer[4096]; // Raw bytes of one read. // Rohe Bytes eines Lesevorgangs.
+    while (true) // Until the socket has no more data. // Bis der Socket keine Daten mehr hat.
+    {
+        ssize_t received = read(connection.fd, buffer, sizeof(buffer)); // Reads what has arrived. // Liest, was angekommen ist.
+        if (received == 0) // Peer closed. // Gegenstelle geschlossen.
+        {
+            connection.broken = true; // Closed by the main loop. // Von der Hauptschleife geschlossen.
+            return; // Nothing more to read. // Nichts mehr zu lesen.
+        }
+        if (received < 0) // Error or nothing to read. // Fehler oder nichts zu lesen.
+        {
+            if (errno == EINTR) // Interrupted by a signal. // Von einem Signal unterbrochen.
+            {
+                continue; // Retries at once. // Versucht es sofort erneut.
+            }
+            if (errno != EAGAIN && errno != EWOULDBLOCK) // A real error, not just an empty socket. // Ein echter Fehler, nicht nur ein leerer Socket.
+            {
+                connection.broken = true; // Closed by the main loop. // Von der Hauptschleife geschlossen.
+            }
+            return; // Everything has been read. // Alles wurde gelesen.
+        }
+        for (ssize_t i = 0; i < received; i++) // Reassembles 8-byte messages across reads. // Setzt 8-Byte-Nachrichten über Lesevorgänge hinweg zusammen.
+        {
+            connection.readBuffer[connection.readLength++] = buffer[i]; // Collects the next byte. // Sammelt das nächste Byte.
+            if (connection.readLength < (int)sizeof(InputMessage)) // Message still incomplete. // Nachricht noch unvollständig.
+            {
+                continue; // Next byte. // Nächstes Byte.
+            }
+            connection.readLength = 0; // Next message starts with the next byte. // Nächste Nachricht beginnt mit dem nächsten Byte.
+            InputMessage input; // Complete message. // Vollständige Nachricht.
+            memcpy(&input, connection.readBuffer, sizeof(input)); // Copies the bytes into the struct. // Kopiert die Bytes in die Struktur.
+            if (input.type != MessageInput || input.action > PROTOCOL_RESTART) // Unknown data: the client is not speaking the protocol. // Unbekannte Daten: der Client spricht das Protokoll nicht.
+            {
+                connection.broken = true; // Closed by the main loop. // Von der Hauptschleife geschlossen.
+                return; // Ignores the rest of the data. // Ignoriert den Rest der Daten.
+            }
+            if (connection.queueCount == 16) // Client sends faster than the tick rate. // Client sendet schneller als die Tick-Rate.
+            {
+                connection.dropped++; // Counted for the report. // Für den Bericht gezählt.
+                continue; // Next message. // Nächste Nachricht.
+            }
+            int slot = (connection.queueHead + connection.queueCount) % 16; // Free slot behind the queued inputs. // Freier Platz hinter den wartenden Eingaben.
+            connection.queueActions[slot] = input.action; // Queues the action. // Stellt die Aktion ein.
+            connection.queueSequences[slot] = input.sequence; // Queues its sequence number. // Stellt ihre Sequenznummer ein.
+            connection.queueCount++; // One more queued input. // Eine weitere wartende Eingabe.
+        }
+    }
+}
+
+static double Percentile(std::vector<double> &values, double fraction) // Sorts in place and returns the requested percentile. // Sortiert an Ort und Stelle und gibt das gewünschte Perzentil zurück.
+{
+    if (values.empty()) // No samples. // Keine Messwerte.
+    {
+        return 0.0; // Reports zero. // Meldet null.
+    }
+    std::sort(values.begin(), values.end()); // Sorts the samples. // Sortiert die Messwerte.
+    size_t index = (size_t)(fraction * (double)(values.size() - 1) + 0.5); // Nearest-rank index. // Index des nächsten Rangs.
+    return values[index]; // Returns the percentile. // Gibt das Perzentil zurück.
+}
+
+int main(int argc, char **argv) // Entry point: argv[1] = port, argv[2] = ticks per second, argv[3] = gravity ticks, argv[4] = threads. // Einstiegspunkt: argv[1] = Port, argv[2] = Ticks pro Sekunde, argv[3] = Schwerkraft-Ticks, argv[4] = Threads.
+{
+    int port = argc > 1 ? atoi(argv[1]) : PROTOCOL_DEFAULT_PORT; // Listen port. // Lausch-Port.
+    int tickRate = argc > 2 ? atoi(argv[2]) : 60; // Ticks per second. // Ticks pro Sekunde.
+    int gravityTicks = argc > 3 ? atoi(argv[3]) : 12; // 12 ticks at 60 Hz = the game's 0.2 s gravity interval. // 12 Ticks bei 60 Hz = das 0,2-s-Schwerkraftintervall des Spiels.
+    int threadCount = argc > 4 ? atoi(argv[4]) : 0; // Worker threads (0 = all hardware threads). // Worker-Threads (0 = alle Hardware-Threads).
+    if (tickRate < 1 || tickRate > 255 || gravityTicks < 1 || gravityTicks > 255) // Tick counts must fit the one-byte fields of the WelcomeMessage. // Tick-Anzahlen müssen in die Ein-Byte-Felder der WelcomeMessage passen.
+    {
+        printf("tick rate and gravity ticks must be 1-255\n"); // Explains the limits. // Erklärt die Grenzen.
+        return 1; // Error exit. // Fehler-Exit.
+    }
+    signal(SIGPIPE, SIG_IGN); // Closed peers are handled through send errors. // Geschlossene Gegenstellen werden über Sendefehler behandelt.
+
+    int listener = socket(AF_INET, SOCK_STREAM | SOCK_NONBLOCK, 0); // Listening socket. // Lausch-Socket.
+    int enable = 1; // Option value. // Optionswert.
+    setsockopt(listener, SOL_SOCKET, SO_REUSEADDR, &enable, sizeof(enable)); // Lets a restarted server bind while old connections linger. // Lässt einen neu gestarteten Server binden, während alte Verbindungen nachwirken.
+    sockaddr_in address = {}; // All interfaces, so LAN clients can connect. // Alle Schnittstellen, damit LAN-Clients sich verbinden können.
+    address.sin_family = AF_INET; // IPv4. // IPv4.
+    address.sin_addr.s_addr = htonl(INADDR_ANY); // Binds every local address. // Bindet jede lokale Adresse.
+    address.sin_port = htons((uint16_t)port); // Port in network byte order. // Port in Netzwerk-Byte-Reihenfolge.
+    if (listener < 0 || bind(listener, (sockaddr *)&address, sizeof(address)) < 0 || listen(listener, 1024) < 0) // Socket, bind and listen must all succeed. // Socket, bind und listen müssen alle gelingen.
+    {
+        perror("listen"); // Prints the system error (e.g. port in use). // Gibt den Systemfehler aus (z. B. Port belegt).
+        return 1; // Error exit. // Fehler-Exit.
+    }
+    int timer = timerfd_create(CLOCK_MONOTONIC, TFD_NONBLOCK); // Tick clock. // Tick-Takt.
+    if (timer < 0) // No timerfd support. // Keine timerfd-Unterstützung.
+    {
+        perror("timerfd_create"); // Prints the system error. // Gibt den Systemfehler aus.
+        return 1; // Error exit. // Fehler-Exit.
+    }
+    long long period = 1000000000LL / tickRate; // Tick period in nanoseconds (a full second at 1 tick/s). // Tick-Periode in Nanosekunden (eine volle Sekunde bei 1 Tick/s).
+    itimerspec interval = {}; // Fires tickRate times per second. // Feuert tickRate-mal pro Sekunde.
+    interval.it_interval.tv_sec = (time_t)(period / 1000000000LL); // tv_nsec must stay below one second. // tv_nsec muss unter einer Sekunde bleiben.
+    interval.it_interval.tv_nsec = (long)(period % 1000000000LL); // Rest of the period in nanoseconds. // Rest der Periode in Nanosekunden.
+    interval.it_value = interval.it_interval; // First expiration after one period. // Erster Ablauf nach einer Periode.
+    if (timerfd_settime(timer, 0, &interval, nullptr) < 0) // Starts the timer. // Startet den Timer.
+    {
+        perror("timerfd_settime"); // Prints the system error. // Gibt den Systemfehler aus.
+        return 1; // Error exit. // Fehler-Exit.
+    }
+
+    int loop = epoll_create1(0); // Event loop. // Ereignisschleife.
+    if (loop < 0) // No epoll instance. // Keine epoll-Instanz.
+    {
+        perror("epoll_create1"); // Prints the system error. // Gibt den Systemfehler aus.
+        return 1; // Error exit. // Fehler-Exit.
+    }
+    static int listenerTag = 0; // Marks listener events. // Markiert Lausch-Ereignisse.
+    static int timerTag = 0; // Marks timer events. // Markiert Timer-Ereignisse.
+    epoll_event event = {}; // Registration record, reused for the listener and the timer. // Registrierungsdatensatz, für Lauscher und Timer wiederverwendet.
+    event.events = EPOLLIN; // Level-triggered readability. // Pegelgesteuerte Lesbarkeit.
+    event.data.ptr = &listenerTag; // Tells listener events apart from connections. // Unterscheidet Lausch-Ereignisse von Verbindungen.
+    if (epoll_ctl(loop, EPOLL_CTL_ADD, listener, &event) < 0) // Watches the listener. // Überwacht den Lauscher.
+    {
+        perror("epoll_ctl listener"); // Prints the system error. // Gibt den Systemfehler aus.
+        return 1; // Error exit. // Fehler-Exit.
+    }
+    event.data.ptr = &timerTag; // Tells timer events apart from connections. // Unterscheidet Timer-Ereignisse von Verbindungen.
+    if (epoll_ctl(loop, EPOLL_CTL_ADD, timer, &event) < 0) // Watches the timer. // Überwacht den Timer.
+    {
+        perror("epoll_ctl timer"); // Prints the system error. // Gibt den Systemfehler aus.
+        return 1; // Error exit. // Fehler-Exit.
+    }
+    int spare = open("/dev/null", O_RDONLY | O_CLOEXEC); // Reserve descriptor: freed to accept and drop a client when the process runs out of descriptors. // Reserve-Deskriptor: wird freigegeben, um einen Client anzunehmen und abzuweisen, wenn dem Prozess die Deskriptoren ausgehen.
+    long long rejected = 0; // Clients dropped because no descriptor was left. // Abgewiesene Clients, weil kein Deskriptor mehr frei war.
+    long long stalledClosed = 0; // Clients closed because they stopped reading. // Geschlossene Clients, weil sie nicht mehr lasen.
+    int stallTicks = tickRate * stallSeconds; // Full-buffer ticks after which a client is closed. // Ticks mit vollem Puffer, nach denen ein Client geschlossen wird.
+    bool listenerPaused = false; // True while the listener is removed from epoll for lack of descriptors. // Wahr, solange der Lauscher mangels Deskriptoren aus epoll entfernt ist.
+
+    WorkerPool pool(threadCount); // Threads for the batched tick. // Threads für den gestapelten Tick.
+    SessionPool sessions(4096, gravityTicks); // Every game lives here. // Jedes Spiel lebt hier.
+    std::vector<Connection *> connections; // Dense list of open connections, processed in parallel each tick. // Dichte Liste offener Verbindungen, jeden Tick parallel verarbeitet.
+    std::vector<double> tickMilliseconds; // Tick processing times of the current report window. // Tick-Verarbeitungszeiten des aktuellen Berichtsfensters.
+    tickMilliseconds.reserve(tickRate * 10); // Ten seconds of ticks, so the window never reallocates. // Zehn Sekunden Ticks, damit das Fenster nie neu alloziert.
+    long long ticks = 0; // Ticks run. // Ausgeführte Ticks.
+    long long missedTicks = 0; // Timer expirations skipped because a tick ran late. // Timer-Abläufe, die übersprungen wurden, weil ein Tick zu spät lief.
+    unsigned long long seedCounter = (unsigned long long)time(nullptr); // Source of per-game seeds. // Quelle der Seeds pro Spiel.
+    auto reportStart = std::chrono::steady_clock::now(); // Start of the report window. // Beginn des Berichtsfensters.
+    std::clock_t cpuStart = std::clock(); // Process CPU time at the window start (all threads). // Prozess-CPU-Zeit zu Beginn des Fensters (alle Threads).
+    long long inputsBefore = 0; // Inputs applied before this window. // Vor diesem Fenster angewendete Eingaben.
+    long long closedInputs = 0; // Inputs of connections that have been closed. // Eingaben bereits geschlossener Verbindungen.
+    long long closedFinished = 0; // Finished games of connections that have been closed. // Beendete Spiele bereits geschlossener Verbindungen.
+    int bestScore = 0; // Best server-confirmed final score so far. // Beste vom Server bestätigte Endpunktzahl bisher.
+    printf("listening on port %d, %d ticks/s, gravity every %d ticks, %d threads\n", port, tickRate, gravityTicks, pool.GetThreadCount()); // Startup line. // Startzeile.
+
+    epoll_event events[256]; // Events of one epoll_wait call. // Ereignisse eines epoll_wait-Aufrufs.
+    while (true) // Runs until epoll fails. // Läuft, bis epoll fehlschlägt.
+    {
+        int count = epoll_wait(loop, events, 256, -1); // Waits for sockets or the timer. // Wartet auf Sockets oder den Timer.
+        if (count < 0 && errno != EINTR) // A real error, not a signal. // Ein echter Fehler, kein Signal.
+        {
+            perror("epoll_wait"); // Prints the system error. // Gibt den Systemfehler aus.
+            break; // Leaves the loop. // Verlässt die Schleife.
+        }
+        for (int e = 0; e < count; e++) // Handles every event. // Behandelt jedes Ereignis.
+        {
+            if (events[e].data.ptr == &listenerTag) // New clients. // Neue Clients.
+            {
+                while (true) // Accepts until the queue is empty. // Nimmt an, bis die Warteschlange leer ist.
+                {
+                    int fd = accept4(listener, nullptr, nullptr, SOCK_NONBLOCK); // Non-blocking client socket. // Nicht blockierender Client-Socket.
+                    if (fd < 0) // No client accepted. // Kein Client angenommen.
+                    {
+                        if (errno == EINTR || errno == ECONNABORTED) // This client is gone; the next may be waiting. // Dieser Client ist weg; der nächste wartet vielleicht.
+                        {
+                            continue; // Tries the next client. // Versucht den nächsten Client.
+                        }
+                        if ((errno == EMFILE || errno == ENFILE) && spare >= 0) // Out of descriptors: the client would stay queued and wake every epoll_wait, so it is accepted on the spare descriptor and closed. // Keine Deskriptoren mehr: der Client bliebe in der Warteschlange und würde jedes epoll_wait wecken, daher wird er auf dem Reserve-Deskriptor angenommen und geschlossen.
+                        {
+                            close(spare); // Frees one descriptor. // Gibt einen Deskriptor frei.
+                            int dropped = accept(listener, nullptr, nullptr); // Takes the waiting client. // Nimmt den wartenden Client.
+                            if (dropped >= 0) // A client was taken. // Ein Client wurde genommen.
+                            {
+                                close(dropped); // Drops it at once. // Weist ihn sofort ab.
+                                rejected++; // Counted for the report. // Für den Bericht gezählt.
+                            }
+                            spare = open("/dev/null", O_RDONLY | O_CLOEXEC); // Takes the descriptor back. // Nimmt den Deskriptor zurück.
+                            if (dropped >= 0) // More clients may be waiting. // Weitere Clients warten vielleicht.
+                            {
+                                continue; // Tries the next client. // Versucht den nächsten Client.
+                            }
+                        }
+                        if (errno == EMFILE || errno == ENFILE) // No spare descriptor left either: stops listening until connections close. // Auch kein Reserve-Deskriptor mehr: hört auf zu lauschen, bis Verbindungen schließen.
+                        {
+                            epoll_ctl(loop, EPOLL_CTL_DEL, listener, nullptr); // Stops listener events. // Stoppt Lausch-Ereignisse.
+                            listenerPaused = true; // Resumed after the next close. // Nach dem nächsten Schließen fortgesetzt.
+                        }
+                        break; // EAGAIN: queue drained; anything else is retried on the next event. // EAGAIN: Warteschlange leer; alles andere wird beim nächsten Ereignis erneut versucht.
+                    }
+                    setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &enable, sizeof(enable)); // States are small and latency-sensitive. // Zustände sind klein und latenzempfindlich.
+                    Connection *connection = new Connection(); // Zero-initialized connection record. // Null-initialisierter Verbindungsdatensatz.
+                    connection->fd = fd; // Socket of the client. // Socket des Clients.
+                    connection->games = 1; // The first game. // Das erste Spiel.
+                    connection->session = sessions.Create(MixSeed(seedCounter++), SessionRanked); // Ranked session with a fresh seed. // Gewertete Sitzung mit frischem Seed.
+                    connection->welcomePending = true; // Sent with the first tick. // Mit dem ersten Tick gesendet.
+                    connections.push_back(connection); // Served from the next tick on. // Ab dem nächsten Tick bedient.
+                    epoll_event clientEvent = {}; // Registration record for the client. // Registrierungsdatensatz für den Client.
+                    clientEvent.events = EPOLLIN | EPOLLOUT | EPOLLRDHUP | EPOLLET; // Edge-triggered: read and flush until EAGAIN. // Flankengesteuert: lesen und leeren bis EAGAIN.
+                    clientEvent.data.ptr = connection; // Events point straight at the connection. // Ereignisse zeigen direkt auf die Verbindung.
+                    if (epoll_ctl(loop, EPOLL_CTL_ADD, fd, &clientEvent) < 0) // Without events the client could never be served; it is closed at the end of this batch. // Ohne Ereignisse könnte der Client nie bedient werden; er wird am Ende dieses Stapels geschlossen.
+                    {
+                        perror("epoll_ctl client"); // Prints the system error. // Gibt den Systemfehler aus.
+                        connection->broken = true; // Closed after the batch. // Nach dem Stapel geschlossen.
+                    }
+                }
+            }
+            else if (events[e].data.ptr == &timerTag) // Tick. // Tick.
+            {
+                uint64_t expirations = 0; // Timer periods since the last tick. // Timer-Perioden seit dem letzten Tick.
+                if (read(timer, &expirations, sizeof(expirations)) != sizeof(expirations)) // Consumes the expirations. // Verbraucht die Abläufe.
+                {
+                    continue; // Spurious wake-up. // Unbegründetes Aufwecken.
+                }
+                missedTicks += (long long)expirations - 1; // Late ticks are not replayed; gravity simply runs at the achieved rate. // Verspätete Ticks werden nicht nachgeholt; die Schwerkraft läuft einfach mit der erreichten Rate.
+                auto tickStart = std::chrono::steady_clock::now(); // Starts the tick timer. // Startet den Tick-Timer.
+                pool.ParallelFor((int)connections.size(), 64, [&](int begin, int end) { // Phase 1: one queued input per session. // Phase 1: eine wartende Eingabe pro Sitzung.
+                    for (int i = begin; i < end; i++) // Connections of this chunk. // Verbindungen dieses Blocks.
+                    {
+                        Connection &connection = *connections[i]; // Current connection. // Aktuelle Verbindung.
+                        if (connection.queueCount == 0) // No input this tick. // Keine Eingabe in diesem Tick.
+                        {
+                            continue; // Next connection. // Nächste Verbindung.
+                        }
+                        unsigned char action = connection.queueActions[connection.queueHead]; // Oldest queued action. // Älteste wartende Aktion.
+                        connection.ackSequence = connection.queueSequences[connection.queueHead]; // Acknowledged with the next state. // Mit dem nächsten Zustand bestätigt.
+                        connection.queueHead = (connection.queueHead + 1) % 16; // Removes it from the ring. // Entfernt sie aus dem Ring.
+                        connection.queueCount--; // One input fewer queued. // Eine wartende Eingabe weniger.
+                        connection.inputs++; // Counted for the report. // Für den Bericht gezählt.
+                        Session *session = sessions.Get(connection.session); // Game of this connection. // Spiel dieser Verbindung.
+                        if (action == PROTOCOL_RESTART) // New game only after game over, so a running score cannot be thrown away and retried. // Neues Spiel nur nach Game Over, damit eine laufende Punktzahl nicht verworfen und neu versucht werden kann.
+                        {
+                            if (session->engine.gameOver) // Ignored while the game runs. // Ignoriert, solange das Spiel läuft.
+                            {
+                                session->engine.Reset(MixSeed(connection.session ^ ((unsigned long long)connection.games << 40))); // Seed derived from the session and game number. // Seed aus Sitzung und Spielnummer abgeleitet.
+                                session->ticks = 0; // Gravity restarts with the game. // Die Schwerkraft beginnt mit dem Spiel neu.
+                                connection.games++; // Next game number. // Nächste Spielnummer.
+                                connection.welcomePending = true; // Announces the new game. // Kündigt das neue Spiel an.
+                                connection.stateSent = false; // The first state of the new game is always sent. // Der erste Zustand des neuen Spiels wird immer gesendet.
+                            }
+                        }
+                        else // Move or rotation. // Bewegung oder Rotation.
+                        {
+                            session->action = action; // Applied by the batched step. // Vom gestapelten Schritt angewendet.
+                        }
+                    }
+                });
+                sessions.Step(pool); // Phase 2: all sessions in one batch. // Phase 2: alle Sitzungen in einem Stapel.
+                pool.ParallelFor((int)connections.size(), 64, [&](int begin, int end) { // Phase 3: confirmed states back to the clients. // Phase 3: bestätigte Zustände zurück an die Clients.
+                    for (int i = begin; i < end; i++) // Connections of this chunk. // Verbindungen dieses Blocks.
+                    {
+                        Connection &connection = *connections[i]; // Current connection. // Aktuelle Verbindung.
+                        Session *session = sessions.Get(connection.session); // Game of this connection. // Spiel dieser Verbindung.
+                        Engine &game = session->engine; // Engine of the game. // Engine des Spiels.
+                        if (connection.welcomePending) // A new game has to be announced first. // Ein neues Spiel muss zuerst angekündigt werden.
+                        {
+                            WelcomeMessage welcome = {MessageWelcome, (uint8_t)tickRate, (uint8_t)gravityTicks, 0, connection.games, connection.session}; // Announces the game. // Kündigt das Spiel an.
+                            if (!Append(connection, &welcome, sizeof(welcome))) // No state of the new game may overtake its welcome. // Kein Zustand des neuen Spiels darf seine Begrüßung überholen.
+                            {
+                                Stall(connection, stallTicks); // Counts the full tick. // Zählt den vollen Tick.
+                                Flush(connection); // Tries to make room for the next tick. // Versucht, Platz für den nächsten Tick zu schaffen.
+                                continue; // Welcome retried next tick. // Begrüßung im nächsten Tick erneut versucht.
+                            }
+                            connection.welcomePending = false; // Welcome queued. // Begrüßung eingestellt.
+                        }
+                        uint64_t hash = game.GetHash(); // Hash of the confirmed state. // Hash des bestätigten Zustands.
+                        if (connection.stateSent && hash == connection.sentHash && game.score == connection.sentScore && connection.ackSequence == connection.sentAck && game.gameOver == connection.sentGameOver) // Same state, score, ack and game-over flag as last sent. // Gleicher Zustand, gleiche Punktzahl, Bestätigung und Game-Over-Flagge wie zuletzt gesendet.
+                        {
+                            continue; // Nothing changed; the client's view is current. // Nichts geändert; die Ansicht des Clients ist aktuell.
+                        }
+                        StateMessage state = {}; // Confirmed state. // Bestätigter Zustand.
+                        state.type = MessageState; // Message type. // Nachrichtentyp.
+                        state.gameOver = game.gameOver ? 1 : 0; // Game-over flag. // Game-Over-Flagge.
+                        state.currentId = game.currentBlock.id; // Falling block. // Fallender Block.
+                        state.rotation = game.currentBlock.rotation; // Its rotation. // Seine Rotation.
+                        state.row = game.currentBlock.row; // Its row offset. // Sein Reihen-Offset.
+                        state.column = game.currentBlock.column; // Its column offset. // Sein Spalten-Offset.
+                        state.nextId = game.nextBlock.id; // Preview block. // Vorschau-Block.
+                        state.ackSequence = connection.ackSequence; // Last applied input. // Zuletzt angewendete Eingabe.
+                        state.tick = session->ticks; // Server tick of the game. // Server-Tick des Spiels.
+                        state.score = game.score; // Server-confirmed score. // Vom Server bestätigte Punktzahl.
+                        state.hash = hash; // Lets the client check its prediction. // Lässt den Client seine Vorhersage prüfen.
+                        if (!Append(connection, &state, sizeof(state))) // Not remembered, so the next tick sends the then current state. // Nicht gemerkt, daher sendet der nächste Tick den dann aktuellen Zustand.
+                        {
+                            Stall(connection, stallTicks); // Counts the full tick. // Zählt den vollen Tick.
+                        }
+                        else // State queued. // Zustand eingestellt.
+                        {
+                            connection.stalledTicks = 0; // The client is reading again. // Der Client liest wieder.
+                            if (game.gameOver && !connection.sentGameOver) // Final, server-confirmed score. // Endgültige, vom Server bestätigte Punktzahl.
+                            {
+                                connection.finished++; // Counted for the report. // Für den Bericht gezählt.
+                                connection.bestScore = game.score > connection.bestScore ? game.score : connection.bestScore; // Best final score of this connection. // Beste Endpunktzahl dieser Verbindung.
+                            }
+                            connection.stateSent = true; // Remembers what the client has seen. // Merkt sich, was der Client gesehen hat.
+                            connection.sentHash = hash; // Remembers what the client has seen. // Merkt sich, was der Client gesehen hat.
+                            connection.sentScore = game.score; // Remembers what the client has seen. // Merkt sich, was der Client gesehen hat.
+                            connection.sentAck = connection.ackSequence; // Remembers what the client has seen. // Merkt sich, was der Client gesehen hat.
+                            connection.sentGameOver = game.gameOver; // Remembers what the client has seen. // Merkt sich, was der Client gesehen hat.
+                        }
+                        Flush(connection); // Writes what the socket accepts. // Schreibt, was der Socket annimmt.
+                    }
+                });
+                tickMilliseconds.push_back(std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - tickStart).count()); // Tick processing time. // Tick-Verarbeitungszeit.
+                ticks++; // Counts the tick. // Zählt den Tick.
+            }
+            else // Client socket. // Client-Socket.
+            {
+                Connection &connection = *static_cast<Connection *>(events[e].data.ptr); // Connection the event belongs to. // Verbindung, zu der das Ereignis gehört.
+                if (connection.broken) // Already marked for closing. // Bereits zum Schließen markiert.
+                {
+                    continue; // Skips the event. // Überspringt das Ereignis.
+                }
+                if (events[e].events & (EPOLLERR | EPOLLHUP | EPOLLRDHUP)) // Error or hang-up. // Fehler oder Verbindungsabbau.
+                {
+                    connection.broken = true; // Closed after the batch. // Nach dem Stapel geschlossen.
+                    continue; // Skips the event. // Überspringt das Ereignis.
+                }
+                if (events[e].events & EPOLLIN) // Data arrived. // Daten sind angekommen.
+                {
+                    Receive(connection); // Queues the inputs. // Stellt die Eingaben ein.
+                }
+                if (events[e].events & EPOLLOUT) // Room in the socket buffer. // Platz im Socket-Puffer.
+                {
+                    Flush(connection); // Sends what is still waiting. // Sendet, was noch wartet.
+                }
+            }
+        }
+        for (int i = (int)connections.size() - 1; i >= 0; i--) // Closes broken connections after the batch, so no event refers to a deleted record. // Schließt defekte Verbindungen nach dem Stapel, damit kein Ereignis auf einen gelöschten Datensatz verweist.
+        {
+            Connection *connection = connections[i]; // Current connection. // Aktuelle Verbindung.
+            if (!connection->broken) // Still open. // Noch offen.
+            {
+                continue; // Next connection. // Nächste Verbindung.
+            }
+            close(connection->fd); // Also removes it from epoll. // Entfernt sie auch aus epoll.
+            sessions.Destroy(connection->session); // Frees the game. // Gibt das Spiel frei.
+            closedInputs += connection->inputs; // Keeps its inputs in the totals. // Behält ihre Eingaben in den Summen.
+            closedFinished += connection->finished; // Keeps its finished games in the totals. // Behält ihre beendeten Spiele in den Summen.
+            stalledClosed += connection->stalled ? 1 : 0; // Counted for the report. // Für den Bericht gezählt.
+            bestScore = connection->bestScore > bestScore ? connection->bestScore : bestScore; // Keeps its best score. // Behält ihre beste Punktzahl.
+            connections[i] = connections.back(); // Moves the last connection into the gap. // Verschiebt die letzte Verbindung in die Lücke.
+            connections.pop_back(); // Shrinks the list. // Verkleinert die Liste.
+            delete connection; // Frees the record. // Gibt den Datensatz frei.
+        }
+        if (listenerPaused) // Resumes accepting once descriptors are free again (checked every event batch, at least every tick). // Nimmt wieder an, sobald wieder Deskriptoren frei sind (bei jedem Ereignisstapel geprüft, mindestens jeden Tick).
+        {
+            if (spare < 0) // The spare was used up. // Die Reserve wurde verbraucht.
+            {
+                spare = open("/dev/null", O_RDONLY | O_CLOEXEC); // Takes a spare descriptor again. // Nimmt wieder einen Reserve-Deskriptor.
+            }
+            event.data.ptr = &listenerTag; // event last held the timer tag. // event hielt zuletzt die Timer-Markierung.
+            if (spare >= 0 && epoll_ctl(loop, EPOLL_CTL_ADD, listener, &event) == 0) // Only with a spare in hand. // Nur mit einer Reserve in der Hand.
+            {
+                listenerPaused = false; // Accepting again. // Nimmt wieder an.
+            }
+        }
+        double window = std::chrono::duration<double>(std::chrono::steady_clock::now() - reportStart).count(); // Seconds in this report window. // Sekunden in diesem Berichtsfenster.
+        if (window >= 5.0) // Report every 5 seconds. // Bericht alle 5 Sekunden.
+        {
+            double cpu = (double)(std::clock() - cpuStart) / CLOCKS_PER_SEC; // CPU seconds used by all threads. // Von allen Threads verbrauchte CPU-Sekunden.
+            long long inputs = closedInputs; // Inputs applied so far. // Bisher angewendete Eingaben.
+            long long finished = closedFinished; // Games finished so far. // Bisher beendete Spiele.
+            long long bytes = 0; // Bytes sent to open connections. // An offene Verbindungen gesendete Bytes.
+            for (Connection *connection : connections) // Adds the open connections. // Addiert die offenen Verbindungen.
+            {
+                inputs += connection->inputs; // Inputs of this connection. // Eingaben dieser Verbindung.
+                finished += connection->finished; // Finished games of this connection. // Beendete Spiele dieser Verbindung.
+                bytes += connection->bytesSent; // Bytes of this connection. // Bytes dieser Verbindung.
+                bestScore = connection->bestScore > bestScore ? connection->bestScore : bestScore; // Best score of this connection. // Beste Punktzahl dieser Verbindung.
+            }
+            double cores = cpu / window; // Average busy cores. // Durchschnittlich ausgelastete Kerne.
+            int live = sessions.GetLiveCount(); // Sessions alive. // Lebende Sitzungen.
+            double tickCount = (double)tickMilliseconds.size(); // Ticks in this window. // Ticks in diesem Fenster.
+            double p50 = Percentile(tickMilliseconds, 0.50); // Median tick time. // Median der Tick-Zeit.
+            double p99 = Percentile(tickMilliseconds, 0.99); // 99th-percentile tick time. // Tick-Zeit des 99. Perzentils.
+            double worst = tickMilliseconds.empty() ? 0.0 : tickMilliseconds.back(); // Sorted, so the last value is the slowest tick. // Sortiert, daher ist der letzte Wert der langsamste Tick.
+            printf("sessions %d | ticks %.0f/s (missed %lld) | tick p50 %.3f ms p99 %.3f ms max %.3f ms | inputs %.0f/s | cpu %.2f cores | %.0f sessions/core | %lld finished (best %d), %.1f MB sent, %lld rejected, %lld stalled\n", // One report line. // Eine Berichtszeile.
+                   live, tickCount / window, missedTicks, p50, p99, worst, (inputs - inputsBefore) / window, cores, cores > 0.0 ? live / cores : 0.0, finished, bestScore, bytes / 1048576.0, rejected, stalledClosed);
+            fflush(stdout); // Visible at once when piped. // Sofort sichtbar, wenn umgeleitet.
+            tickMilliseconds.clear(); // Starts the next window. // Beginnt das nächste Fenster.
+            inputsBefore = inputs; // Inputs before the next window. // Eingaben vor dem nächsten Fenster.
+            missedTicks = 0; // Missed ticks per window. // Verpasste Ticks pro Fenster.
+            reportStart = std::chrono::steady_clock::now(); // Window start. // Fensterbeginn.
+            cpuStart = std::clock(); // CPU time at the window start. // CPU-Zeit zu Fensterbeginn.
+        }
+    }
+    return 0; // Exit after an epoll error. // Exit nach einem epoll-Fehler.
+}
@@ -0,0 +1,173 @@
+/// Transposition Table Benchmark
+/// 
+/// Command-line tool that runs a depth-limited lookahead over Engine states with and without the transposition table (transposition.h). // Kommandozeilenwerkzeug, das eine tiefenbegrenzte Vorausschau über Engine-Zustände mit und ohne Transpositionstabelle (transposition.h) ausführt.
+/// Reports searched nodes, hit rate, detected collisions and replacements, and checks every incremental hash against a full recomputation. // Meldet durchsuchte Knoten, Trefferquote, erkannte Kollisionen und Ersetzungen und prüft jeden inkrementellen Hash gegen eine vollständige Neuberechnung.
+/// 
+/// Usage:
+/// ```cpp
+/// // Build and run (no raylib needed)
+/// g++ -O2 -std=c++14 -Isrc -o tt_bench tools/tt_bench.cpp src/transposition.cpp src/zobrist.cpp src/engine.cpp src/shapes.cpp
+/// ./tt_bench 6 200 16   // depth 6, 200 moves, 16 MB table
+/// ```
+/// 
+/// EN: Left/right/rotate sequences reach the same position in many orders, which is exactly what the table collapses.
+/// DE: Links/Rechts/Rotieren-Folgen erreichen dieselbe Stellung in vielen Reihenfolgen, genau das fasst die Tabelle zusammen.
+
+#include "engine.h" // Includes the headless game rules. // Inkludiert die headless Spielregeln.
+#include "transposition.h" // Includes the table under test. // Inkludiert die getestete Tabelle.
+#include "zobrist.h" // Includes the keys for the full hash recomputation. // Inkludiert die Schlüssel für die vollständige Hash-Neuberechnung.
+#include <chrono> // Includes steady_clock for timing. // Inkludiert steady_clock für die Zeitmessung.
+#include <cstdio> // Includes printf for the report. // Inkludiert printf für den Bericht.
+#include <cstdlib> // Includes atoi for arguments. // Inkludiert atoi für Argumente.
+
+static long long nodes = 0; // Positions visited by the current search. // Von der aktuellen Suche besuchte Stellungen.
+static long long hashErrors = 0; // Incremental hashes that differed from the recomputation. // Inkrementelle Hashes, die von der Neuberechnung abwichen.
+
+static unsigned long long FullHash(const Engine &engine) // Recomputes the hash from scratch, without the incremental board hash. // Berechnet den Hash von Grund auf neu, ohne den inkrementellen Spielfeld-Hash.
+{
+    unsigned long long hash = 0; // Hash being built. // Entstehender Hash.
+    for (int row = 0; row < 20; row++)
+    {
+        for (int column = 0; column < 10; column++)
+        {
+            hash ^= zobrist.cells[row][column][engine.cells[row][column]];
+        }
+    }
+    int rows[4]; // Rows covered by the falling block. // Vom fallenden Block bedeckte Reihen.
+    int columns[4]; // Columns covered by the falling block. // Vom fallenden Block bedeckte Spalten.
+    const ShapeCell *shape = blockShapes[engine.currentBlock.id][engine.currentBlock.rotation];
+    for (int i = 0; i < 4; i++)
+    {
+        rows[i] = shape[i].row + engine.currentBlock.row;
+        columns[i] = shape[i].column + engine.currentBlock.column;
+    }
+    return hash ^ HashFallingBlock(engine.currentBlock.id, rows, columns) ^ zobrist.nextId[engine.nextBlock.id] ^ zobrist.bag[engine.bag];
+}
+
+static float Evaluate(const Engine &engine) // Simple leaf evaluation: score minus stack height. // Einfache Blattbewertung: Punkte minus Stapelhöhe.
+{
+    if (engine.gameOver)
+    {
+        return -1000000.0f;
+    }
+    int height = 0; // Sum of column heights. // Summe der Spaltenhöhen.
+    for (int column = 0; column < 10; column++)
+    {
+        for (int row = 0; row < 20; row++)
+        {
+            if (engine.cells[row][column] != 0)
+            {
+                height += 20 - row;
+                break;
+            }
+        }
+    }
+    return (float)engine.score - 10.0f * (float)height;
+}
+
+static void ApplyAction(Engine &engine, int action) // 0 left, 1 right, 2 rotate, 3 down (same moves as the keyboard). // 0 links, 1 rechts, 2 rotieren, 3 runter (gleiche Züge wie die Tastatur).
+{
+    if (action == 0)
+    {
+        engine.MoveBlockLeft();
+    }
+    else if (action == 1)
+    {
+        engine.MoveBlockRight();
+    }
+    else if (action == 2)
+    {
+        engine.RotateBlock();
+    }
+    else
+    {
+        engine.MoveBlockDown();
+    }
+}
+
+static float Search(Engine &engine, int depth, TranspositionTable *table, TranspositionStats &stats, int &bestMove) // Depth-limited maximum search. // Tiefenbegrenzte Maximumsuche.
+{
+    nodes++;
+    unsigned long long key = engine.GetHash(); // Incremental hash of the position. // Inkrementeller Hash der Stellung.
+    if (key != FullHash(engine)) // Verifies the incremental update. // Prüft die inkrementelle Aktualisierung.
+    {
+        hashErrors++;
+    }
+    if (depth == 0 || engine.gameOver) // Leaf. // Blatt.
+    {
+        return Evaluate(engine);
+    }
+    unsigned char check = engine.GetCheck(); // Collision check byte. // Kollisions-Prüfbyte.
+    TranspositionEntry entry; // Stored result, if any. // Gespeichertes Ergebnis, falls vorhanden.
+    if (table != nullptr && table->Probe(key, check, entry, stats) && entry.depth >= depth) // Deep enough result already known. // Ausreichend tiefes Ergebnis bereits bekannt.
+    {
+        bestMove = entry.move;
+        return entry.value;
+    }
+    float best = -1e30f; // Best child value. // Bester Kindwert.
+    for (int action = 0; action < 4; action++) // Tries every move. // Probiert jeden Zug.
+    {
+        Engine child = engine; // Cloning is a plain copy. // Klonen ist eine einfache Kopie.
+        ApplyAction(child, action);
+        int childMove = 0; // Unused best move of the child. // Ungenutzter bester Zug des Kindes.
+        float value = Search(child, depth - 1, table, stats, childMove);
+        if (value > best)
+        {
+            best = value;
+            bestMove = action;
+        }
+    }
+    if (table != nullptr)
+    {
+        table->Store(key, check, best, depth, bestMove, stats); // Remembers the result. // Merkt sich das Ergebnis.
+    }
+    return best;
+}
+
+static void Play(int depth, int moves, TranspositionTable *table, TranspositionStats &stats, double &seconds, int &score) // Plays one seeded game, searching before every move. // Spielt ein geseedetes Spiel und sucht vor jedem Zug.
+{
+    Engine engine; // Same seed for both runs, so the results are comparable. // Gleicher Seed für beide Läufe, damit die Ergebnisse vergleichbar sind.
+    engine.Reset(2024);
+    nodes = 0;
+    auto start = std::chrono::steady_clock::now(); // Start timestamp. // Start-Zeitstempel.
+    for (int i = 0; i < moves && !engine.gameOver; i++)
+    {
+        if (table != nullptr)
+        {
+            table->NewSearch(); // Entries from earlier moves become replaceable first. // Einträge früherer Züge werden zuerst ersetzbar.
+        }
+        int bestMove = 3; // Falls back to moving down. // Fällt auf Runterbewegen zurück.
+        Search(engine, depth, table, stats, bestMove);
+        ApplyAction(engine, bestMove);
+        if (i % 4 == 3) // Gravity every fourth move keeps the game progressing. // Schwerkraft bei jedem vierten Zug hält das Spiel in Bewegung.
+        {
+            engine.MoveBlockDown();
+        }
+    }
+    seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    score = engine.score;
+}
+
+int main(int argc, char **argv) // Entry point: argv[1] = depth, argv[2] = moves, argv[3] = table size in MB. // Einstiegspunkt: argv[1] = Tiefe, argv[2] = Züge, argv[3] = Tabellengröße in MB.
+{
+    int depth = argc > 1 ? atoi(argv[1]) : 6; // Search depth in moves. // Suchtiefe in Zügen.
+    int moves = argc > 2 ? atoi(argv[2]) : 200; // Moves to play. // Zu spielende Züge.
+    int megabytes = argc > 3 ? atoi(argv[3]) : 16; // Table size. // Tabellengröße.
+
+    TranspositionStats unused = {}; // Counters of the run without a table. // Zähler des Laufs ohne Tabelle.
+    double plainSeconds = 0.0;
+    int plainScore = 0;
+    Play(depth, moves, nullptr, unused, plainSeconds, plainScore);
+    long long plainNodes = nodes;
+    printf("without table: %lld nodes in %.3f s (%.0f nodes/s), score %d\n", plainNodes, plainSeconds, plainNodes / plainSeconds, plainScore);
+
+    TranspositionTable table(megabytes); // Table under test. // Getestete Tabelle.
+    TranspositionStats stats = {}; // Counters of the run with the table. // Zähler des Laufs mit Tabelle.
+    double tableSeconds = 0.0;
+    int tableScore = 0;
+    Play(depth, moves, &table, stats, tableSeconds, tableScore);
+    printf("with table:    %lld nodes in %.3f s (%.0f nodes/s), score %d, %lld entries, %.1f%% filled\n", nodes, tableSeconds, nodes / tableSeconds, tableScore, table.GetEntryCount(), 100.0 * table.GetFillRate());
+    TranspositionTable::PrintStats(stats);
+    printf("node reduction: %.2fx, speedup: %.2fx, hash errors: %lld\n", (double)plainNodes / (double)nodes, plainSeconds / tableSeconds, hashErrors);
+    return hashErrors == 0 ? 0 : 1; // Non-zero exit if the incremental hash ever disagreed. // Rückgabe ungleich null, falls der inkrementelle Hash je abwich.
+}